@@ -27,6 +27,9 @@ function(barretenberg_module MODULE_NAME)
     file(GLOB_RECURSE SOURCE_FILES *.cpp)
     file(GLOB_RECURSE HEADER_FILES *.hpp *.tcc)
     list(FILTER SOURCE_FILES EXCLUDE REGEX ".*\.(fuzzer|test|bench).cpp$")
+    # A module's main.cpp is the entry point of an executable of its own (e.g. bb), not part of the library. Keeping it
+    # out of the library lets the module's tests link the shared gtest main.
+    list(FILTER SOURCE_FILES EXCLUDE REGEX ".*/main\.cpp$")
 
     target_sources(
         barretenberg_headers
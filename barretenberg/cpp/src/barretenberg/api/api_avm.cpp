@@ -12,14 +12,22 @@
 namespace bb {
 namespace {
 
+// Stats are only collected if enabled (see vm2/tooling/stats.hpp).
+// If AVM_STATS_JSON is set, all of them are also written to that path as JSON.
 void print_avm_stats()
 {
-#ifdef AVM_TRACK_STATS
-    info("------- STATS -------");
     const auto& stats = ::bb::avm2::Stats::get();
+    if (!stats.is_enabled()) {
+        return;
+    }
+    info("------- STATS -------");
     const int levels = std::getenv("AVM_STATS_DEPTH") != nullptr ? std::stoi(std::getenv("AVM_STATS_DEPTH")) : 2;
     info(stats.to_string(levels));
-#endif
+
+    if (const char* json_path = std::getenv("AVM_STATS_JSON"); json_path != nullptr) {
+        const std::string json = stats.to_json();
+        write_file(json_path, std::vector<uint8_t>(json.begin(), json.end()));
+    }
 }
 
 } // namespace
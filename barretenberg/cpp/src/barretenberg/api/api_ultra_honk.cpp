@@ -11,6 +11,7 @@
 #include "barretenberg/dsl/acir_proofs/honk_zk_contract.hpp"
 #include "barretenberg/honk/proof_system/types/proof.hpp"
 #include "barretenberg/honk/types/aggregation_object_type.hpp"
+#include "barretenberg/honk/vk_cache.hpp"
 #include "barretenberg/srs/global_crs.hpp"
 
 namespace bb {
@@ -60,9 +61,7 @@ PubInputsProofAndKey<typename Flavor::VerificationKey> _compute_vk(const std::fi
                                                                    const std::filesystem::path& witness_path)
 {
     auto proving_key = _compute_proving_key<Flavor>(bytecode_path.string(), witness_path.string());
-    return { PublicInputsVector{},
-             HonkProof{},
-             std::make_shared<typename Flavor::VerificationKey>(proving_key->proving_key) };
+    return { PublicInputsVector{}, HonkProof{}, compute_verification_key_cached<Flavor>(proving_key->proving_key) };
 }
 
 template <typename Flavor>
@@ -75,7 +74,7 @@ PubInputsProofAndKey<typename Flavor::VerificationKey> _prove(const bool compute
     std::shared_ptr<typename Flavor::VerificationKey> vk;
     if (compute_vk) {
         info("WARNING: computing verification key while proving. Pass in a precomputed vk for better performance.");
-        vk = std::make_shared<typename Flavor::VerificationKey>(proving_key->proving_key);
+        vk = compute_verification_key_cached<Flavor>(proving_key->proving_key);
     } else {
         vk = std::make_shared<typename Flavor::VerificationKey>(
             from_buffer<typename Flavor::VerificationKey>(read_file(vk_path)));
@@ -292,11 +291,10 @@ void write_recursion_inputs_ultra_honk(const std::string& bytecode_path,
                                        const std::string& output_path)
 {
     using Prover = UltraProver_<Flavor>;
-    using VerificationKey = typename Flavor::VerificationKey;
     using FF = typename Flavor::FF;
 
     std::shared_ptr<DeciderProvingKey_<Flavor>> proving_key = _compute_proving_key<Flavor>(bytecode_path, witness_path);
-    auto verification_key = std::make_shared<VerificationKey>(proving_key->proving_key);
+    auto verification_key = compute_verification_key_cached<Flavor>(proving_key->proving_key);
     Prover prover{ proving_key, verification_key };
     std::vector<FF> proof = prover.construct_proof();
 
@@ -1,15 +1,21 @@
 #pragma once
 #include "barretenberg/common/log.hpp"
 #include "barretenberg/common/try_catch_shim.hpp"
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <fcntl.h>
 #include <fstream>
 #include <ios>
 #include <iostream>
+#include <span>
 #include <sys/stat.h>
 #include <unistd.h>
+#include <utility>
 #include <vector>
+#ifndef __wasm__
+#include <sys/mman.h>
+#endif
 
 namespace bb {
 inline size_t get_file_size(std::string const& filename)
@@ -24,11 +30,127 @@ inline size_t get_file_size(std::string const& filename)
     return (size_t)file.tellg();
 }
 
+/**
+ * @brief Read everything from a file descriptor, in large blocks.
+ * @details Used for stdin, pipes and process substitutions, whose size is not known in advance.
+ */
+inline std::vector<uint8_t> read_fd(int fd)
+{
+    constexpr size_t BLOCK_SIZE = static_cast<size_t>(1) << 20;
+    std::vector<uint8_t> data;
+    size_t size = 0;
+    while (true) {
+        data.resize(size + BLOCK_SIZE);
+        const ssize_t n = ::read(fd, data.data() + size, BLOCK_SIZE);
+        if (n < 0) {
+            THROW std::runtime_error(std::string("Failed to read: ") + strerror(errno));
+        }
+        if (n == 0) {
+            break;
+        }
+        size += static_cast<size_t>(n);
+    }
+    data.resize(size);
+    return data;
+}
+
+/**
+ * @brief A read-only view of the contents of a file (or of its first `bytes` bytes).
+ * @details Regular files are memory-mapped, so that large inputs such as the CRS or an IVC witness stack are paged in
+ * on demand and never copied into owned memory. Stdin ("-"), pipes and process substitutions can not be mapped and are
+ * read into a buffer instead, as is everything in wasm.
+ */
+class MappedFile {
+  public:
+    explicit MappedFile(const std::string& filename, size_t bytes = 0)
+    {
+        if (filename == "-") {
+            read_into_buffer(STDIN_FILENO, bytes);
+            return;
+        }
+        const int fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd == -1) {
+            THROW std::runtime_error("Unable to open file: " + filename);
+        }
+#ifndef __wasm__
+        struct stat st;
+        if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode)) {
+            const auto file_size = static_cast<size_t>(st.st_size);
+            const size_t size = bytes == 0 ? file_size : std::min(bytes, file_size);
+            if (size > 0) {
+                void* mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+                if (mapped != MAP_FAILED) {
+                    mapping = mapped;
+                    mapping_size = size;
+                    contents = { static_cast<const uint8_t*>(mapped), size };
+                    close(fd);
+                    return;
+                }
+            }
+        }
+#endif
+        read_into_buffer(fd, bytes);
+        close(fd);
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept
+        : mapping(std::exchange(other.mapping, nullptr))
+        , mapping_size(std::exchange(other.mapping_size, 0))
+        , buffer(std::move(other.buffer))
+        , contents(mapping != nullptr ? std::exchange(other.contents, {}) : std::span<const uint8_t>(buffer))
+    {}
+    MappedFile& operator=(MappedFile&&) = delete;
+
+    ~MappedFile()
+    {
+#ifndef __wasm__
+        if (mapping != nullptr) {
+            munmap(mapping, mapping_size);
+        }
+#endif
+    }
+
+    const uint8_t* data() const { return contents.data(); }
+    size_t size() const { return contents.size(); }
+    bool empty() const { return contents.empty(); }
+    std::span<const uint8_t> span() const { return contents; }
+    const uint8_t& operator[](size_t i) const { return contents[i]; }
+
+  private:
+    void read_into_buffer(int fd, size_t bytes)
+    {
+        buffer = read_fd(fd);
+        if (bytes != 0 && bytes < buffer.size()) {
+            buffer.resize(bytes);
+        }
+        contents = buffer;
+    }
+
+    void* mapping = nullptr;
+    size_t mapping_size = 0;
+    std::vector<uint8_t> buffer;
+    std::span<const uint8_t> contents;
+};
+
 inline std::vector<uint8_t> read_file(const std::string& filename, size_t bytes = 0)
 {
-    // Standard input. We'll iterate over the stream and reallocate.
+    // Standard input. We'll read it in blocks, as its size is unknown.
     if (filename == "-") {
-        return { (std::istreambuf_iterator<char>(std::cin)), std::istreambuf_iterator<char>() };
+        return read_fd(STDIN_FILENO);
+    }
+
+    // Pipe or process substitution. Same as above.
+    struct stat st;
+    if (stat(filename.c_str(), &st) == 0 && !S_ISREG(st.st_mode)) {
+        const int fd = open(filename.c_str(), O_RDONLY);
+        if (fd == -1) {
+            THROW std::runtime_error("Unable to open file: " + filename);
+        }
+        auto data = read_fd(fd);
+        close(fd);
+        return data;
     }
 
     std::ifstream file(filename, std::ios::binary);
@@ -36,13 +158,8 @@ inline std::vector<uint8_t> read_file(const std::string& filename, size_t bytes
         THROW std::runtime_error("Unable to open file: " + filename);
     }
 
-    // Unseekable, pipe or process substitution. We'll iterate over the stream and reallocate.
-    if (!file.seekg(0, std::ios::end)) {
-        file.clear();
-        return { (std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>() };
-    }
-
     // Get the file size.
+    file.seekg(0, std::ios::end);
     auto size = static_cast<size_t>(file.tellg());
     file.seekg(0, std::ios::beg);
 
@@ -20,12 +20,16 @@
 #include "barretenberg/api/gate_count.hpp"
 #include "barretenberg/api/prove_tube.hpp"
 #include "barretenberg/bb/cli11_formatter.hpp"
+#include "barretenberg/bb/serve.hpp"
 #include "barretenberg/common/thread.hpp"
 #include "barretenberg/flavor/ultra_rollup_flavor.hpp"
 #include "barretenberg/honk/types/aggregation_object_type.hpp"
 #include "barretenberg/srs/factories/native_crs_factory.hpp"
 #include "barretenberg/srs/global_crs.hpp"
 
+#include <algorithm>
+#include <optional>
+
 namespace bb {
 // This is updated in-place by bootstrap.sh during the release process. This prevents
 // the version string from needing to be present at build-time, simplifying e.g. caching.
@@ -175,12 +179,16 @@ int parse_and_run_cli_command(int argc, char* argv[])
             ->check(CLI::IsMember({ "client_ivc", "avm", "ultra_honk" }).name("is_member"));
     };
 
+    std::vector<CLI::Option*> crs_path_options;
     const auto add_crs_path_option = [&](CLI::App* subcommand) {
-        return subcommand
-            ->add_option("--crs_path, -c",
-                         flags.crs_path,
-                         "Path CRS directory. Missing CRS files will be retrieved from the internet.")
-            ->check(CLI::ExistingDirectory);
+        CLI::Option* option =
+            subcommand
+                ->add_option("--crs_path, -c",
+                             flags.crs_path,
+                             "Path CRS directory. Missing CRS files will be retrieved from the internet.")
+                ->check(CLI::ExistingDirectory);
+        crs_path_options.push_back(option);
+        return option;
     };
 
     const auto add_oracle_hash_option = [&](CLI::App* subcommand) {
@@ -414,6 +422,37 @@ int parse_and_run_cli_command(int argc, char* argv[])
     remove_zk_option(write_solidity_verifier);
     add_crs_path_option(write_solidity_verifier);
 
+    /***************************************************************************************************************
+     * Subcommand: serve
+     ***************************************************************************************************************/
+    CLI::App* serve_command =
+        app.add_subcommand("serve",
+                           "Run as a long-lived prover process. The CRS and lookup tables are loaded once, and then "
+                           "prove, verify, write_vk (or any other command) requests are read "
+                           "as length-prefixed msgpack messages from stdin, or from clients of a Unix socket. Each "
+                           "request carries the arguments of the equivalent bb command.");
+    ServeOptions serve_options{ .max_memory_mb = 0, .default_request_memory_mb = 2048, .warm_log_circuit_size = 20 };
+    add_verbose_flag(serve_command);
+    add_debug_flag(serve_command);
+    add_crs_path_option(serve_command);
+    serve_command->add_option(
+        "--socket", serve_options.socket_path, "Listen on this Unix socket instead of reading stdin.");
+    serve_command->add_option("--max_memory_mb",
+                              serve_options.max_memory_mb,
+                              "Reject requests estimated to need more memory. Defaults to the physical memory.");
+    serve_command->add_option("--request_memory_mb",
+                              serve_options.default_request_memory_mb,
+                              "Memory estimate of requests that do not provide their own.");
+    serve_command->add_option("--warm_log_circuit_size",
+                              serve_options.warm_log_circuit_size,
+                              "Load the CRS up front for circuits of up to 2^n gates.");
+    serve_command->add_option("--max_connections",
+                              serve_options.max_connections,
+                              "Number of socket clients served at once; further clients wait until one disconnects.");
+    serve_command->add_option("--max_waiting_requests",
+                              serve_options.max_waiting_requests,
+                              "Number of requests waiting for the running one; further requests are rejected.");
+
     /***************************************************************************************************************
      * Subcommand: OLD_API
      ***************************************************************************************************************/
@@ -569,6 +608,23 @@ int parse_and_run_cli_command(int argc, char* argv[])
      ***************************************************************************************************************/
 
     CLI11_PARSE(app, argc, argv);
+    // The global CRS factory is initialized once per process. When a process runs several commands (bb serve), the
+    // later ones use the CRS of the first, so reject a command that asks for another one rather than ignoring its path.
+    static std::optional<std::filesystem::path> process_crs_path;
+    if (!process_crs_path) {
+        process_crs_path = flags.crs_path;
+    } else if (std::any_of(crs_path_options.begin(), crs_path_options.end(), [](const CLI::Option* option) {
+                   return option->count() > 0;
+               })) {
+        std::error_code ec;
+        if (std::filesystem::weakly_canonical(flags.crs_path, ec) !=
+            std::filesystem::weakly_canonical(*process_crs_path, ec)) {
+            throw_or_abort("--crs_path " + flags.crs_path.string() + " differs from the CRS path " +
+                           process_crs_path->string() + " this process was started with");
+        }
+    } else {
+        flags.crs_path = *process_crs_path;
+    }
     // Immediately after parsing, we can init the global CRS factory. Note this does not yet read or download any
     // points; that is done on-demand.
     srs::init_net_crs_factory(flags.crs_path);
@@ -616,6 +672,10 @@ int parse_and_run_cli_command(int argc, char* argv[])
     };
 
     try {
+        // SERVE
+        if (serve_command->parsed()) {
+            return serve(serve_options);
+        }
         // TUBE
         if (prove_tube_command->parsed()) {
             // TODO(https://github.com/AztecProtocol/barretenberg/issues/1201): Potentially remove this extra logic.
@@ -0,0 +1,364 @@
+#include "barretenberg/bb/serve.hpp"
+#include "barretenberg/bb/cli.hpp"
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/constants.hpp"
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "barretenberg/serialize/msgpack_impl.hpp"
+#include "barretenberg/srs/global_crs.hpp"
+#include "barretenberg/stdlib_circuit_builders/plookup_tables/plookup_tables.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <limits>
+#include <mutex>
+#include <optional>
+
+#ifndef __wasm__
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <thread>
+#include <unistd.h>
+#endif
+
+namespace bb {
+
+namespace {
+
+// Upper bound on the size of a single message, to fail early on garbage input
+constexpr uint32_t MAX_MESSAGE_SIZE = 1U << 26;
+
+/**
+ * @brief Admits requests one at a time, in the order in which they arrive
+ * @details Requests share the process-wide state of the provers (the CRS factories and the logging flags) and each of
+ * them already uses all cores, so they are run one after the other. A bounded number of requests wait for their turn;
+ * further requests are turned away straight away rather than piling up.
+ */
+class RequestQueue {
+  public:
+    explicit RequestQueue(size_t max_waiting)
+        : max_waiting(max_waiting)
+    {}
+
+    // Blocks until it is the caller's turn. Returns false without waiting if max_waiting requests are waiting already.
+    bool enter()
+    {
+        std::unique_lock lock(mutex);
+        if (next_ticket - now_serving > max_waiting) {
+            return false;
+        }
+        const uint64_t ticket = next_ticket++;
+        turn.wait(lock, [&]() { return ticket == now_serving; });
+        return true;
+    }
+
+    // Lets the next request in
+    void leave()
+    {
+        {
+            std::lock_guard lock(mutex);
+            ++now_serving;
+        }
+        turn.notify_all();
+    }
+
+  private:
+    std::mutex mutex;
+    std::condition_variable turn;
+    size_t max_waiting;
+    // Tickets are handed out on arrival; the request holding now_serving is running (or about to)
+    uint64_t next_ticket = 0;
+    uint64_t now_serving = 0;
+};
+
+struct ServeState {
+    RequestQueue queue;
+    uint64_t max_request_memory_mb;
+    uint64_t default_request_memory_mb;
+};
+
+#ifndef __wasm__
+bool read_exact(int fd, uint8_t* data, size_t size)
+{
+    while (size > 0) {
+        const ssize_t n = ::read(fd, data, size);
+        if (n <= 0) {
+            return false;
+        }
+        data += n;
+        size -= static_cast<size_t>(n);
+    }
+    return true;
+}
+
+bool write_exact(int fd, const uint8_t* data, size_t size)
+{
+    while (size > 0) {
+        const ssize_t n = ::write(fd, data, size);
+        if (n <= 0) {
+            return false;
+        }
+        data += n;
+        size -= static_cast<size_t>(n);
+    }
+    return true;
+}
+
+std::optional<std::vector<uint8_t>> read_message(int fd)
+{
+    std::array<uint8_t, 4> header{};
+    if (!read_exact(fd, header.data(), header.size())) {
+        return std::nullopt;
+    }
+    const uint32_t size = (static_cast<uint32_t>(header[0]) << 24) | (static_cast<uint32_t>(header[1]) << 16) |
+                          (static_cast<uint32_t>(header[2]) << 8) | static_cast<uint32_t>(header[3]);
+    if (size > MAX_MESSAGE_SIZE) {
+        info("serve: message of ", size, " bytes is too large");
+        return std::nullopt;
+    }
+    std::vector<uint8_t> message(size);
+    if (!read_exact(fd, message.data(), message.size())) {
+        return std::nullopt;
+    }
+    return message;
+}
+
+bool write_message(int fd, const msgpack::sbuffer& message)
+{
+    const auto size = static_cast<uint32_t>(message.size());
+    const std::array<uint8_t, 4> header{ static_cast<uint8_t>(size >> 24),
+                                         static_cast<uint8_t>(size >> 16),
+                                         static_cast<uint8_t>(size >> 8),
+                                         static_cast<uint8_t>(size) };
+    return write_exact(fd, header.data(), header.size()) &&
+           write_exact(fd, reinterpret_cast<const uint8_t*>(message.data()), message.size());
+}
+
+ServeResponse admit_and_handle(ServeState& state, const std::vector<uint8_t>& message)
+{
+    ServeRequest request;
+    try {
+        msgpack::unpack(reinterpret_cast<const char*>(message.data()), message.size()).get().convert(request);
+    } catch (const std::exception& e) {
+        return { .status = 1, .error = std::string("could not decode request: ") + e.what() };
+    }
+
+    const uint64_t memory_mb = request.memory_mb != 0 ? request.memory_mb : state.default_request_memory_mb;
+    if (memory_mb > state.max_request_memory_mb) {
+        return { .status = 1,
+                 .error = "request needs " + std::to_string(memory_mb) + "MB, more than the memory budget of " +
+                          std::to_string(state.max_request_memory_mb) + "MB" };
+    }
+
+    const auto arrival = std::chrono::steady_clock::now();
+    if (!state.queue.enter()) {
+        return { .status = 1, .error = "server busy: too many requests waiting" };
+    }
+    struct Turn {
+        RequestQueue& queue;
+        ~Turn() { queue.leave(); }
+    } turn{ state.queue };
+    const auto admitted = std::chrono::steady_clock::now();
+
+    ServeResponse response = handle_serve_request(request);
+    response.wait_ms = std::chrono::duration<double, std::milli>(admitted - arrival).count();
+    return response;
+}
+
+// Answers the requests of one client (or of stdin), in order, until it disconnects
+void serve_connection(ServeState& state, int in_fd, int out_fd)
+{
+    while (auto message = read_message(in_fd)) {
+        const ServeResponse response = admit_and_handle(state, *message);
+        msgpack::sbuffer buffer;
+        msgpack::pack(buffer, response);
+        if (!write_message(out_fd, buffer)) {
+            break;
+        }
+    }
+}
+
+int listen_on_socket(const std::filesystem::path& socket_path)
+{
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (socket_path.string().size() >= sizeof(address.sun_path)) {
+        throw_or_abort("serve: socket path is too long: " + socket_path.string());
+    }
+    std::strncpy(address.sun_path, socket_path.c_str(), sizeof(address.sun_path) - 1);
+
+    // Only ever replace a stale socket, never a file that happens to be at a mistyped path
+    std::error_code ec;
+    const auto status = std::filesystem::symlink_status(socket_path, ec);
+    if (std::filesystem::is_socket(status)) {
+        std::filesystem::remove(socket_path, ec);
+    } else if (std::filesystem::exists(status)) {
+        throw_or_abort("serve: " + socket_path.string() + " exists and is not a socket");
+    }
+
+    const int listen_fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listen_fd < 0) {
+        throw_or_abort("serve: could not create socket");
+    }
+    if (::bind(listen_fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+        ::listen(listen_fd, SOMAXCONN) != 0) {
+        ::close(listen_fd);
+        throw_or_abort("serve: could not listen on " + socket_path.string());
+    }
+    return listen_fd;
+}
+
+// Accepts and serves clients one after the other, until the listening socket fails
+void accept_clients(ServeState& state, int listen_fd)
+{
+    while (true) {
+        const int fd = ::accept(listen_fd, nullptr, nullptr);
+        if (fd < 0) {
+            if (errno == EINTR || errno == ECONNABORTED) {
+                continue;
+            }
+            if (errno == EMFILE || errno == ENFILE || errno == ENOBUFS || errno == ENOMEM) {
+                // Out of resources for now, the pending client stays in the backlog
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                continue;
+            }
+            info("serve: could not accept clients: ", std::strerror(errno));
+            return;
+        }
+        serve_connection(state, fd, fd);
+        ::close(fd);
+    }
+}
+
+int serve_socket(ServeState& state, int listen_fd, const std::filesystem::path& socket_path, size_t max_connections)
+{
+    info("serve: listening on ", socket_path.string(), " for up to ", max_connections, " clients at once");
+#ifndef NO_MULTITHREADING
+    // A fixed set of workers, each serving one client at a time
+    std::vector<std::thread> workers;
+    workers.reserve(max_connections);
+    for (size_t i = 0; i < std::max<size_t>(max_connections, 1); ++i) {
+        workers.emplace_back([&state, listen_fd]() { accept_clients(state, listen_fd); });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+#else
+    accept_clients(state, listen_fd);
+#endif
+    ::close(listen_fd);
+    std::error_code ec;
+    std::filesystem::remove(socket_path, ec);
+    return 1;
+}
+
+int serve_stdin(ServeState& state)
+{
+    // Responses get the real stdout to themselves. Whatever the commands print to stdout goes to stderr instead.
+    const int response_fd = ::dup(STDOUT_FILENO);
+    ::dup2(STDERR_FILENO, STDOUT_FILENO);
+    serve_connection(state, STDIN_FILENO, response_fd);
+    ::close(response_fd);
+    return 0;
+}
+
+uint64_t physical_memory_mb()
+{
+    const long pages = ::sysconf(_SC_PHYS_PAGES);
+    const long page_size = ::sysconf(_SC_PAGE_SIZE);
+    if (pages <= 0 || page_size <= 0) {
+        return 0;
+    }
+    return (static_cast<uint64_t>(pages) * static_cast<uint64_t>(page_size)) >> 20;
+}
+#endif
+
+} // namespace
+
+void serve_warm_up(size_t log_circuit_size)
+{
+    // The CRS factories keep the points they have loaded (along with their pippenger point tables) for the lifetime of
+    // the process, and the commitment keys constructed by the provers take them from there. A commitment key for 2^k
+    // points asks for 2^k + 1 of them.
+    srs::get_crs_factory<curve::BN254>()->get_crs((static_cast<size_t>(1) << log_circuit_size) + 1);
+    srs::get_crs_factory<curve::Grumpkin>()->get_crs((static_cast<size_t>(1) << CONST_ECCVM_LOG_N) + 1);
+    // Multitables are constructed on first use, so construct all of them here
+    for (size_t id = 0; id < plookup::MultiTableId::NUM_MULTI_TABLES; ++id) {
+        plookup::get_multitable(static_cast<plookup::MultiTableId>(id));
+    }
+}
+
+ServeResponse handle_serve_request(const ServeRequest& request)
+{
+    if (request.args.empty()) {
+        return { .status = 1, .error = "empty request" };
+    }
+    if (request.args[0] == "serve") {
+        return { .status = 1, .error = "serve can not be requested from a running server" };
+    }
+
+    std::vector<std::string> args{ "bb" };
+    args.insert(args.end(), request.args.begin(), request.args.end());
+    std::vector<char*> argv(args.size());
+    for (size_t i = 0; i < args.size(); ++i) {
+        // NOLINTNEXTLINE
+        argv[i] = const_cast<char*>(args[i].c_str());
+    }
+
+    // The logging flags of a request must not carry over to the next one
+    const bool server_verbose_logging = verbose_logging;
+    const bool server_debug_logging = debug_logging;
+
+    ServeResponse response;
+    const auto start = std::chrono::steady_clock::now();
+    try {
+        response.status = parse_and_run_cli_command(static_cast<int>(argv.size()), argv.data());
+    } catch (const std::exception& e) {
+        response.status = 1;
+        response.error = e.what();
+    }
+    response.time_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    verbose_logging = server_verbose_logging;
+    debug_logging = server_debug_logging;
+    vinfo("serve: ", request.args[0], " finished with status ", response.status, " in ", response.time_ms, "ms");
+    return response;
+}
+
+int serve([[maybe_unused]] const ServeOptions& options)
+{
+#ifdef __wasm__
+    throw_or_abort("bb serve is not supported in wasm.");
+    return 1;
+#else
+    // Fail on a bad socket path before spending time on the warm-up. Clients connecting meanwhile wait in the backlog.
+    const int listen_fd = options.socket_path.empty() ? -1 : listen_on_socket(options.socket_path);
+    const uint64_t max_memory_mb = options.max_memory_mb != 0 ? options.max_memory_mb : physical_memory_mb();
+    ServeState state{ .queue = RequestQueue(options.max_waiting_requests),
+                      .max_request_memory_mb =
+                          max_memory_mb != 0 ? max_memory_mb : std::numeric_limits<uint64_t>::max(),
+                      .default_request_memory_mb = options.default_request_memory_mb };
+
+    const auto start = std::chrono::steady_clock::now();
+    serve_warm_up(options.warm_log_circuit_size);
+    info("serve: warmed up for circuits of up to 2^",
+         options.warm_log_circuit_size,
+         " gates in ",
+         std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count(),
+         "ms, memory budget ",
+         max_memory_mb,
+         "MB");
+
+    if (options.socket_path.empty()) {
+        return serve_stdin(state);
+    }
+    return serve_socket(state, listen_fd, options.socket_path, options.max_connections);
+#endif
+}
+
+} // namespace bb
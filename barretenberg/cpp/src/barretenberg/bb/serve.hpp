@@ -0,0 +1,78 @@
+#pragma once
+#include "barretenberg/serialize/msgpack.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace bb {
+
+/**
+ * @brief A request to a running `bb serve` process.
+ * @details The arguments are those of a regular bb invocation without the program name, e.g.
+ * { "prove", "-b", "./target/program.json", "-w", "./target/witness.gz", "-o", "./out" }. They are parsed with exactly
+ * the same options as the command line.
+ */
+struct ServeRequest {
+    std::vector<std::string> args;
+    // Estimated peak memory of the request, checked against the server's budget. 0 means the server's default estimate.
+    uint64_t memory_mb = 0;
+    MSGPACK_FIELDS(args, memory_mb);
+};
+
+struct ServeResponse {
+    // The exit code the equivalent bb invocation would have returned
+    int32_t status = 0;
+    std::string error;
+    // Time spent running the command
+    double time_ms = 0;
+    // Time spent waiting for the requests ahead of it
+    double wait_ms = 0;
+    MSGPACK_FIELDS(status, error, time_ms, wait_ms);
+};
+
+struct ServeOptions {
+    // If empty, requests are read from stdin and responses written to stdout. Otherwise listen on this Unix socket.
+    std::filesystem::path socket_path;
+    // Requests whose memory estimate exceeds this budget are rejected. 0 means the physical memory of the machine.
+    uint64_t max_memory_mb = 0;
+    // Memory estimate of requests that do not provide one
+    uint64_t default_request_memory_mb = 0;
+    // The CRS and commitment keys are loaded up front for circuits of up to this (log) size
+    size_t warm_log_circuit_size = 0;
+    // Number of socket clients served at once. Further clients wait in the listen backlog until one disconnects.
+    size_t max_connections = 16;
+    // Number of requests that may wait for the running one to finish. Further requests are rejected.
+    size_t max_waiting_requests = 16;
+};
+
+/**
+ * @brief Load the CRS points and lookup tables once, so that requests do not pay for them.
+ * @details The global CRS factory must already be initialized. The warm state lives until the process exits.
+ */
+void serve_warm_up(size_t log_circuit_size);
+
+/**
+ * @brief Run a single request in-process, as if `bb <args>` had been invoked.
+ * @details The logging flags are restored afterwards. The CRS is the one of the first command run by the process, so a
+ * request with a different --crs_path fails (see parse_and_run_cli_command).
+ */
+ServeResponse handle_serve_request(const ServeRequest& request);
+
+/**
+ * @brief Serve requests until stdin is closed (or, when listening on a socket, until the socket can no longer accept
+ * clients).
+ * @details Messages in both directions are framed as a 4-byte big-endian length followed by the msgpack encoding of a
+ * ServeRequest or ServeResponse. Requests are answered in order on each connection. An existing socket at the socket
+ * path (e.g. left behind by a previous server) is replaced, but any other kind of file there is an error.
+ *
+ * The provers share process-wide state (the CRS factories and the logging flags), and every request already uses all
+ * cores, so requests run one at a time, in the order in which they arrive. Up to max_waiting_requests requests wait
+ * for their turn; further requests, and requests whose memory estimate exceeds max_memory_mb, are rejected straight
+ * away (with status 1 and an error).
+ */
+int serve(const ServeOptions& options);
+
+} // namespace bb
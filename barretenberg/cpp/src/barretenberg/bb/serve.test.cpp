@@ -0,0 +1,107 @@
+#include "barretenberg/bb/serve.hpp"
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/serialize/msgpack_impl.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+
+using namespace bb;
+
+namespace {
+
+// Sends the request through the same msgpack encoding a client uses and decodes the response the same way
+ServeResponse round_trip(const ServeRequest& request)
+{
+    msgpack::sbuffer request_buffer;
+    msgpack::pack(request_buffer, request);
+    ServeRequest decoded_request;
+    msgpack::unpack(request_buffer.data(), request_buffer.size()).get().convert(decoded_request);
+    EXPECT_EQ(decoded_request.args, request.args);
+    EXPECT_EQ(decoded_request.memory_mb, request.memory_mb);
+
+    const ServeResponse response = handle_serve_request(decoded_request);
+    msgpack::sbuffer response_buffer;
+    msgpack::pack(response_buffer, response);
+    ServeResponse decoded_response;
+    msgpack::unpack(response_buffer.data(), response_buffer.size()).get().convert(decoded_response);
+    EXPECT_EQ(decoded_response.status, response.status);
+    EXPECT_EQ(decoded_response.error, response.error);
+    EXPECT_EQ(decoded_response.time_ms, response.time_ms);
+    EXPECT_EQ(decoded_response.wait_ms, response.wait_ms);
+    return decoded_response;
+}
+
+} // namespace
+
+TEST(Serve, RequestRoundTrip)
+{
+    const ServeResponse response = round_trip({ .args = { "--version" }, .memory_mb = 64 });
+    EXPECT_EQ(response.status, 0);
+    EXPECT_TRUE(response.error.empty());
+    EXPECT_GE(response.time_ms, 0);
+}
+
+TEST(Serve, UnknownCommandFails)
+{
+    EXPECT_NE(round_trip({ .args = { "not_a_command" } }).status, 0);
+}
+
+TEST(Serve, RejectsEmptyAndNestedServeRequests)
+{
+    for (const ServeRequest& request : { ServeRequest{}, ServeRequest{ .args = { "serve" } } }) {
+        const ServeResponse response = round_trip(request);
+        EXPECT_EQ(response.status, 1);
+        EXPECT_FALSE(response.error.empty());
+    }
+}
+
+// The logging flags of one request do not carry over to later requests
+TEST(Serve, RestoresLoggingFlags)
+{
+    const bool saved_verbose_logging = verbose_logging;
+    const bool saved_debug_logging = debug_logging;
+    verbose_logging = false;
+    debug_logging = false;
+
+    round_trip({ .args = { "verify", "-d", "-p", "does_not_exist" } });
+    EXPECT_FALSE(verbose_logging);
+    EXPECT_FALSE(debug_logging);
+
+    verbose_logging = saved_verbose_logging;
+    debug_logging = saved_debug_logging;
+}
+
+// The CRS is loaded once per process, a request can not switch to another one
+TEST(Serve, RejectsDifferentCrsPath)
+{
+    const auto first_crs_path = std::filesystem::temp_directory_path() / "bb_serve_test_crs_a";
+    const auto second_crs_path = std::filesystem::temp_directory_path() / "bb_serve_test_crs_b";
+    std::filesystem::create_directories(first_crs_path);
+    std::filesystem::create_directories(second_crs_path);
+
+    // Whichever CRS path the process started with, at most one of the two can match it
+    round_trip({ .args = { "verify", "-c", first_crs_path.string(), "-p", "does_not_exist" } });
+    const ServeResponse response =
+        round_trip({ .args = { "verify", "-c", second_crs_path.string(), "-p", "does_not_exist" } });
+    EXPECT_EQ(response.status, 1);
+    EXPECT_NE(response.error.find("--crs_path"), std::string::npos);
+
+    std::filesystem::remove(first_crs_path);
+    std::filesystem::remove(second_crs_path);
+}
+
+#ifndef __wasm__
+// A socket path that names an ordinary file is a mistake, the file must be left alone
+TEST(Serve, DoesNotReplaceFileAtSocketPath)
+{
+    const auto path = std::filesystem::temp_directory_path() / "bb_serve_test_not_a_socket";
+    {
+        std::ofstream file(path);
+        file << "not a socket";
+    }
+    EXPECT_THROW(serve({ .socket_path = path }), std::runtime_error);
+    EXPECT_TRUE(std::filesystem::is_regular_file(path));
+    std::filesystem::remove(path);
+}
+#endif
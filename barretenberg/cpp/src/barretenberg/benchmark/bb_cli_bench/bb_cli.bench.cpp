@@ -6,9 +6,11 @@
 #include <vector>
 
 #include "barretenberg/bb/cli.hpp"
+#include "barretenberg/bb/serve.hpp"
 #include "barretenberg/common/op_count_google_bench.hpp"
 #include "barretenberg/common/std_string.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/srs/global_crs.hpp"
 
 namespace {
 // This is used to suppress the default output of Google Benchmark.
@@ -26,17 +28,20 @@ class ConsoleNoOutputReporter : public benchmark::BenchmarkReporter {
     void Finalize() override {}
 };
 
-// Benches the bb cli/main.cpp functionality by parsing MAIN_ARGS.
-void benchmark_bb_cli(benchmark::State& state)
+// Reads the space-delimited arguments of the bb command to bench from MAIN_ARGS.
+std::vector<std::string> get_main_args()
 {
-    // Get MAIN_ARGS from environment
     const char* main_args_env = std::getenv("MAIN_ARGS");
     if (main_args_env == nullptr) {
         throw_or_abort("Environment variable MAIN_ARGS must be set");
     }
+    return bb::detail::split(main_args_env, ' ');
+}
 
-    // Parse the space-delimited arguments
-    std::vector<std::string> args = bb::detail::split(main_args_env, ' ');
+// Benches the bb cli/main.cpp functionality by parsing MAIN_ARGS.
+void benchmark_bb_cli(benchmark::State& state)
+{
+    std::vector<std::string> args = get_main_args();
 
     // Add the program name to the arguments
     args.insert(args.begin(), "bb");
@@ -67,6 +72,24 @@ void benchmark_bb_cli(benchmark::State& state)
 
 BENCHMARK(benchmark_bb_cli)->Iterations(1)->Unit(benchmark::kMillisecond);
 
+// Benches the latency of MAIN_ARGS as a request to a warm `bb serve` process, i.e., with the CRS, commitment keys and
+// lookup tables already loaded. Only registered when SERVE_ITERATIONS is set.
+void benchmark_bb_serve_request(benchmark::State& state)
+{
+    bb::ServeRequest request{ .args = get_main_args() };
+    bb::srs::init_net_crs_factory(bb::srs::bb_crs_path());
+    const char* warm_log_size_env = std::getenv("SERVE_WARM_LOG_CIRCUIT_SIZE");
+    bb::serve_warm_up(warm_log_size_env != nullptr ? std::stoul(warm_log_size_env) : 20);
+
+    for (auto _ : state) {
+        BB_REPORT_OP_COUNT_IN_BENCH(state);
+        const bb::ServeResponse response = bb::handle_serve_request(request);
+        if (response.status != 0) {
+            exit(response.status);
+        }
+    }
+}
+
 } // namespace
 
 int main(int argc, char** argv)
@@ -75,6 +98,11 @@ int main(int argc, char** argv)
     if (::benchmark ::ReportUnrecognizedArguments(argc, argv)) {
         return 1;
     }
+    if (const char* serve_iterations = std::getenv("SERVE_ITERATIONS"); serve_iterations != nullptr) {
+        ::benchmark::RegisterBenchmark("benchmark_bb_serve_request", benchmark_bb_serve_request)
+            ->Iterations(static_cast<benchmark::IterationCount>(std::stoul(serve_iterations)))
+            ->Unit(benchmark::kMillisecond);
+    }
     auto report = std::make_unique<ConsoleNoOutputReporter>();
     ::benchmark ::RunSpecifiedBenchmarks(report.get());
     ::benchmark ::Shutdown();
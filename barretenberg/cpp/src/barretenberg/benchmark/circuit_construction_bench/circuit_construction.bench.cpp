@@ -1,9 +1,12 @@
 
 #include <benchmark/benchmark.h>
 
+#include "barretenberg/circuit_checker/circuit_checker.hpp"
 #include "barretenberg/stdlib/primitives/biggroup/biggroup.hpp"
 #include "barretenberg/stdlib/primitives/curves/bn254.hpp"
+#include "barretenberg/stdlib_circuit_builders/mock_circuits.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_circuit_builder.hpp"
+#include "barretenberg/ultra_honk/decider_proving_key.hpp"
 
 using namespace benchmark;
 using namespace bb;
@@ -40,7 +43,60 @@ void biggroup_construction_bench(State& state)
         state.PauseTiming();
     }
 }
+
+// Construct the proving key of a circuit, which includes building the copy cycles and the sigma/id polynomials
+void proving_key_construction_bench(State& state)
+{
+    using Flavor = UltraFlavor;
+    bb::srs::init_file_crs_factory(bb::srs::bb_crs_path());
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        UltraCircuitBuilder builder;
+        MockCircuits::construct_arithmetic_circuit(builder, static_cast<size_t>(state.range(0)));
+        state.ResumeTiming();
+        auto proving_key = std::make_shared<DeciderProvingKey_<Flavor>>(builder);
+        DoNotOptimize(proving_key);
+        state.PauseTiming();
+        proving_key.reset();
+        state.ResumeTiming();
+    }
+}
+
+// Construct and finalize a circuit mixing arithmetic gates, range constraints, lookups and constants
+void ultra_circuit_construction_bench(State& state)
+{
+    const size_t num_gates = 1UL << state.range(0);
+    for (auto _ : state) {
+        UltraCircuitBuilder builder;
+        MockCircuits::add_arithmetic_gates(builder, num_gates);
+        MockCircuits::add_lookup_gates(builder, /*num_iterations=*/num_gates / 64);
+        for (size_t i = 0; i < num_gates / 16; ++i) {
+            const uint32_t witness = builder.add_variable(fr(i & 0xffff));
+            builder.create_range_constraint(witness, /*num_bits=*/16 + (i % 16), "");
+            builder.put_constant_variable(fr(i));
+        }
+        builder.finalize_circuit(/*ensure_nonzero=*/true);
+        DoNotOptimize(builder);
+    }
+}
+
+// Check the witness of a circuit containing arithmetic and lookup gates against all of its relations
+void circuit_checker_bench(State& state)
+{
+    UltraCircuitBuilder builder;
+    MockCircuits::construct_arithmetic_circuit(builder, static_cast<size_t>(state.range(0)));
+    MockCircuits::add_lookup_gates(builder, /*num_iterations=*/1UL << (state.range(0) - 10));
+
+    for (auto _ : state) {
+        bool result = CircuitChecker::check(builder);
+        DoNotOptimize(result);
+    }
+}
 } // namespace
 BENCHMARK(biggroup_construction_bench)->Unit(kMicrosecond)->DenseRange(2, 20);
+BENCHMARK(proving_key_construction_bench)->Unit(kMillisecond)->DenseRange(14, 20, 2);
+BENCHMARK(ultra_circuit_construction_bench)->Unit(kMillisecond)->DenseRange(14, 20, 2);
+BENCHMARK(circuit_checker_bench)->Unit(kMillisecond)->DenseRange(14, 20, 2);
 
 BENCHMARK_MAIN();
@@ -67,6 +67,25 @@ BENCHMARK_DEFINE_F(ClientIVCBench, Full)(benchmark::State& state)
         ivc.prove();
     }
 }
+/**
+ * @brief Benchmark the prover work for the full PG-Goblin IVC protocol, folding each circuit in the background while
+ * the next one is constructed
+ */
+BENCHMARK_DEFINE_F(ClientIVCBench, FullPipelined)(benchmark::State& state)
+{
+    ClientIVC ivc{ { AZTEC_TRACE_STRUCTURE } };
+    ivc.pipelined_accumulation = true;
+
+    auto total_num_circuits = 2 * static_cast<size_t>(state.range(0)); // 2x accounts for kernel circuits
+    auto mocked_vkeys = mock_verification_keys(total_num_circuits);
+
+    for (auto _ : state) {
+        BB_REPORT_OP_COUNT_IN_BENCH(state);
+        perform_ivc_accumulation_rounds(total_num_circuits, ivc, mocked_vkeys, /* mock_vk */ true);
+        ivc.prove();
+    }
+}
+
 /**
  * @brief Benchmark the prover work for the full PG-Goblin IVC protocol
  * @details Processes "dense" circuits of size 2^17 in a size 2^20 structured trace
@@ -89,6 +108,7 @@ BENCHMARK_DEFINE_F(ClientIVCBench, Ambient_17_in_20)(benchmark::State& state)
 #define ARGS Arg(ClientIVCBench::NUM_ITERATIONS_MEDIUM_COMPLEXITY)->Arg(2)
 
 BENCHMARK_REGISTER_F(ClientIVCBench, Full)->Unit(benchmark::kMillisecond)->ARGS;
+BENCHMARK_REGISTER_F(ClientIVCBench, FullPipelined)->Unit(benchmark::kMillisecond)->Arg(2)->Arg(4)->Arg(6);
 BENCHMARK_REGISTER_F(ClientIVCBench, Ambient_17_in_20)->Unit(benchmark::kMillisecond)->ARGS;
 BENCHMARK_REGISTER_F(ClientIVCBench, VerificationOnly)->Unit(benchmark::kMillisecond);
 
@@ -0,0 +1,69 @@
+#include "barretenberg/crypto/ecdsa/ecdsa.hpp"
+#include <benchmark/benchmark.h>
+
+using namespace benchmark;
+using namespace bb;
+using namespace bb::crypto;
+
+namespace {
+template <typename Fq, typename Fr, typename G1> struct SignedMessages {
+    std::vector<std::string> messages;
+    std::vector<typename G1::affine_element> public_keys;
+    std::vector<ecdsa_signature> signatures;
+
+    explicit SignedMessages(size_t num_signatures)
+    {
+        for (size_t i = 0; i < num_signatures; ++i) {
+            ecdsa_key_pair<Fr, G1> account;
+            account.private_key = Fr::random_element();
+            account.public_key = G1::one * account.private_key;
+            messages.push_back("message number " + std::to_string(i));
+            public_keys.push_back(account.public_key);
+            signatures.push_back(ecdsa_construct_signature<Sha256Hasher, Fq, Fr, G1>(messages.back(), account));
+        }
+    }
+};
+
+// Verifies each signature with ecdsa_verify_signature
+template <typename Fq, typename Fr, typename G1> void verify_sequential(State& state) noexcept
+{
+    SignedMessages<Fq, Fr, G1> inputs(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        for (size_t i = 0; i < inputs.signatures.size(); ++i) {
+            DoNotOptimize(ecdsa_verify_signature<Sha256Hasher, Fq, Fr, G1>(
+                inputs.messages[i], inputs.public_keys[i], inputs.signatures[i]));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+// Verifies all signatures with a single combined check
+template <typename Fq, typename Fr, typename G1> void verify_batch(State& state) noexcept
+{
+    SignedMessages<Fq, Fr, G1> inputs(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        DoNotOptimize(ecdsa_verify_signatures<Sha256Hasher, Fq, Fr, G1>(
+            inputs.messages, inputs.public_keys, inputs.signatures));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+} // namespace
+
+BENCHMARK(verify_sequential<secp256k1::fq, secp256k1::fr, secp256k1::g1>)
+    ->RangeMultiplier(4)
+    ->Range(1, 1024)
+    ->Unit(kMillisecond);
+BENCHMARK(verify_batch<secp256k1::fq, secp256k1::fr, secp256k1::g1>)
+    ->RangeMultiplier(4)
+    ->Range(1, 1024)
+    ->Unit(kMillisecond);
+BENCHMARK(verify_sequential<secp256r1::fq, secp256r1::fr, secp256r1::g1>)
+    ->RangeMultiplier(4)
+    ->Range(1, 1024)
+    ->Unit(kMillisecond);
+BENCHMARK(verify_batch<secp256r1::fq, secp256r1::fr, secp256r1::g1>)
+    ->RangeMultiplier(4)
+    ->Range(1, 1024)
+    ->Unit(kMillisecond);
+
+BENCHMARK_MAIN();
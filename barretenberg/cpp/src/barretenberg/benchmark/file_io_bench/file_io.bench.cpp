@@ -0,0 +1,97 @@
+#include "barretenberg/api/file_io.hpp"
+#include "barretenberg/client_ivc/private_execution_steps.hpp"
+#include "barretenberg/srs/factories/native_crs_factory.hpp"
+#include "barretenberg/srs/global_crs.hpp"
+#include <benchmark/benchmark.h>
+#include <cstdlib>
+#include <fstream>
+
+#if defined(__linux__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+using namespace benchmark;
+using namespace bb;
+
+namespace {
+
+// Current resident set size in MiB (Linux only, 0 elsewhere)
+double current_rss_mb()
+{
+#ifdef __linux__
+    std::ifstream statm("/proc/self/statm");
+    size_t total_pages = 0;
+    size_t resident_pages = 0;
+    if (statm >> total_pages >> resident_pages) {
+        return static_cast<double>(resident_pages * static_cast<size_t>(sysconf(_SC_PAGE_SIZE))) / (1 << 20);
+    }
+#endif
+    return 0;
+}
+
+// Peak resident set size of the process in MiB
+double peak_rss_mb()
+{
+#if defined(__linux__)
+    struct rusage usage {};
+    return getrusage(RUSAGE_SELF, &usage) == 0 ? static_cast<double>(usage.ru_maxrss) / (1 << 10) : 0;
+#elif defined(__APPLE__)
+    struct rusage usage {};
+    return getrusage(RUSAGE_SELF, &usage) == 0 ? static_cast<double>(usage.ru_maxrss) / (1 << 20) : 0;
+#else
+    return 0;
+#endif
+}
+
+/**
+ * @brief Load 2^n points of the BN254 CRS from ~/.bb-crs, as the native CRS factory does for every bb invocation.
+ * @details rss_mb is the resident memory that the loaded CRS accounts for.
+ */
+void load_bn254_crs(State& state)
+{
+    const size_t num_points = static_cast<size_t>(1) << static_cast<size_t>(state.range(0));
+    const auto crs_path = srs::bb_crs_path();
+    if (get_file_size(crs_path / "bn254_g1.dat") < num_points * sizeof(g1::affine_element)) {
+        state.SkipWithError("Not enough points in the local BN254 CRS");
+        return;
+    }
+    double rss_mb = 0;
+    for (auto _ : state) {
+        const double rss_before = current_rss_mb();
+        srs::factories::NativeBn254CrsFactory factory(crs_path, /*allow_download=*/false);
+        auto crs = factory.get_crs(num_points);
+        rss_mb = current_rss_mb() - rss_before;
+        DoNotOptimize(crs);
+    }
+    state.counters["rss_mb"] = rss_mb;
+    state.counters["peak_rss_mb"] = peak_rss_mb();
+}
+
+/**
+ * @brief Load and decompress the IVC witness stack at IVC_INPUTS_PATH, as `bb prove --scheme client_ivc` does.
+ */
+void load_ivc_inputs(State& state)
+{
+    const char* ivc_inputs_path = std::getenv("IVC_INPUTS_PATH");
+    if (ivc_inputs_path == nullptr) {
+        state.SkipWithError("IVC_INPUTS_PATH must be set to an ivc-inputs.msgpack file");
+        return;
+    }
+    double rss_mb = 0;
+    for (auto _ : state) {
+        const double rss_before = current_rss_mb();
+        auto steps = PrivateExecutionStepRaw::load_and_decompress(ivc_inputs_path);
+        rss_mb = current_rss_mb() - rss_before;
+        DoNotOptimize(steps);
+    }
+    state.counters["file_mb"] = static_cast<double>(get_file_size(ivc_inputs_path)) / (1 << 20);
+    state.counters["rss_mb"] = rss_mb;
+    state.counters["peak_rss_mb"] = peak_rss_mb();
+}
+
+} // namespace
+
+BENCHMARK(load_bn254_crs)->Unit(kMillisecond)->DenseRange(20, 23)->Iterations(1);
+BENCHMARK(load_ivc_inputs)->Unit(kMillisecond)->Iterations(1);
+
+BENCHMARK_MAIN();
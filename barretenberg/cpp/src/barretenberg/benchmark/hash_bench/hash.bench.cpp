@@ -0,0 +1,102 @@
+#include "barretenberg/crypto/blake2s/blake2s.hpp"
+#include "barretenberg/crypto/keccak/keccak.hpp"
+#include "barretenberg/crypto/sha256/sha256.hpp"
+#include <benchmark/benchmark.h>
+
+using namespace benchmark;
+using namespace bb;
+
+// Single-threaded throughput of the native hashes, one message at a time against the batch APIs. The bytes/second
+// column is the throughput per core.
+namespace {
+constexpr size_t NUM_MESSAGES = 64;
+
+std::vector<std::vector<uint8_t>> make_messages(size_t message_size)
+{
+    std::vector<std::vector<uint8_t>> messages(NUM_MESSAGES, std::vector<uint8_t>(message_size));
+    for (size_t i = 0; i < NUM_MESSAGES; ++i) {
+        for (size_t j = 0; j < message_size; ++j) {
+            messages[i][j] = static_cast<uint8_t>(i * 131 + j);
+        }
+    }
+    return messages;
+}
+
+void set_throughput(State& state, size_t bytes_per_iteration)
+{
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(bytes_per_iteration));
+}
+
+void sha256_sequential(State& state) noexcept
+{
+    const auto messages = make_messages(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        for (const auto& message : messages) {
+            DoNotOptimize(crypto::sha256(message));
+        }
+    }
+    set_throughput(state, NUM_MESSAGES * messages[0].size());
+}
+
+void sha256_many(State& state) noexcept
+{
+    const auto messages = make_messages(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        DoNotOptimize(crypto::sha256_many(messages));
+    }
+    set_throughput(state, NUM_MESSAGES * messages[0].size());
+}
+
+void blake2s_sequential(State& state) noexcept
+{
+    const auto messages = make_messages(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        for (const auto& message : messages) {
+            DoNotOptimize(crypto::blake2s(message));
+        }
+    }
+    set_throughput(state, NUM_MESSAGES * messages[0].size());
+}
+
+void blake2s_many(State& state) noexcept
+{
+    const auto messages = make_messages(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        DoNotOptimize(crypto::blake2s_many(messages));
+    }
+    set_throughput(state, NUM_MESSAGES * messages[0].size());
+}
+
+constexpr size_t KECCAK_STATE_BYTES = 25 * sizeof(uint64_t);
+
+void keccakf1600_sequential(State& state) noexcept
+{
+    std::vector<uint64_t> states(NUM_MESSAGES * 25, 0x0123456789abcdef);
+    for (auto _ : state) {
+        for (size_t i = 0; i < NUM_MESSAGES; ++i) {
+            ethash_keccakf1600(&states[i * 25]);
+        }
+        DoNotOptimize(states.data());
+    }
+    set_throughput(state, NUM_MESSAGES * KECCAK_STATE_BYTES);
+}
+
+void keccakf1600_many(State& state) noexcept
+{
+    std::vector<uint64_t> states(NUM_MESSAGES * 25, 0x0123456789abcdef);
+    for (auto _ : state) {
+        ethash_keccakf1600_many(states.data(), NUM_MESSAGES);
+        DoNotOptimize(states.data());
+    }
+    set_throughput(state, NUM_MESSAGES * KECCAK_STATE_BYTES);
+}
+} // namespace
+
+BENCHMARK(sha256_sequential)->Arg(32)->Arg(64)->Arg(1024);
+BENCHMARK(sha256_many)->Arg(32)->Arg(64)->Arg(1024);
+BENCHMARK(blake2s_sequential)->Arg(32)->Arg(64)->Arg(1024);
+BENCHMARK(blake2s_many)->Arg(32)->Arg(64)->Arg(1024);
+BENCHMARK(keccakf1600_sequential);
+BENCHMARK(keccakf1600_many);
+
+BENCHMARK_MAIN();
@@ -18,6 +18,11 @@ VerifierCommitmentKey<Curve> vk;
 std::vector<std::shared_ptr<NativeTranscript>> prover_transcripts(MAX_POLYNOMIAL_DEGREE_LOG2 -
                                                                   MIN_POLYNOMIAL_DEGREE_LOG2 + 1);
 std::vector<OpeningClaim<Curve>> opening_claims(MAX_POLYNOMIAL_DEGREE_LOG2 - MIN_POLYNOMIAL_DEGREE_LOG2 + 1);
+
+constexpr size_t BATCH_POLYNOMIAL_DEGREE_LOG2 = 14;
+constexpr size_t MAX_BATCH_SIZE = 64;
+std::vector<OpeningClaim<Curve>> batch_opening_claims;
+std::vector<HonkProof> batch_proofs;
 static void DoSetup(const benchmark::State&)
 {
     srs::init_file_crs_factory(srs::bb_crs_path());
@@ -66,6 +71,67 @@ void ipa_verify(State& state) noexcept
         ASSERT(result);
     }
 }
+
+static void DoBatchSetup(const benchmark::State& state)
+{
+    DoSetup(state);
+    if (!batch_proofs.empty()) {
+        return;
+    }
+    numeric::RNG& engine = numeric::get_debug_randomness();
+    const size_t n = 1 << BATCH_POLYNOMIAL_DEGREE_LOG2;
+    for (size_t i = 0; i < MAX_BATCH_SIZE; ++i) {
+        Polynomial poly(n);
+        for (size_t j = 0; j < n; ++j) {
+            poly.at(j) = Fr::random_element(&engine);
+        }
+        auto x = Fr::random_element(&engine);
+        const OpeningPair<Curve> opening_pair = { x, poly.evaluate(x) };
+        batch_opening_claims.push_back({ opening_pair, ck.commit(poly) });
+        auto prover_transcript = std::make_shared<NativeTranscript>();
+        IPA<Curve>::compute_opening_proof(ck, { poly, opening_pair }, prover_transcript);
+        batch_proofs.push_back(prover_transcript->export_proof());
+    }
+}
+
+std::vector<std::shared_ptr<NativeTranscript>> batch_verifier_transcripts(size_t batch_size)
+{
+    std::vector<std::shared_ptr<NativeTranscript>> transcripts;
+    for (size_t i = 0; i < batch_size; ++i) {
+        transcripts.push_back(std::make_shared<NativeTranscript>());
+        transcripts.back()->load_proof(batch_proofs[i]);
+    }
+    return transcripts;
+}
+
+// Verifies state.range(0) proofs one after the other, as a baseline for ipa_batch_verify
+void ipa_verify_sequential(State& state) noexcept
+{
+    const auto batch_size = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto transcripts = batch_verifier_transcripts(batch_size);
+        state.ResumeTiming();
+        for (size_t i = 0; i < batch_size; ++i) {
+            auto result = IPA<Curve>::reduce_verify(vk, batch_opening_claims[i], transcripts[i]);
+            ASSERT(result);
+        }
+    }
+}
+
+void ipa_batch_verify(State& state) noexcept
+{
+    const auto batch_size = static_cast<size_t>(state.range(0));
+    const auto claims_end = batch_opening_claims.begin() + static_cast<std::ptrdiff_t>(batch_size);
+    const std::vector<OpeningClaim<Curve>> claims(batch_opening_claims.begin(), claims_end);
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto transcripts = batch_verifier_transcripts(batch_size);
+        state.ResumeTiming();
+        auto result = IPA<Curve>::batch_reduce_verify(vk, claims, transcripts);
+        ASSERT(result);
+    }
+}
 } // namespace
 BENCHMARK(ipa_open)
     ->Unit(kMillisecond)
@@ -75,4 +141,14 @@ BENCHMARK(ipa_verify)
     ->Unit(kMillisecond)
     ->DenseRange(MIN_POLYNOMIAL_DEGREE_LOG2, MAX_POLYNOMIAL_DEGREE_LOG2)
     ->Setup(DoSetup);
+BENCHMARK(ipa_verify_sequential)
+    ->Unit(kMillisecond)
+    ->RangeMultiplier(2)
+    ->Range(1, MAX_BATCH_SIZE)
+    ->Setup(DoBatchSetup);
+BENCHMARK(ipa_batch_verify)
+    ->Unit(kMillisecond)
+    ->RangeMultiplier(2)
+    ->Range(1, MAX_BATCH_SIZE)
+    ->Setup(DoBatchSetup);
 BENCHMARK_MAIN();
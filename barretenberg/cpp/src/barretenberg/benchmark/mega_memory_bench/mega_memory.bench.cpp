@@ -2,10 +2,15 @@
 #include "barretenberg/stdlib/primitives/field/field.hpp"
 #include "barretenberg/stdlib/primitives/plookup/plookup.hpp"
 #include "barretenberg/stdlib_circuit_builders/plookup_tables/fixed_base/fixed_base.hpp"
+#include "barretenberg/srs/global_crs.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_circuit_builder.hpp"
 #include "barretenberg/ultra_honk/decider_proving_key.hpp"
+#include "barretenberg/ultra_honk/ultra_prover.hpp"
 
 #include <benchmark/benchmark.h>
+#if defined(__linux__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
 
 using namespace benchmark;
 using namespace bb;
@@ -23,6 +28,21 @@ using plookup_read = stdlib::plookup_read<Builder>;
 
 static constexpr size_t NUM_SHORT = 10;
 
+// Peak resident set size of the process in MiB. The peak is over the whole process, so run one benchmark at a time
+// (with --benchmark_filter) to attribute it.
+double peak_rss_mb()
+{
+#if defined(__linux__)
+    struct rusage usage {};
+    return getrusage(RUSAGE_SELF, &usage) == 0 ? static_cast<double>(usage.ru_maxrss) / (1 << 10) : 0;
+#elif defined(__APPLE__)
+    struct rusage usage {};
+    return getrusage(RUSAGE_SELF, &usage) == 0 ? static_cast<double>(usage.ru_maxrss) / (1 << 20) : 0;
+#else
+    return 0;
+#endif
+}
+
 void fill_ecc_op_block(Builder& builder)
 {
     const auto point = g1::affine_element::random_element();
@@ -278,7 +298,7 @@ void fill_lookup_block(Builder& builder)
     }
 }
 
-void fill_trace(State& state, TraceSettings settings)
+Builder construct_filled_builder(TraceSettings settings)
 {
     Builder builder;
     builder.blocks.set_fixed_block_sizes(settings);
@@ -306,16 +326,38 @@ void fill_trace(State& state, TraceSettings settings)
     }
 
     builder.finalize_circuit(/* ensure_nonzero */ true);
+    return builder;
+}
+
+void fill_trace(State& state, TraceSettings settings)
+{
+    Builder builder = construct_filled_builder(settings);
     uint64_t builder_estimate = MegaMemoryEstimator::estimate_builder_memory(builder);
     for (auto _ : state) {
         DeciderProvingKey proving_key(builder, settings);
         uint64_t memory_estimate = MegaMemoryEstimator::estimate_proving_key_memory(proving_key.proving_key);
         state.counters["poly_mem_est"] = static_cast<double>(memory_estimate);
         state.counters["builder_mem_est"] = static_cast<double>(builder_estimate);
+        state.counters["peak_rss_mb"] = peak_rss_mb();
         benchmark::DoNotOptimize(proving_key);
     }
 }
 
+// Peak memory of constructing the proving key and the proof, which includes the PCS at the end of proving
+void prove_trace(State& state, TraceSettings settings)
+{
+    bb::srs::init_file_crs_factory(bb::srs::bb_crs_path());
+    Builder builder = construct_filled_builder(settings);
+    for (auto _ : state) {
+        auto proving_key = std::make_shared<DeciderProvingKey>(builder, settings);
+        auto verification_key = std::make_shared<MegaFlavor::VerificationKey>(proving_key->proving_key);
+        MegaProver prover(proving_key, verification_key);
+        auto proof = prover.construct_proof();
+        state.counters["peak_rss_mb"] = peak_rss_mb();
+        benchmark::DoNotOptimize(proof);
+    }
+}
+
 void fill_trace_client_ivc_bench(State& state)
 {
     fill_trace(state, { AZTEC_TRACE_STRUCTURE });
@@ -331,8 +373,15 @@ static void pk_mem(State& state, void (*test_circuit_function)(State&)) noexcept
     test_circuit_function(state);
 }
 
+static void prove_mem(State& state) noexcept
+{
+    prove_trace(state, { AZTEC_TRACE_STRUCTURE });
+}
+
 BENCHMARK_CAPTURE(pk_mem, E2E_FULL_TEST, &fill_trace_e2e_full_test)->Unit(kMillisecond)->Iterations(1);
 
 BENCHMARK_CAPTURE(pk_mem, CLIENT_IVC_BENCH, &fill_trace_client_ivc_bench)->Unit(kMillisecond)->Iterations(1);
 
+BENCHMARK(prove_mem)->Unit(kMillisecond)->Iterations(1);
+
 BENCHMARK_MAIN();
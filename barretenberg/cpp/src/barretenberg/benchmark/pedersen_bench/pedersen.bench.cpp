@@ -0,0 +1,75 @@
+#include "barretenberg/crypto/pedersen_commitment/pedersen.hpp"
+#include "barretenberg/crypto/pedersen_hash/pedersen.hpp"
+#include <benchmark/benchmark.h>
+
+using namespace benchmark;
+using namespace bb;
+
+namespace {
+using Fq = crypto::pedersen_commitment::Fq;
+using Element = crypto::pedersen_commitment::Element;
+
+std::vector<Fq> random_inputs(size_t num_inputs)
+{
+    std::vector<Fq> inputs(num_inputs);
+    for (auto& input : inputs) {
+        input = Fq::random_element();
+    }
+    return inputs;
+}
+
+// One variable-base scalar multiplication per input, as commit_native did before the fixed-base tables
+void pedersen_commit_variable_base(State& state) noexcept
+{
+    const auto inputs = random_inputs(static_cast<size_t>(state.range(0)));
+    const auto generators =
+        crypto::generator_data<curve::Grumpkin>::get_default_generators()->get(inputs.size(), /*generator_offset=*/0);
+    for (auto _ : state) {
+        Element result = grumpkin::g1::point_at_infinity;
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            result += Element(generators[i]) * static_cast<uint256_t>(inputs[i]);
+        }
+        DoNotOptimize(result.normalize());
+    }
+}
+
+void pedersen_commit_fixed_base(State& state) noexcept
+{
+    const auto inputs = random_inputs(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        DoNotOptimize(crypto::pedersen_commitment::commit_native(inputs));
+    }
+}
+
+// state.range(0) hashes of two inputs each, one at a time
+void pedersen_hash_sequential(State& state) noexcept
+{
+    std::vector<std::vector<Fq>> inputs(static_cast<size_t>(state.range(0)));
+    for (auto& input : inputs) {
+        input = random_inputs(2);
+    }
+    for (auto _ : state) {
+        for (const auto& input : inputs) {
+            DoNotOptimize(crypto::pedersen_hash::hash(input));
+        }
+    }
+}
+
+void pedersen_hash_many(State& state) noexcept
+{
+    std::vector<std::vector<Fq>> inputs(static_cast<size_t>(state.range(0)));
+    for (auto& input : inputs) {
+        input = random_inputs(2);
+    }
+    for (auto _ : state) {
+        DoNotOptimize(crypto::pedersen_hash::hash_many(inputs));
+    }
+}
+} // namespace
+
+BENCHMARK(pedersen_commit_variable_base)->Unit(kMicrosecond)->RangeMultiplier(2)->Range(2, 64);
+BENCHMARK(pedersen_commit_fixed_base)->Unit(kMicrosecond)->RangeMultiplier(2)->Range(2, 64);
+BENCHMARK(pedersen_hash_sequential)->Unit(kMicrosecond)->RangeMultiplier(2)->Range(2, 64);
+BENCHMARK(pedersen_hash_many)->Unit(kMicrosecond)->RangeMultiplier(2)->Range(2, 64);
+
+BENCHMARK_MAIN();
@@ -41,4 +41,53 @@ void poseiden_hash_bench(State& state) noexcept
 }
 BENCHMARK(poseiden_hash_bench)->Unit(benchmark::kMillisecond);
 
+using Poseidon2 = bb::crypto::Poseidon2<bb::crypto::Poseidon2Bn254ScalarFieldParams>;
+
+std::vector<std::vector<grumpkin::fq>> random_pairs(const size_t count)
+{
+    std::vector<std::vector<grumpkin::fq>> pairs(count);
+    for (auto& pair : pairs) {
+        pair = { grumpkin::fq::random_element(), grumpkin::fq::random_element() };
+    }
+    return pairs;
+}
+
+// Hashes `count` independent pairs one by one, as the merkle tree and c_bind callers used to. Reports hashes/s.
+void poseidon2_hash_pairs_sequential_bench(State& state) noexcept
+{
+    const auto pairs = random_pairs(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        for (const auto& pair : pairs) {
+            DoNotOptimize(Poseidon2::hash(pair));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(poseidon2_hash_pairs_sequential_bench)->Arg(64)->Arg(1024);
+
+// Hashes the same pairs with the interleaved multi-state permutation. Reports hashes/s.
+void poseidon2_hash_many_bench(State& state) noexcept
+{
+    const auto pairs = random_pairs(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        DoNotOptimize(Poseidon2::hash_many(pairs));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(poseidon2_hash_many_bench)->Arg(64)->Arg(1024);
+
+// Hashes the same pairs laid out flat, as the merkle tree does for every level. Reports hashes/s.
+void poseidon2_hash_pairs_bench(State& state) noexcept
+{
+    std::vector<grumpkin::fq> inputs;
+    for (const auto& pair : random_pairs(static_cast<size_t>(state.range(0)))) {
+        inputs.insert(inputs.end(), pair.begin(), pair.end());
+    }
+    for (auto _ : state) {
+        DoNotOptimize(Poseidon2::hash_pairs(inputs));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(poseidon2_hash_pairs_bench)->Arg(64)->Arg(1024);
+
 BENCHMARK_MAIN();
\ No newline at end of file
@@ -0,0 +1,113 @@
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/flavor/ultra_flavor.hpp"
+#include "barretenberg/sumcheck/sumcheck.hpp"
+#include <benchmark/benchmark.h>
+
+using namespace benchmark;
+using namespace bb;
+
+namespace {
+
+using Flavor = UltraFlavor;
+using FF = Flavor::FF;
+using ProverPolynomials = Flavor::ProverPolynomials;
+using PartiallyEvaluatedMultivariates = Flavor::PartiallyEvaluatedMultivariates;
+
+// The cost of a sumcheck round does not depend on the values, so cheap non-zero values are used
+ProverPolynomials construct_polynomials(size_t circuit_size)
+{
+    ProverPolynomials polynomials(circuit_size);
+    auto unshifted = polynomials.get_unshifted();
+    parallel_for(unshifted.size(), [&](size_t j) {
+        auto& poly = unshifted[j];
+        for (size_t i = poly.start_index(); i < poly.end_index(); ++i) {
+            poly.at(i) = FF(i * unshifted.size() + j + 1);
+        }
+    });
+    return polynomials;
+}
+
+struct RoundInputs {
+    RelationParameters<FF> relation_parameters = RelationParameters<FF>::get_random();
+    Flavor::RelationSeparator alpha;
+    GateSeparatorPolynomial<FF> gate_separators;
+    FF challenge = FF::random_element();
+
+    explicit RoundInputs(size_t log_circuit_size)
+        : gate_separators(std::vector<FF>(log_circuit_size, FF::random_element()), log_circuit_size)
+    {
+        for (auto& alpha_i : alpha) {
+            alpha_i = FF::random_element();
+        }
+        gate_separators.partially_evaluate(challenge);
+    }
+};
+
+/**
+ * @brief The first partial evaluation followed by the univariate of the second round, as two passes
+ */
+void partially_evaluate_then_compute_univariate(State& state) noexcept
+{
+    const auto log_circuit_size = static_cast<size_t>(state.range(0));
+    const size_t circuit_size = 1 << log_circuit_size;
+    ProverPolynomials full_polynomials = construct_polynomials(circuit_size);
+    RoundInputs inputs(log_circuit_size);
+
+    SumcheckProver<Flavor> sumcheck(circuit_size, Flavor::Transcript::prover_init_empty());
+    sumcheck.partially_evaluated_polynomials = PartiallyEvaluatedMultivariates(full_polynomials, circuit_size);
+    for (auto _ : state) {
+        SumcheckProverRound<Flavor> round(circuit_size / 2);
+        sumcheck.partially_evaluate(full_polynomials, inputs.challenge);
+        DoNotOptimize(round.compute_univariate(sumcheck.partially_evaluated_polynomials,
+                                               inputs.relation_parameters,
+                                               inputs.gate_separators,
+                                               inputs.alpha));
+    }
+}
+
+/**
+ * @brief The same work as a single fused pass
+ */
+void partially_evaluate_and_compute_univariate(State& state) noexcept
+{
+    const auto log_circuit_size = static_cast<size_t>(state.range(0));
+    const size_t circuit_size = 1 << log_circuit_size;
+    ProverPolynomials full_polynomials = construct_polynomials(circuit_size);
+    RoundInputs inputs(log_circuit_size);
+
+    PartiallyEvaluatedMultivariates partially_evaluated_polynomials(full_polynomials, circuit_size);
+    for (auto _ : state) {
+        SumcheckProverRound<Flavor> round(circuit_size / 2);
+        DoNotOptimize(round.partially_evaluate_and_compute_univariate(full_polynomials,
+                                                                      partially_evaluated_polynomials,
+                                                                      inputs.challenge,
+                                                                      inputs.relation_parameters,
+                                                                      inputs.gate_separators,
+                                                                      inputs.alpha));
+    }
+}
+
+/**
+ * @brief All rounds of sumcheck, for the per-round breakdown run with op counting / tracy
+ */
+void sumcheck_prove(State& state) noexcept
+{
+    const auto log_circuit_size = static_cast<size_t>(state.range(0));
+    const size_t circuit_size = 1 << log_circuit_size;
+    ProverPolynomials full_polynomials = construct_polynomials(circuit_size);
+    RoundInputs inputs(log_circuit_size);
+    std::vector<FF> gate_challenges(log_circuit_size, FF::random_element());
+
+    for (auto _ : state) {
+        SumcheckProver<Flavor> sumcheck(circuit_size, Flavor::Transcript::prover_init_empty());
+        DoNotOptimize(sumcheck.prove(full_polynomials, inputs.relation_parameters, inputs.alpha, gate_challenges));
+    }
+}
+
+} // namespace
+
+BENCHMARK(partially_evaluate_then_compute_univariate)->DenseRange(18, 22)->Unit(kMillisecond);
+BENCHMARK(partially_evaluate_and_compute_univariate)->DenseRange(18, 22)->Unit(kMillisecond);
+BENCHMARK(sumcheck_prove)->DenseRange(18, 22)->Unit(kMillisecond);
+
+BENCHMARK_MAIN();
@@ -26,6 +26,18 @@ static void construct_proof_megahonk_power_of_2(State& state) noexcept
         state, &bb::mock_circuits::generate_basic_arithmetic_circuit<MegaCircuitBuilder>, log2_of_gates);
 }
 
+/**
+ * @brief Benchmark: Construction of a Mega Honk proof for a circuit laid out in the structured trace used by the IVC,
+ * in which most rows are padding
+ */
+static void construct_proof_megahonk_structured(State& state,
+                                                void (*test_circuit_function)(MegaCircuitBuilder&, size_t)) noexcept
+{
+    size_t num_iterations = 1;
+    bb::mock_circuits::construct_proof_with_specified_num_iterations<MegaProver>(
+        state, test_circuit_function, num_iterations, TraceSettings{ AZTEC_TRACE_STRUCTURE });
+}
+
 static void get_row_power_of_2(State& state) noexcept
 {
     auto log2_of_gates = static_cast<size_t>(state.range(0));
@@ -53,6 +65,14 @@ BENCHMARK_CAPTURE(construct_proof_megahonk,
                   merkle_membership,
                   &stdlib::generate_merkle_membership_test_circuit<MegaCircuitBuilder>)
     ->Unit(kMillisecond);
+BENCHMARK_CAPTURE(construct_proof_megahonk_structured,
+                  ecdsa_verification,
+                  &stdlib::generate_ecdsa_verification_test_circuit<MegaCircuitBuilder>)
+    ->Unit(kMillisecond);
+BENCHMARK_CAPTURE(construct_proof_megahonk_structured,
+                  merkle_membership,
+                  &stdlib::generate_merkle_membership_test_circuit<MegaCircuitBuilder>)
+    ->Unit(kMillisecond);
 
 BENCHMARK(get_row_power_of_2)
     // 2**15 gates to 2**20 gates
@@ -46,7 +46,8 @@ template <typename Builder> void generate_basic_arithmetic_circuit(Builder& buil
 
 template <typename Prover>
 Prover get_prover(void (*test_circuit_function)(typename Prover::Flavor::CircuitBuilder&, size_t),
-                  size_t num_iterations)
+                  size_t num_iterations,
+                  TraceSettings trace_settings = {})
 {
     using Flavor = typename Prover::Flavor;
     using Builder = typename Flavor::CircuitBuilder;
@@ -56,7 +57,7 @@ Prover get_prover(void (*test_circuit_function)(typename Prover::Flavor::Circuit
 
     PROFILE_THIS_NAME("creating prover");
 
-    auto proving_key = std::make_shared<DeciderProvingKey_<Flavor>>(builder);
+    auto proving_key = std::make_shared<DeciderProvingKey_<Flavor>>(builder, trace_settings);
     auto verification_key = std::make_shared<typename Flavor::VerificationKey>(proving_key->proving_key);
     return Prover(proving_key, verification_key);
 };
@@ -75,14 +76,15 @@ template <typename Prover>
 void construct_proof_with_specified_num_iterations(
     benchmark::State& state,
     void (*test_circuit_function)(typename Prover::Flavor::CircuitBuilder&, size_t),
-    size_t num_iterations)
+    size_t num_iterations,
+    TraceSettings trace_settings = {})
 {
     bb::srs::init_file_crs_factory(bb::srs::bb_crs_path());
 
     for (auto _ : state) {
         // Construct circuit and prover; don't include this part in measurement
         state.PauseTiming();
-        Prover prover = get_prover<Prover>(test_circuit_function, num_iterations);
+        Prover prover = get_prover<Prover>(test_circuit_function, num_iterations, trace_settings);
         state.ResumeTiming();
 
         // Construct proof
@@ -60,14 +60,14 @@ BB_PROFILE void test_round_inner(State& state, MegaProver& prover, size_t index)
     DeciderProver_<MegaFlavor> decider_prover(prover.proving_key, prover.transcript);
     time_if_index(RELATION_CHECK, [&] { decider_prover.execute_relation_check_rounds(); });
 }
-BB_PROFILE static void test_round(State& state, size_t index) noexcept
+BB_PROFILE static void test_round(State& state, size_t index, TraceSettings trace_settings = {}) noexcept
 {
     auto log2_num_gates = static_cast<size_t>(state.range(0));
     bb::srs::init_file_crs_factory(bb::srs::bb_crs_path());
 
     // TODO(https://github.com/AztecProtocol/barretenberg/issues/761) benchmark both sparse and dense circuits
     auto prover = bb::mock_circuits::get_prover<MegaProver>(
-        &bb::mock_circuits::generate_basic_arithmetic_circuit<MegaCircuitBuilder>, log2_num_gates);
+        &bb::mock_circuits::generate_basic_arithmetic_circuit<MegaCircuitBuilder>, log2_num_gates, trace_settings);
     for (auto _ : state) {
         state.PauseTiming();
         test_round_inner(state, prover, index);
@@ -92,4 +92,11 @@ ROUND_BENCHMARK(GRAND_PRODUCT_COMPUTATION)->Iterations(1);
 ROUND_BENCHMARK(GENERATE_ALPHAS)->Iterations(1);
 ROUND_BENCHMARK(RELATION_CHECK);
 
+// The same circuits laid out in the structured trace used by the IVC, where most rows are padding that sumcheck skips
+static void ROUND_RELATION_CHECK_STRUCTURED(State& state) noexcept
+{
+    test_round(state, RELATION_CHECK, TraceSettings{ AZTEC_TRACE_STRUCTURE });
+}
+BENCHMARK(ROUND_RELATION_CHECK_STRUCTURED)->DenseRange(12, 15)->Unit(kMillisecond);
+
 BENCHMARK_MAIN();
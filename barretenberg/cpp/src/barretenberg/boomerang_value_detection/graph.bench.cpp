@@ -0,0 +1,67 @@
+#include <benchmark/benchmark.h>
+
+#include "barretenberg/boomerang_value_detection/graph.hpp"
+#include "barretenberg/stdlib_circuit_builders/mock_circuits.hpp"
+#include "barretenberg/stdlib_circuit_builders/ultra_circuit_builder.hpp"
+
+using namespace benchmark;
+using namespace bb;
+
+namespace {
+
+// Construct a finalized circuit mixing arithmetic gates, lookups, range constraints and ROM reads
+void construct_circuit(UltraCircuitBuilder& builder, const size_t num_gates)
+{
+    MockCircuits::add_arithmetic_gates(builder, num_gates);
+    MockCircuits::add_lookup_gates(builder, /*num_iterations=*/num_gates / 64);
+    for (size_t i = 0; i < num_gates / 16; ++i) {
+        const uint32_t witness = builder.add_variable(fr(i & 0xffff));
+        builder.create_range_constraint(witness, /*num_bits=*/16 + (i % 16), "");
+    }
+    std::vector<uint32_t> rom_values;
+    for (size_t i = 0; i < 64; ++i) {
+        rom_values.emplace_back(builder.add_variable(fr(i)));
+    }
+    const size_t rom_id = builder.create_ROM_array(rom_values.size());
+    for (size_t i = 0; i < rom_values.size(); ++i) {
+        builder.set_ROM_element(rom_id, i, rom_values[i]);
+    }
+    for (size_t i = 0; i < num_gates / 64; ++i) {
+        builder.read_ROM_array(rom_id, builder.add_variable(fr(i % rom_values.size())));
+    }
+    builder.finalize_circuit(/*ensure_nonzero=*/true);
+}
+
+// Build the graph of a circuit and find its connected components
+void graph_construction_bench(State& state)
+{
+    UltraCircuitBuilder builder;
+    construct_circuit(builder, 1UL << state.range(0));
+
+    for (auto _ : state) {
+        cdg::Graph graph(builder);
+        auto connected_components = graph.find_connected_components();
+        DoNotOptimize(connected_components);
+    }
+}
+
+// Find the variables of a circuit that appear in only one gate
+void variables_in_one_gate_bench(State& state)
+{
+    UltraCircuitBuilder builder;
+    construct_circuit(builder, 1UL << state.range(0));
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto graph = std::make_unique<cdg::Graph>(builder);
+        state.ResumeTiming();
+        auto variables_in_one_gate = graph->show_variables_in_one_gate(builder);
+        DoNotOptimize(variables_in_one_gate);
+    }
+}
+} // namespace
+
+BENCHMARK(graph_construction_bench)->Unit(kMillisecond)->DenseRange(14, 20, 2);
+BENCHMARK(variables_in_one_gate_bench)->Unit(kMillisecond)->DenseRange(14, 20, 2);
+
+BENCHMARK_MAIN();
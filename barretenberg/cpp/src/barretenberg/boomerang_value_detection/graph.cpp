@@ -1,8 +1,8 @@
 #include "./graph.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_circuit_builder.hpp"
 #include <algorithm>
 #include <array>
-#include <stack>
 
 using namespace bb::plookup;
 using namespace bb;
@@ -36,18 +36,19 @@ template <typename FF> size_t Graph_<FF>::find_block_index(UltraCircuitBuilder&
  * @param gate_variables vector of variables to process
  * @param gate_index index of the current gate
  * @param block_idx index of the current block
+ * @param records records of the range of gates that contains the current gate
  * @details The method performs several operations:
  *          1) Removes duplicate variables from the input vector
  *          2) Converts each variable to its real index using to_real
- *          3) Creates key-value pairs of (variable_index, block_index) for tracking
- *          4) Updates variable_gates map with gate indices for each variable
- *          5) Increments the gate count for each processed variable
+ *          3) Records the (variable_index, block_index, gate_index) triple for every variable. These records give both
+ *             the gates where every variable was found and the number of these gates
  */
 template <typename FF>
 inline void Graph_<FF>::process_gate_variables(UltraCircuitBuilder& ultra_circuit_builder,
                                                std::vector<uint32_t>& gate_variables,
                                                size_t gate_index,
-                                               size_t block_idx)
+                                               size_t block_idx,
+                                               GateRecords& records)
 {
     auto unique_variables = std::unique(gate_variables.begin(), gate_variables.end());
     gate_variables.erase(unique_variables, gate_variables.end());
@@ -56,11 +57,8 @@ inline void Graph_<FF>::process_gate_variables(UltraCircuitBuilder& ultra_circui
     }
     for (auto& var_idx : gate_variables) {
         var_idx = this->to_real(ultra_circuit_builder, var_idx);
-        KeyPair key = std::make_pair(var_idx, block_idx);
-        variable_gates[key].emplace_back(gate_index);
-    }
-    for (const auto& variable_index : gate_variables) {
-        variables_gate_counts[variable_index] += 1;
+        records.variable_gates.push_back(
+            { var_idx, static_cast<uint32_t>(block_idx), static_cast<uint32_t>(gate_index) });
     }
 }
 
@@ -71,13 +69,18 @@ inline void Graph_<FF>::process_gate_variables(UltraCircuitBuilder& ultra_circui
  * @param index index of the current gate
  * @param block_idx index of the current block
  * @param blk block containing the gates
+ * @param records records of the range of gates that contains the current gate
  * @return std::vector<std::vector<uint32_t>> vector of connected components from the gate and minigate
  * @details Processes both regular arithmetic gates and minigates, handling fixed witness gates
  *          and different arithmetic operations based on selector values
  */
 template <typename FF>
 inline std::vector<std::vector<uint32_t>> Graph_<FF>::get_arithmetic_gate_connected_component(
-    bb::UltraCircuitBuilder& ultra_circuit_builder, size_t index, size_t block_idx, UltraBlock& blk)
+    bb::UltraCircuitBuilder& ultra_circuit_builder,
+    size_t index,
+    size_t block_idx,
+    UltraBlock& blk,
+    GateRecords& records)
 {
     auto q_arith = blk.q_arith()[index];
     std::vector<uint32_t> gate_variables;
@@ -98,7 +101,7 @@ inline std::vector<std::vector<uint32_t>> Graph_<FF>::get_arithmetic_gate_connec
     uint32_t fourth_idx = blk.w_4()[index];
     if (q_m.is_zero() && q_1 == 1 && q_2.is_zero() && q_3.is_zero() && q_4.is_zero() && q_arith == FF::one()) {
         // this is fixed_witness gate. So, variable index contains in left wire. So, we have to take only it.
-        fixed_variables.insert(this->to_real(ultra_circuit_builder, left_idx));
+        records.fixed_variables.push_back(this->to_real(ultra_circuit_builder, left_idx));
     } else if (!q_m.is_zero() || q_1 != FF::one() || !q_2.is_zero() || !q_3.is_zero() || !q_4.is_zero()) {
         // this is not the gate for fix_witness, so we have to process this gate
         if (!q_m.is_zero()) {
@@ -140,8 +143,8 @@ inline std::vector<std::vector<uint32_t>> Graph_<FF>::get_arithmetic_gate_connec
     }
     gate_variables = this->to_real(ultra_circuit_builder, gate_variables);
     minigate_variables = this->to_real(ultra_circuit_builder, minigate_variables);
-    this->process_gate_variables(ultra_circuit_builder, gate_variables, index, block_idx);
-    this->process_gate_variables(ultra_circuit_builder, minigate_variables, index, block_idx);
+    this->process_gate_variables(ultra_circuit_builder, gate_variables, index, block_idx, records);
+    this->process_gate_variables(ultra_circuit_builder, minigate_variables, index, block_idx, records);
     all_gates_variables.emplace_back(gate_variables);
     if (!minigate_variables.empty()) {
         all_gates_variables.emplace_back(minigate_variables);
@@ -157,13 +160,18 @@ inline std::vector<std::vector<uint32_t>> Graph_<FF>::get_arithmetic_gate_connec
  * @param index index of the current gate
  * @param block_idx index of the current block
  * @param blk block containing the gates
+ * @param records records of the range of gates that contains the current gate
  * @return std::vector<uint32_t> vector of connected variables from the gate
  * @details Handles both elliptic curve addition and doubling operations,
  *          collecting variables from current and next gates as needed
  */
 template <typename FF>
 inline std::vector<uint32_t> Graph_<FF>::get_elliptic_gate_connected_component(
-    bb::UltraCircuitBuilder& ultra_circuit_builder, size_t index, size_t block_idx, UltraBlock& blk)
+    bb::UltraCircuitBuilder& ultra_circuit_builder,
+    size_t index,
+    size_t block_idx,
+    UltraBlock& blk,
+    GateRecords& records)
 {
     std::vector<uint32_t> gate_variables = {};
     if (!blk.q_elliptic()[index].is_zero()) {
@@ -188,7 +196,7 @@ inline std::vector<uint32_t> Graph_<FF>::get_elliptic_gate_connected_component(
             }
         }
         gate_variables = this->to_real(ultra_circuit_builder, gate_variables);
-        this->process_gate_variables(ultra_circuit_builder, gate_variables, index, block_idx);
+        this->process_gate_variables(ultra_circuit_builder, gate_variables, index, block_idx, records);
     }
     return gate_variables;
 }
@@ -200,13 +208,18 @@ inline std::vector<uint32_t> Graph_<FF>::get_elliptic_gate_connected_component(
  * @param index index of the current gate
  * @param block_idx index of the current block
  * @param block block containing the gates
+ * @param records records of the range of gates that contains the current gate
  * @return std::vector<uint32_t> vector of connected variables from the gate
  * @details Processes delta range constraints by collecting all wire indices
  *          from the current gate
  */
 template <typename FF>
 inline std::vector<uint32_t> Graph_<FF>::get_sort_constraint_connected_component(
-    bb::UltraCircuitBuilder& ultra_circuit_builder, size_t index, size_t blk_idx, UltraBlock& block)
+    bb::UltraCircuitBuilder& ultra_circuit_builder,
+    size_t index,
+    size_t blk_idx,
+    UltraBlock& block,
+    GateRecords& records)
 {
     std::vector<uint32_t> gate_variables = {};
     if (!block.q_delta_range()[index].is_zero()) {
@@ -217,7 +230,7 @@ inline std::vector<uint32_t> Graph_<FF>::get_sort_constraint_connected_component
         gate_variables.insert(gate_variables.end(), { left_idx, right_idx, out_idx, fourth_idx });
     }
     gate_variables = this->to_real(ultra_circuit_builder, gate_variables);
-    this->process_gate_variables(ultra_circuit_builder, gate_variables, index, blk_idx);
+    this->process_gate_variables(ultra_circuit_builder, gate_variables, index, blk_idx, records);
     return gate_variables;
 }
 
@@ -228,13 +241,18 @@ inline std::vector<uint32_t> Graph_<FF>::get_sort_constraint_connected_component
  * @param index index of the current gate
  * @param block_idx index of the current block
  * @param block block containing the gates
+ * @param records records of the range of gates that contains the current gate
  * @return std::vector<uint32_t> vector of connected variables from the gate
  * @details Processes plookup gates by collecting variables based on selector values,
  *          including variables from the next gate when necessary
  */
 template <typename FF>
 inline std::vector<uint32_t> Graph_<FF>::get_plookup_gate_connected_component(
-    bb::UltraCircuitBuilder& ultra_circuit_builder, size_t index, size_t blk_idx, UltraBlock& block)
+    bb::UltraCircuitBuilder& ultra_circuit_builder,
+    size_t index,
+    size_t blk_idx,
+    UltraBlock& block,
+    GateRecords& records)
 {
     std::vector<uint32_t> gate_variables;
     auto q_lookup_type = block.q_lookup_type()[index];
@@ -260,7 +278,7 @@ inline std::vector<uint32_t> Graph_<FF>::get_plookup_gate_connected_component(
             }
         }
         gate_variables = this->to_real(ultra_circuit_builder, gate_variables);
-        this->process_gate_variables(ultra_circuit_builder, gate_variables, index, blk_idx);
+        this->process_gate_variables(ultra_circuit_builder, gate_variables, index, blk_idx, records);
     }
     return gate_variables;
 }
@@ -272,11 +290,16 @@ inline std::vector<uint32_t> Graph_<FF>::get_plookup_gate_connected_component(
  * @param index index of the current gate
  * @param blk_idx index of the current block
  * @param block block containing the gates
+ * @param records records of the range of gates that contains the current gate
  * @return std::vector<uint32_t> vector of connected variables from the gate
  */
 template <typename FF>
 inline std::vector<uint32_t> Graph_<FF>::get_poseido2s_gate_connected_component(
-    bb::UltraCircuitBuilder& ultra_circuit_builder, size_t index, size_t blk_idx, UltraBlock& block)
+    bb::UltraCircuitBuilder& ultra_circuit_builder,
+    size_t index,
+    size_t blk_idx,
+    UltraBlock& block,
+    GateRecords& records)
 {
     std::vector<uint32_t> gate_variables;
     auto internal_selector = block.q_poseidon2_internal()[index];
@@ -290,7 +313,7 @@ inline std::vector<uint32_t> Graph_<FF>::get_poseido2s_gate_connected_component(
                 { block.w_l()[index + 1], block.w_r()[index + 1], block.w_o()[index + 1], block.w_4()[index + 1] });
         }
         gate_variables = this->to_real(ultra_circuit_builder, gate_variables);
-        this->process_gate_variables(ultra_circuit_builder, gate_variables, index, blk_idx);
+        this->process_gate_variables(ultra_circuit_builder, gate_variables, index, blk_idx, records);
     }
     return gate_variables;
 }
@@ -303,13 +326,15 @@ inline std::vector<uint32_t> Graph_<FF>::get_poseido2s_gate_connected_component(
  * @param index index of the current gate
  * @param blk_idx index of the current block
  * @param block block containing the gates
+ * @param records records of the range of gates that contains the current gate
  * @return std::vector<uint32_t> vector of connected variables from the gate
  */
 template <typename FF>
 inline std::vector<uint32_t> Graph_<FF>::get_auxiliary_gate_connected_component(bb::UltraCircuitBuilder& ultra_builder,
                                                                                 size_t index,
                                                                                 size_t blk_idx,
-                                                                                UltraBlock& block)
+                                                                                UltraBlock& block,
+                                                                                GateRecords& records)
 {
     std::vector<uint32_t> gate_variables;
     if (!block.q_aux()[index].is_zero()) {
@@ -411,7 +436,7 @@ inline std::vector<uint32_t> Graph_<FF>::get_auxiliary_gate_connected_component(
             }
         }
     }
-    this->process_gate_variables(ultra_builder, gate_variables, index, blk_idx);
+    this->process_gate_variables(ultra_builder, gate_variables, index, blk_idx, records);
     return gate_variables;
 }
 
@@ -420,11 +445,12 @@ inline std::vector<uint32_t> Graph_<FF>::get_auxiliary_gate_connected_component(
  * @tparam FF field type
  * @param ultra_builder circuit builder containing the gates
  * @param rom_array ROM transcript containing records with witness indices and gate information
+ * @param records records of the ROM and RAM gates
  * @return std::vector<uint32_t> vector of connected variables from ROM table gates
  */
 template <typename FF>
 inline std::vector<uint32_t> Graph_<FF>::get_rom_table_connected_component(
-    bb::UltraCircuitBuilder& ultra_builder, const UltraCircuitBuilder::RomTranscript& rom_array)
+    bb::UltraCircuitBuilder& ultra_builder, const UltraCircuitBuilder::RomTranscript& rom_array, GateRecords& records)
 {
     size_t block_index = find_block_index(ultra_builder, ultra_builder.blocks.aux);
     ASSERT(block_index == 5);
@@ -466,7 +492,7 @@ inline std::vector<uint32_t> Graph_<FF>::get_rom_table_connected_component(
             gate_variables.emplace_back(record_witness);
         }
         gate_variables = this->to_real(ultra_builder, gate_variables);
-        this->process_gate_variables(ultra_builder, gate_variables, gate_index, block_index);
+        this->process_gate_variables(ultra_builder, gate_variables, gate_index, block_index, records);
         // after process_gate_variables function gate_variables constists of real variables indexes, so we can add all
         // this variables in the final vector to connect all of them
         if (!gate_variables.empty()) {
@@ -481,11 +507,12 @@ inline std::vector<uint32_t> Graph_<FF>::get_rom_table_connected_component(
  * @tparam FF field type
  * @param ultra_builder circuit builder containing the gates
  * @param ram_array RAM transcript containing records with witness indices and gate information
+ * @param records records of the ROM and RAM gates
  * @return std::vector<uint32_t> vector of connected variables from RAM table gates
  */
 template <typename FF>
 inline std::vector<uint32_t> Graph_<FF>::get_ram_table_connected_component(
-    bb::UltraCircuitBuilder& ultra_builder, const UltraCircuitBuilder::RamTranscript& ram_array)
+    bb::UltraCircuitBuilder& ultra_builder, const UltraCircuitBuilder::RamTranscript& ram_array, GateRecords& records)
 {
     size_t block_index = find_block_index(ultra_builder, ultra_builder.blocks.aux);
     ASSERT(block_index == 5);
@@ -521,7 +548,7 @@ inline std::vector<uint32_t> Graph_<FF>::get_ram_table_connected_component(
             gate_variables.emplace_back(record_witness);
         }
         gate_variables = this->to_real(ultra_builder, gate_variables);
-        this->process_gate_variables(ultra_builder, gate_variables, gate_index, block_index);
+        this->process_gate_variables(ultra_builder, gate_variables, gate_index, block_index, records);
         // after process_gate_variables function gate_variables constists of real variables indexes, so we can add all
         // these variables in the final vector to connect all of them
         ram_table_variables.insert(ram_table_variables.end(), gate_variables.begin(), gate_variables.end());
@@ -529,99 +556,200 @@ inline std::vector<uint32_t> Graph_<FF>::get_ram_table_connected_component(
     return ram_table_variables;
 }
 
+/**
+ * @brief this method processes the gates with indices in [start, end) of the block and records connections between
+ * their variables
+ * @tparam FF field type
+ * @param ultra_circuit_builder circuit builder containing the gates
+ * @param block_idx index of the block
+ * @param blk block containing the gates
+ * @param start index of the first gate of the range
+ * @param end index after the last gate of the range
+ * @param records records of the range
+ * @details Sorted constraints of the delta range block span several consecutive gates, and their variables are
+ *          connected when the gate closing the sorted list is found. Ranges must therefore start right after a gate
+ *          with zero q_delta_range, where the list of sorted variables is empty.
+ */
+template <typename FF>
+void Graph_<FF>::process_gates(bb::UltraCircuitBuilder& ultra_circuit_builder,
+                               size_t block_idx,
+                               UltraBlock& blk,
+                               size_t start,
+                               size_t end,
+                               GateRecords& records)
+{
+    std::vector<uint32_t> sorted_variables;
+    for (size_t gate_idx = start; gate_idx < end; gate_idx++) {
+        auto arithmetic_gates_variables =
+            get_arithmetic_gate_connected_component(ultra_circuit_builder, gate_idx, block_idx, blk, records);
+        if (!arithmetic_gates_variables.empty()) {
+            for (const auto& gate_variables : arithmetic_gates_variables) {
+                connect_all_variables_in_vector(ultra_circuit_builder, gate_variables, records);
+            }
+        }
+        auto elliptic_gate_variables =
+            get_elliptic_gate_connected_component(ultra_circuit_builder, gate_idx, block_idx, blk, records);
+        connect_all_variables_in_vector(ultra_circuit_builder, elliptic_gate_variables, records);
+        auto lookup_gate_variables =
+            get_plookup_gate_connected_component(ultra_circuit_builder, gate_idx, block_idx, blk, records);
+        connect_all_variables_in_vector(ultra_circuit_builder, lookup_gate_variables, records);
+        auto poseidon2_gate_variables =
+            get_poseido2s_gate_connected_component(ultra_circuit_builder, gate_idx, block_idx, blk, records);
+        connect_all_variables_in_vector(ultra_circuit_builder, poseidon2_gate_variables, records);
+        auto aux_gate_variables =
+            get_auxiliary_gate_connected_component(ultra_circuit_builder, gate_idx, block_idx, blk, records);
+        connect_all_variables_in_vector(ultra_circuit_builder, aux_gate_variables, records);
+        if (arithmetic_gates_variables.empty() && elliptic_gate_variables.empty() && lookup_gate_variables.empty() &&
+            poseidon2_gate_variables.empty() && aux_gate_variables.empty()) {
+            // if all vectors are empty it means that current block is delta range, and it needs another
+            // processing method
+            auto delta_range_gate_variables =
+                get_sort_constraint_connected_component(ultra_circuit_builder, gate_idx, block_idx, blk, records);
+            if (delta_range_gate_variables.empty()) {
+                connect_all_variables_in_vector(ultra_circuit_builder, sorted_variables, records);
+                sorted_variables.clear();
+            } else {
+                sorted_variables.insert(
+                    sorted_variables.end(), delta_range_gate_variables.begin(), delta_range_gate_variables.end());
+            }
+        }
+    }
+}
+
 /**
  * @brief Construct a new Graph from Ultra Circuit Builder
  * @tparam FF field type used in the circuit
  * @param ultra_circuit_constructor circuit builder containing all gates and variables
  * @details This constructor initializes the graph structure by:
- *          1) Creating data structures for tracking:
- *             - Number of gates each variable appears in (variables_gate_counts)
- *             - Adjacency lists for each variable (variable_adjacency_lists)
- *             - Degree of each variable (variables_degree)
- *          2) Processing different types of gates:
+ *          1) Processing different types of gates:
  *             - Arithmetic gates
  *             - Elliptic curve gates
  *             - Plookup gates
  *             - Poseidon2 gates
  *             - Auxiliary gates
  *             - Delta range gates
- *          3) Creating connections between variables that appear in the same gate
- *          4) Special handling for sorted constraints in delta range blocks
+ *             The gates of every block are split into ranges that are processed in parallel
+ *          2) Creating connections between variables that appear in the same gate
+ *          3) Special handling for sorted constraints in delta range blocks
+ *          4) Building the adjacency lists, the degrees and the gate counts of the variables from the records of all
+ *             ranges (see build_graph)
  */
 template <typename FF> Graph_<FF>::Graph_(bb::UltraCircuitBuilder& ultra_circuit_constructor)
 {
-    this->variables_gate_counts =
-        std::unordered_map<uint32_t, size_t>(ultra_circuit_constructor.real_variable_index.size());
-    this->variable_adjacency_lists =
-        std::unordered_map<uint32_t, std::vector<uint32_t>>(ultra_circuit_constructor.real_variable_index.size());
-    this->variables_degree = std::unordered_map<uint32_t, size_t>(ultra_circuit_constructor.real_variable_index.size());
-    for (const auto& variable_index : ultra_circuit_constructor.real_variable_index) {
-        variables_gate_counts[variable_index] = 0;
-        variables_degree[variable_index] = 0;
-        variable_adjacency_lists[variable_index] = {};
+    constexpr size_t MIN_GATES_PER_RANGE = 1 << 10;
+    const size_t num_variables = ultra_circuit_constructor.real_variable_index.size();
+    this->real_variable_indices = ultra_circuit_constructor.real_variable_index;
+    this->is_constant_variable = std::vector<bool>(num_variables, false);
+    for (const auto& [value, variable_index] : ultra_circuit_constructor.constant_variable_indices) {
+        is_constant_variable[variable_index] = true;
     }
 
-    std::map<FF, uint32_t> constant_variable_indices = ultra_circuit_constructor.constant_variable_indices;
+    std::vector<GateRecords> all_records;
     auto block_data = ultra_circuit_constructor.blocks.get();
     for (size_t blk_idx = 1; blk_idx < block_data.size() - 1; blk_idx++) {
-        if (block_data[blk_idx].size() == 0) {
+        auto& block = block_data[blk_idx];
+        if (block.size() == 0) {
             continue;
         }
-        std::vector<uint32_t> sorted_variables;
-        for (size_t gate_idx = 0; gate_idx < block_data[blk_idx].size(); gate_idx++) {
-            auto arithmetic_gates_variables = get_arithmetic_gate_connected_component(
-                ultra_circuit_constructor, gate_idx, blk_idx, block_data[blk_idx]);
-            if (!arithmetic_gates_variables.empty()) {
-                for (const auto& gate_variables : arithmetic_gates_variables) {
-                    connect_all_variables_in_vector(ultra_circuit_constructor, gate_variables);
-                }
-            }
-            auto elliptic_gate_variables = get_elliptic_gate_connected_component(
-                ultra_circuit_constructor, gate_idx, blk_idx, block_data[blk_idx]);
-            connect_all_variables_in_vector(ultra_circuit_constructor, elliptic_gate_variables);
-            auto lookup_gate_variables =
-                get_plookup_gate_connected_component(ultra_circuit_constructor, gate_idx, blk_idx, block_data[blk_idx]);
-            connect_all_variables_in_vector(ultra_circuit_constructor, lookup_gate_variables);
-            auto poseidon2_gate_variables = get_poseido2s_gate_connected_component(
-                ultra_circuit_constructor, gate_idx, blk_idx, block_data[blk_idx]);
-            connect_all_variables_in_vector(ultra_circuit_constructor, poseidon2_gate_variables);
-            auto aux_gate_variables = get_auxiliary_gate_connected_component(
-                ultra_circuit_constructor, gate_idx, blk_idx, block_data[blk_idx]);
-            connect_all_variables_in_vector(ultra_circuit_constructor, aux_gate_variables);
-            if (arithmetic_gates_variables.empty() && elliptic_gate_variables.empty() &&
-                lookup_gate_variables.empty() && poseidon2_gate_variables.empty() && aux_gate_variables.empty()) {
-                // if all vectors are empty it means that current block is delta range, and it needs another
-                // processing method
-                auto delta_range_gate_variables = get_sort_constraint_connected_component(
-                    ultra_circuit_constructor, gate_idx, blk_idx, block_data[blk_idx]);
-                if (delta_range_gate_variables.empty()) {
-                    connect_all_variables_in_vector(ultra_circuit_constructor, sorted_variables);
-                    sorted_variables.clear();
-                } else {
-                    sorted_variables.insert(
-                        sorted_variables.end(), delta_range_gate_variables.begin(), delta_range_gate_variables.end());
-                }
+        const size_t num_ranges = calculate_num_threads(block.size(), MIN_GATES_PER_RANGE);
+        const size_t range_size = (block.size() + num_ranges - 1) / num_ranges;
+        std::vector<size_t> range_starts = { 0 };
+        for (size_t range_idx = 1; range_idx < num_ranges; range_idx++) {
+            size_t range_start = std::max(range_idx * range_size, range_starts.back());
+            while (range_start < block.size() && !block.q_delta_range()[range_start - 1].is_zero()) {
+                range_start++;
             }
+            range_starts.emplace_back(std::min(range_start, block.size()));
         }
+        range_starts.emplace_back(block.size());
+
+        const size_t first_range = all_records.size();
+        all_records.resize(first_range + num_ranges);
+        parallel_for(num_ranges, [&](size_t range_idx) {
+            process_gates(ultra_circuit_constructor,
+                          blk_idx,
+                          block,
+                          range_starts[range_idx],
+                          range_starts[range_idx + 1],
+                          all_records[first_range + range_idx]);
+        });
     }
 
-    const auto& rom_arrays = ultra_circuit_constructor.rom_arrays;
-    if (!rom_arrays.empty()) {
-        for (const auto& rom_array : rom_arrays) {
-            std::vector<uint32_t> variable_indices =
-                this->get_rom_table_connected_component(ultra_circuit_constructor, rom_array);
-            this->connect_all_variables_in_vector(ultra_circuit_constructor, variable_indices);
+    auto& memory_records = all_records.emplace_back();
+    for (const auto& rom_array : ultra_circuit_constructor.rom_arrays) {
+        std::vector<uint32_t> variable_indices =
+            this->get_rom_table_connected_component(ultra_circuit_constructor, rom_array, memory_records);
+        this->connect_all_variables_in_vector(ultra_circuit_constructor, variable_indices, memory_records);
+    }
+    for (const auto& ram_array : ultra_circuit_constructor.ram_arrays) {
+        std::vector<uint32_t> variable_indices =
+            this->get_ram_table_connected_component(ultra_circuit_constructor, ram_array, memory_records);
+        this->connect_all_variables_in_vector(ultra_circuit_constructor, variable_indices, memory_records);
+    }
+
+    this->build_graph(num_variables, all_records);
+}
+
+/**
+ * @brief this method builds the adjacency lists of the graph and the gates of every variable from the records of
+ * all processed gates
+ * @tparam FF field type
+ * @param num_variables number of variables in the circuit
+ * @param all_records records of all ranges of gates in the order of the gates
+ * @details Both structures are stored in compressed sparse row form, i.e. as one flat array sorted by variable index
+ *          and an array of offsets into it. They are filled by a counting sort over the records, so every adjacency
+ *          list keeps the order in which the edges were found. The degree of a variable is the length of its adjacency
+ *          list and its gate count is the number of gates recorded for it.
+ */
+template <typename FF>
+void Graph_<FF>::build_graph(size_t num_variables, const std::vector<GateRecords>& all_records)
+{
+    adjacency_offsets = std::vector<size_t>(num_variables + 1, 0);
+    variable_gates_offsets = std::vector<size_t>(num_variables + 1, 0);
+    for (const auto& records : all_records) {
+        for (const auto& [first_variable_index, second_variable_index] : records.edges) {
+            adjacency_offsets[first_variable_index + 1]++;
+            adjacency_offsets[second_variable_index + 1]++;
+        }
+        for (const auto& variable_gate : records.variable_gates) {
+            variable_gates_offsets[variable_gate.variable_index + 1]++;
         }
+        fixed_variables.insert(records.fixed_variables.begin(), records.fixed_variables.end());
+    }
+    variables_gate_counts = std::vector<size_t>(num_variables);
+    for (size_t i = 0; i < num_variables; i++) {
+        variables_gate_counts[i] = variable_gates_offsets[i + 1];
+        adjacency_offsets[i + 1] += adjacency_offsets[i];
+        variable_gates_offsets[i + 1] += variable_gates_offsets[i];
     }
 
-    const auto& ram_arrays = ultra_circuit_constructor.ram_arrays;
-    if (!ram_arrays.empty()) {
-        for (const auto& ram_array : ram_arrays) {
-            std::vector<uint32_t> variable_indices =
-                this->get_ram_table_connected_component(ultra_circuit_constructor, ram_array);
-            this->connect_all_variables_in_vector(ultra_circuit_constructor, variable_indices);
+    adjacent_variables = std::vector<uint32_t>(adjacency_offsets.back());
+    variable_gates = std::vector<VariableGate>(variable_gates_offsets.back());
+    std::vector<size_t> adjacency_positions(adjacency_offsets.begin(), adjacency_offsets.end() - 1);
+    std::vector<size_t> variable_gates_positions(variable_gates_offsets.begin(), variable_gates_offsets.end() - 1);
+    for (const auto& records : all_records) {
+        for (const auto& [first_variable_index, second_variable_index] : records.edges) {
+            adjacent_variables[adjacency_positions[first_variable_index]++] = second_variable_index;
+            adjacent_variables[adjacency_positions[second_variable_index]++] = first_variable_index;
         }
+        for (const auto& variable_gate : records.variable_gates) {
+            variable_gates[variable_gates_positions[variable_gate.variable_index]++] = variable_gate;
+        }
+    }
+}
+
+/**
+ * @brief this method returns the number of gates that use every variable
+ * @tparam FF
+ * @return std::unordered_map<uint32_t, size_t> map from real variable index to the number of gates with this variable
+ */
+template <typename FF> std::unordered_map<uint32_t, size_t> Graph_<FF>::get_variables_gate_counts()
+{
+    std::unordered_map<uint32_t, size_t> gate_counts(real_variable_indices.size());
+    for (const auto& variable_index : real_variable_indices) {
+        gate_counts[variable_index] = variables_gate_counts[variable_index];
     }
+    return gate_counts;
 }
 
 /**
@@ -637,15 +765,7 @@ template <typename FF>
 bool Graph_<FF>::check_is_not_constant_variable(bb::UltraCircuitBuilder& ultra_circuit_builder,
                                                 const uint32_t& variable_index)
 {
-    bool is_not_constant = true;
-    const auto& constant_variable_indices = ultra_circuit_builder.constant_variable_indices;
-    for (const auto& pair : constant_variable_indices) {
-        if (pair.second == ultra_circuit_builder.real_variable_index[variable_index]) {
-            is_not_constant = false;
-            break;
-        }
-    }
-    return is_not_constant;
+    return !is_constant_variable[ultra_circuit_builder.real_variable_index[variable_index]];
 }
 
 /**
@@ -656,12 +776,13 @@ bool Graph_<FF>::check_is_not_constant_variable(bb::UltraCircuitBuilder& ultra_c
  * @tparam FF
  * @param ultra_circuit_builder
  * @param variables_vector
- * @param is_sorted_variables
+ * @param records records where the new edges are added
  */
 
 template <typename FF>
 void Graph_<FF>::connect_all_variables_in_vector(bb::UltraCircuitBuilder& ultra_circuit_builder,
-                                                 const std::vector<uint32_t>& variables_vector)
+                                                 const std::vector<uint32_t>& variables_vector,
+                                                 GateRecords& records)
 {
     if (variables_vector.empty()) {
         return;
@@ -683,50 +804,58 @@ void Graph_<FF>::connect_all_variables_in_vector(bb::UltraCircuitBuilder& ultra_
         return;
     }
     for (size_t i = 0; i < filtered_variables_vector.size() - 1; i++) {
-        this->add_new_edge(filtered_variables_vector[i], filtered_variables_vector[i + 1]);
+        records.edges.emplace_back(filtered_variables_vector[i], filtered_variables_vector[i + 1]);
     }
 }
 
 /**
- * @brief this method creates an edge between two variables in graph. All needed checks in a function above
+ * @brief this method finds the root of the tree containing the variable in the union-find forest
  * @tparam FF
- * @param first_variable_index
- * @param second_variable_index
+ * @param variable_index
+ * @return uint32_t index of the root variable
+ * @details Every visited variable is linked to its grandparent (path halving). Links only ever point to a smaller
+ *          index, so concurrent calls can replace them with compare-and-swap without taking any lock.
  */
 
-template <typename FF>
-void Graph_<FF>::add_new_edge(const uint32_t& first_variable_index, const uint32_t& second_variable_index)
+template <typename FF> uint32_t Graph_<FF>::find_component_root(uint32_t variable_index)
 {
-    variable_adjacency_lists[first_variable_index].emplace_back(second_variable_index);
-    variable_adjacency_lists[second_variable_index].emplace_back(first_variable_index);
-    variables_degree[first_variable_index] += 1;
-    variables_degree[second_variable_index] += 1;
+    while (true) {
+        uint32_t parent = component_parents[variable_index].load(std::memory_order_relaxed);
+        if (parent == variable_index) {
+            return variable_index;
+        }
+        uint32_t grandparent = component_parents[parent].load(std::memory_order_relaxed);
+        if (grandparent != parent) {
+            component_parents[variable_index].compare_exchange_weak(parent, grandparent, std::memory_order_relaxed);
+        }
+        variable_index = grandparent;
+    }
 }
 
 /**
- * @brief this method implements depth-first search algorithm for undirected graphs
+ * @brief this method merges the trees of two variables in the union-find forest
  * @tparam FF
- * @param variable_index
- * @param is_used
- * @param connected_component
+ * @param first_variable_index
+ * @param second_variable_index
+ * @details The root with the larger index is linked to the other one. The link is only made if the root is still a
+ *          root, otherwise both roots are found again, so concurrent merges never create cycles or lose a merge.
  */
 
 template <typename FF>
-void Graph_<FF>::depth_first_search(const uint32_t& variable_index,
-                                    std::unordered_set<uint32_t>& is_used,
-                                    std::vector<uint32_t>& connected_component)
+void Graph_<FF>::unite_components(uint32_t first_variable_index, uint32_t second_variable_index)
 {
-    std::stack<uint32_t> variable_stack;
-    variable_stack.push(variable_index);
-    while (!variable_stack.empty()) {
-        uint32_t current_index = variable_stack.top();
-        variable_stack.pop();
-        if (!is_used.contains(current_index)) {
-            is_used.insert(current_index);
-            connected_component.emplace_back(current_index);
-            for (const auto& it : variable_adjacency_lists[current_index]) {
-                variable_stack.push(it);
-            }
+    while (true) {
+        uint32_t first_root = find_component_root(first_variable_index);
+        uint32_t second_root = find_component_root(second_variable_index);
+        if (first_root == second_root) {
+            return;
+        }
+        if (first_root > second_root) {
+            std::swap(first_root, second_root);
+        }
+        uint32_t expected = second_root;
+        if (component_parents[second_root].compare_exchange_strong(expected, first_root, std::memory_order_relaxed)) {
+            return;
         }
     }
 }
@@ -736,25 +865,71 @@ void Graph_<FF>::depth_first_search(const uint32_t& variable_index,
  * @tparam FF
  * @return std::vector<std::vector<uint32_t>> list of connected components where each component is a vector of variable
  * indices
+ * @details The edges are merged into a union-find forest in parallel. Components are ordered by their smallest
+ *          variable and the variables of each component are sorted. Isolated variables don't form components.
  */
 
 template <typename FF> std::vector<std::vector<uint32_t>> Graph_<FF>::find_connected_components()
 {
-    std::unordered_set<uint32_t> is_used;
-    std::vector<std::vector<uint32_t>> connected_components;
-    for (const auto& pair : variable_adjacency_lists) {
-        if (pair.first != 0 && variables_degree[pair.first] > 0) {
-            if (!is_used.contains(pair.first)) {
-                std::vector<uint32_t> connected_component;
-                this->depth_first_search(pair.first, is_used, connected_component);
-                std::sort(connected_component.begin(), connected_component.end());
-                connected_components.emplace_back(connected_component);
+    constexpr size_t MIN_VARIABLES_PER_THREAD = 1 << 12;
+    const size_t num_variables = adjacency_offsets.size() - 1;
+    component_parents = std::vector<std::atomic<uint32_t>>(num_variables);
+    parallel_for_range(
+        num_variables,
+        [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; i++) {
+                component_parents[i].store(static_cast<uint32_t>(i), std::memory_order_relaxed);
             }
+        },
+        MIN_VARIABLES_PER_THREAD);
+    parallel_for_range(
+        num_variables,
+        [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; i++) {
+                const auto variable_index = static_cast<uint32_t>(i);
+                for (size_t j = adjacency_offsets[i]; j < adjacency_offsets[i + 1]; j++) {
+                    if (adjacent_variables[j] > variable_index) {
+                        unite_components(variable_index, adjacent_variables[j]);
+                    }
+                }
+            }
+        },
+        MIN_VARIABLES_PER_THREAD);
+
+    std::vector<std::vector<uint32_t>> connected_components;
+    std::vector<uint32_t> component_indices(num_variables, UINT32_MAX);
+    for (uint32_t variable_index = 0; variable_index < num_variables; variable_index++) {
+        if (get_variable_degree(variable_index) == 0) {
+            continue;
+        }
+        // the root of a tree is its smallest variable, so it's seen before any other variable of its component
+        uint32_t root = find_component_root(variable_index);
+        if (component_indices[root] == UINT32_MAX) {
+            component_indices[root] = static_cast<uint32_t>(connected_components.size());
+            connected_components.emplace_back();
         }
+        connected_components[component_indices[root]].emplace_back(variable_index);
     }
     return connected_components;
 }
 
+/**
+ * @brief this method finds all variables that are connected with exactly one other variable
+ * @tparam FF
+ * @return std::vector<uint32_t> sorted indices of the variables with degree one
+ */
+
+template <typename FF> std::vector<uint32_t> Graph_<FF>::find_variables_with_degree_one()
+{
+    std::vector<uint32_t> variables_with_degree_one;
+    for (uint32_t variable_index = 0; variable_index + 1 < adjacency_offsets.size(); variable_index++) {
+        if (get_variable_degree(variable_index) == 1) {
+            variables_with_degree_one.emplace_back(variable_index);
+        }
+    }
+    return variables_with_degree_one;
+}
+
 /**
  * @brief this method removes variables that were created in a function decompose_into_default_range
  * because they are false cases and don't give any useful information about security of the circuit.
@@ -880,10 +1055,10 @@ inline void Graph_<FF>::remove_unnecessary_decompose_variables(bb::UltraCircuitB
 template <typename FF>
 void Graph_<FF>::remove_unnecessary_range_constrains_variables(bb::UltraCircuitBuilder& ultra_builder)
 {
-    std::map<uint64_t, UltraCircuitBuilder::RangeList> range_lists = ultra_builder.range_lists;
+    const auto& range_lists = ultra_builder.range_lists;
     std::unordered_set<uint32_t> range_lists_tau_tags;
     std::unordered_set<uint32_t> range_lists_range_tags;
-    std::vector<uint32_t> real_variable_tags = ultra_builder.real_variable_tags;
+    const std::vector<uint32_t>& real_variable_tags = ultra_builder.real_variable_tags;
     for (const auto& pair : range_lists) {
         UltraCircuitBuilder::RangeList list = pair.second;
         range_lists_tau_tags.insert(list.tau_tag);
@@ -926,9 +1101,9 @@ inline void Graph_<FF>::remove_unnecessary_aes_plookup_variables(std::unordered_
     auto find_position = [&](uint32_t real_variable_index) {
         return variables_in_one_gate.contains(real_variable_index);
     };
-    std::unordered_set<BasicTableId> aes_plookup_tables{ BasicTableId::AES_SBOX_MAP,
-                                                         BasicTableId::AES_SPARSE_MAP,
-                                                         BasicTableId::AES_SPARSE_NORMALIZE };
+    static const std::unordered_set<BasicTableId> aes_plookup_tables{ BasicTableId::AES_SBOX_MAP,
+                                                                      BasicTableId::AES_SPARSE_MAP,
+                                                                      BasicTableId::AES_SPARSE_NORMALIZE };
     auto& lookup_block = ultra_circuit_builder.blocks.lookup;
     if (aes_plookup_tables.contains(table_id)) {
         uint32_t real_out_idx = this->to_real(ultra_circuit_builder, lookup_block.w_o()[gate_index]);
@@ -968,18 +1143,18 @@ inline void Graph_<FF>::remove_unnecessary_sha256_plookup_variables(std::unorder
         return variables_in_one_gate.contains(real_variable_index);
     };
     auto& lookup_block = ultra_circuit_builder.blocks.lookup;
-    std::unordered_set<BasicTableId> sha256_plookup_tables{ BasicTableId::SHA256_WITNESS_SLICE_3,
-                                                            BasicTableId::SHA256_WITNESS_SLICE_7_ROTATE_4,
-                                                            BasicTableId::SHA256_WITNESS_SLICE_8_ROTATE_7,
-                                                            BasicTableId::SHA256_WITNESS_SLICE_14_ROTATE_1,
-                                                            BasicTableId::SHA256_BASE16,
-                                                            BasicTableId::SHA256_BASE16_ROTATE2,
-                                                            BasicTableId::SHA256_BASE16_ROTATE6,
-                                                            BasicTableId::SHA256_BASE16_ROTATE7,
-                                                            BasicTableId::SHA256_BASE16_ROTATE8,
-                                                            BasicTableId::SHA256_BASE28,
-                                                            BasicTableId::SHA256_BASE28_ROTATE3,
-                                                            BasicTableId::SHA256_BASE28_ROTATE6 };
+    static const std::unordered_set<BasicTableId> sha256_plookup_tables{ BasicTableId::SHA256_WITNESS_SLICE_3,
+                                                                         BasicTableId::SHA256_WITNESS_SLICE_7_ROTATE_4,
+                                                                         BasicTableId::SHA256_WITNESS_SLICE_8_ROTATE_7,
+                                                                         BasicTableId::SHA256_WITNESS_SLICE_14_ROTATE_1,
+                                                                         BasicTableId::SHA256_BASE16,
+                                                                         BasicTableId::SHA256_BASE16_ROTATE2,
+                                                                         BasicTableId::SHA256_BASE16_ROTATE6,
+                                                                         BasicTableId::SHA256_BASE16_ROTATE7,
+                                                                         BasicTableId::SHA256_BASE16_ROTATE8,
+                                                                         BasicTableId::SHA256_BASE28,
+                                                                         BasicTableId::SHA256_BASE28_ROTATE3,
+                                                                         BasicTableId::SHA256_BASE28_ROTATE6 };
     if (sha256_plookup_tables.contains(table_id)) {
         uint32_t real_right_idx = this->to_real(ultra_circuit_builder, lookup_block.w_r()[gate_index]);
         uint32_t real_out_idx = this->to_real(ultra_circuit_builder, lookup_block.w_o()[gate_index]);
@@ -1008,55 +1183,47 @@ inline void Graph_<FF>::remove_unnecessary_sha256_plookup_variables(std::unorder
  * if they are not dangerous
  * @tparam FF
  * @param ultra_circuit_builder
- * @param variables_in_one_gate
  * @param gate_index
+ * @param table id and single valued columns of the lookup table used by the gate
  */
 
 template <typename FF>
-inline void Graph_<FF>::process_current_plookup_gate(bb::UltraCircuitBuilder& ultra_circuit_builder, size_t gate_index)
+inline void Graph_<FF>::process_current_plookup_gate(bb::UltraCircuitBuilder& ultra_circuit_builder,
+                                                     size_t gate_index,
+                                                     const LookupTableColumns& table)
 {
     auto find_position = [&](uint32_t real_variable_index) {
         return variables_in_one_gate.contains(real_variable_index);
     };
     auto& lookup_block = ultra_circuit_builder.blocks.lookup;
-    auto& lookup_tables = ultra_circuit_builder.lookup_tables;
-    auto table_index = static_cast<size_t>(lookup_block.q_3()[gate_index]);
-    for (const auto& table : lookup_tables) {
-        if (table.table_index == table_index) {
-            std::unordered_set<bb::fr> column_1(table.column_1.begin(), table.column_1.end());
-            std::unordered_set<bb::fr> column_2(table.column_2.begin(), table.column_2.end());
-            std::unordered_set<bb::fr> column_3(table.column_3.begin(), table.column_3.end());
-            bb::plookup::BasicTableId table_id = table.id;
-            // false cases for AES
-            this->remove_unnecessary_aes_plookup_variables(
-                variables_in_one_gate, ultra_circuit_builder, table_id, gate_index);
-            // false cases for sha256
-            this->remove_unnecessary_sha256_plookup_variables(
-                variables_in_one_gate, ultra_circuit_builder, table_id, gate_index);
-            // if the amount of unique elements from columns of plookup tables = 1, it means that
-            // variable from this column aren't used and we can remove it.
-            if (column_1.size() == 1) {
-                uint32_t left_idx = lookup_block.w_l()[gate_index];
-                uint32_t real_left_idx = this->to_real(ultra_circuit_builder, left_idx);
-                bool find_left = find_position(real_left_idx);
-                if (find_left) {
-                    variables_in_one_gate.erase(real_left_idx);
-                }
-            }
-            if (column_2.size() == 1) {
-                uint32_t real_right_idx = this->to_real(ultra_circuit_builder, lookup_block.w_r()[gate_index]);
-                bool find_right = find_position(real_right_idx);
-                if (find_right) {
-                    variables_in_one_gate.erase(real_right_idx);
-                }
-            }
-            if (column_3.size() == 1) {
-                uint32_t real_out_idx = this->to_real(ultra_circuit_builder, lookup_block.w_o()[gate_index]);
-                bool find_out = find_position(real_out_idx);
-                if (find_out) {
-                    variables_in_one_gate.erase(real_out_idx);
-                }
-            }
+    bb::plookup::BasicTableId table_id = table.id;
+    // false cases for AES
+    this->remove_unnecessary_aes_plookup_variables(variables_in_one_gate, ultra_circuit_builder, table_id, gate_index);
+    // false cases for sha256
+    this->remove_unnecessary_sha256_plookup_variables(
+        variables_in_one_gate, ultra_circuit_builder, table_id, gate_index);
+    // if the amount of unique elements from columns of plookup tables = 1, it means that
+    // variable from this column aren't used and we can remove it.
+    if (table.is_single_valued[0]) {
+        uint32_t left_idx = lookup_block.w_l()[gate_index];
+        uint32_t real_left_idx = this->to_real(ultra_circuit_builder, left_idx);
+        bool find_left = find_position(real_left_idx);
+        if (find_left) {
+            variables_in_one_gate.erase(real_left_idx);
+        }
+    }
+    if (table.is_single_valued[1]) {
+        uint32_t real_right_idx = this->to_real(ultra_circuit_builder, lookup_block.w_r()[gate_index]);
+        bool find_right = find_position(real_right_idx);
+        if (find_right) {
+            variables_in_one_gate.erase(real_right_idx);
+        }
+    }
+    if (table.is_single_valued[2]) {
+        uint32_t real_out_idx = this->to_real(ultra_circuit_builder, lookup_block.w_o()[gate_index]);
+        bool find_out = find_position(real_out_idx);
+        if (find_out) {
+            variables_in_one_gate.erase(real_out_idx);
         }
     }
 }
@@ -1065,7 +1232,7 @@ inline void Graph_<FF>::process_current_plookup_gate(bb::UltraCircuitBuilder& ul
  * @brief this method removes false cases plookup variables from variables in one gate
  * @tparam FF
  * @param ultra_circuit_builder
- * @param variables_in_one_gate
+ * @details The columns of every lookup table are examined once, before the gates are processed
  */
 
 template <typename FF>
@@ -1073,8 +1240,25 @@ inline void Graph_<FF>::remove_unnecessary_plookup_variables(bb::UltraCircuitBui
 {
     auto& lookup_block = ultra_circuit_builder.blocks.lookup;
     if (lookup_block.size() > 0) {
+        auto is_single_valued = [](const auto& column) {
+            return !column.empty() &&
+                   std::all_of(column.begin(), column.end(), [&](const auto& value) { return value == column[0]; });
+        };
+        std::unordered_map<size_t, std::vector<LookupTableColumns>> tables_by_index;
+        for (const auto& table : ultra_circuit_builder.lookup_tables) {
+            tables_by_index[table.table_index].push_back(
+                { table.id,
+                  { is_single_valued(table.column_1),
+                    is_single_valued(table.column_2),
+                    is_single_valued(table.column_3) } });
+        }
         for (size_t i = 0; i < lookup_block.size(); i++) {
-            this->process_current_plookup_gate(ultra_circuit_builder, i);
+            auto table_index = static_cast<size_t>(lookup_block.q_3()[i]);
+            if (auto search = tables_by_index.find(table_index); search != tables_by_index.end()) {
+                for (const auto& table : search->second) {
+                    this->process_current_plookup_gate(ultra_circuit_builder, i, table);
+                }
+            }
         }
     }
 }
@@ -1094,9 +1278,13 @@ template <typename FF> inline void Graph_<FF>::remove_record_witness_variables(b
     std::vector<uint32_t> to_remove;
     ASSERT(blk_idx == 5);
     for (const auto& var_idx : variables_in_one_gate) {
-        KeyPair key = { var_idx, blk_idx };
-        if (auto search = variable_gates.find(key); search != variable_gates.end()) {
-            std::vector<size_t> gate_indexes = variable_gates[key];
+        std::vector<size_t> gate_indexes;
+        for (size_t i = variable_gates_offsets[var_idx]; i < variable_gates_offsets[var_idx + 1]; i++) {
+            if (variable_gates[i].block_index == blk_idx) {
+                gate_indexes.emplace_back(variable_gates[i].gate_index);
+            }
+        }
+        if (!gate_indexes.empty()) {
             ASSERT(gate_indexes.size() == 1);
             size_t gate_idx = gate_indexes[0];
             auto q_1 = block_data[blk_idx].q_1()[gate_idx];
@@ -1131,16 +1319,16 @@ template <typename FF> inline void Graph_<FF>::remove_record_witness_variables(b
 template <typename FF>
 std::unordered_set<uint32_t> Graph_<FF>::show_variables_in_one_gate(bb::UltraCircuitBuilder& ultra_circuit_builder)
 {
-    for (const auto& pair : variables_gate_counts) {
-        bool is_not_constant_variable = this->check_is_not_constant_variable(ultra_circuit_builder, pair.first);
-        if (pair.second == 1 && pair.first != 0 && is_not_constant_variable) {
-            this->variables_in_one_gate.insert(pair.first);
+    for (uint32_t variable_index = 1; variable_index < variables_gate_counts.size(); variable_index++) {
+        if (variables_gate_counts[variable_index] == 1 &&
+            this->check_is_not_constant_variable(ultra_circuit_builder, variable_index)) {
+            this->variables_in_one_gate.insert(variable_index);
         }
     }
-    auto range_lists = ultra_circuit_builder.range_lists;
+    const auto& range_lists = ultra_circuit_builder.range_lists;
     std::unordered_set<uint32_t> decompose_varialbes;
-    for (auto& pair : range_lists) {
-        for (auto& elem : pair.second.variable_indices) {
+    for (const auto& pair : range_lists) {
+        for (const auto& elem : pair.second.variable_indices) {
             bool is_not_constant_variable = this->check_is_not_constant_variable(ultra_circuit_builder, elem);
             if (variables_gate_counts[ultra_circuit_builder.real_variable_index[elem]] == 1 &&
                 is_not_constant_variable) {
@@ -1192,12 +1380,12 @@ std::pair<std::vector<uint32_t>, size_t> get_connected_component_with_index(
 
 template <typename FF> void Graph_<FF>::print_graph()
 {
-    for (const auto& elem : variable_adjacency_lists) {
-        info("variable with index ", elem.first);
-        if (variable_adjacency_lists[elem.first].empty()) {
+    for (uint32_t variable_index = 0; variable_index + 1 < adjacency_offsets.size(); variable_index++) {
+        info("variable with index ", variable_index);
+        if (get_variable_degree(variable_index) == 0) {
             info("is isolated");
         } else {
-            for (const auto& it : elem.second) {
+            for (const auto& it : get_variable_adjacency_list(variable_index)) {
                 info(it);
             }
         }
@@ -1227,8 +1415,8 @@ template <typename FF> void Graph_<FF>::print_connected_components()
 
 template <typename FF> void Graph_<FF>::print_variables_gate_counts()
 {
-    for (const auto& it : variables_gate_counts) {
-        info("number of gates with variables ", it.first, " == ", it.second);
+    for (size_t variable_index = 0; variable_index < variables_gate_counts.size(); variable_index++) {
+        info("number of gates with variables ", variable_index, " == ", variables_gate_counts[variable_index]);
     }
 }
 
@@ -1243,37 +1431,34 @@ template <typename FF>
 void Graph_<FF>::print_variable_in_one_gate(bb::UltraCircuitBuilder& ultra_builder, const uint32_t real_idx)
 {
     const auto& block_data = ultra_builder.blocks.get();
-    for (const auto& [key, gates] : variable_gates) {
-        if (key.first == real_idx) {
-            ASSERT(gates.size() == 1);
-            size_t gate_index = gates[0];
-            UltraBlock block = block_data[key.second];
-            info("gate index == ", gate_index);
-            info("---- printing variables in this gate");
-            info("w_l == ",
-                 block.w_l()[gate_index],
-                 " w_r == ",
-                 block.w_r()[gate_index],
-                 " w_o == ",
-                 block.w_o()[gate_index],
-                 " w_4 == ",
-                 block.w_4()[gate_index]);
-            info("---- printing gate selectors where variable with index ", key.first, " was found ----");
-            info("q_m == ", block.q_m()[gate_index]);
-            info("q_c == ", block.q_c()[gate_index]);
-            info("q_1 == ", block.q_1()[gate_index]);
-            info("q_2 == ", block.q_2()[gate_index]);
-            info("q_3 == ", block.q_3()[gate_index]);
-            info("q_4 == ", block.q_4()[gate_index]);
-            info("q_arith == ", block.q_arith()[gate_index]);
-            info("q_delta_range == ", block.q_delta_range()[gate_index]);
-            info("q_elliptic == ", block.q_elliptic()[gate_index]);
-            info("q_aux == ", block.q_aux()[gate_index]);
-            info("q_lookup_type == ", block.q_lookup_type()[gate_index]);
-            info("q_poseidon2_external == ", block.q_poseidon2_external()[gate_index]);
-            info("q_poseidon2_internal == ", block.q_poseidon2_internal()[gate_index]);
-            info("---- finished printing ----");
-        }
+    for (size_t i = variable_gates_offsets[real_idx]; i < variable_gates_offsets[real_idx + 1]; i++) {
+        size_t gate_index = variable_gates[i].gate_index;
+        auto& block = block_data[variable_gates[i].block_index];
+        info("gate index == ", gate_index);
+        info("---- printing variables in this gate");
+        info("w_l == ",
+             block.w_l()[gate_index],
+             " w_r == ",
+             block.w_r()[gate_index],
+             " w_o == ",
+             block.w_o()[gate_index],
+             " w_4 == ",
+             block.w_4()[gate_index]);
+        info("---- printing gate selectors where variable with index ", real_idx, " was found ----");
+        info("q_m == ", block.q_m()[gate_index]);
+        info("q_c == ", block.q_c()[gate_index]);
+        info("q_1 == ", block.q_1()[gate_index]);
+        info("q_2 == ", block.q_2()[gate_index]);
+        info("q_3 == ", block.q_3()[gate_index]);
+        info("q_4 == ", block.q_4()[gate_index]);
+        info("q_arith == ", block.q_arith()[gate_index]);
+        info("q_delta_range == ", block.q_delta_range()[gate_index]);
+        info("q_elliptic == ", block.q_elliptic()[gate_index]);
+        info("q_aux == ", block.q_aux()[gate_index]);
+        info("q_lookup_type == ", block.q_lookup_type()[gate_index]);
+        info("q_poseidon2_external == ", block.q_poseidon2_external()[gate_index]);
+        info("q_poseidon2_internal == ", block.q_poseidon2_internal()[gate_index]);
+        info("---- finished printing ----");
     }
 }
 
@@ -1,5 +1,7 @@
 #pragma once
 #include "barretenberg/stdlib_circuit_builders/ultra_circuit_builder.hpp"
+#include <array>
+#include <atomic>
 #include <list>
 #include <set>
 #include <typeinfo>
@@ -11,43 +13,6 @@
 namespace cdg {
 
 using UltraBlock = bb::UltraTraceBlock;
-/**
- * We've added a new feature to the static analyzer that tracks which gates contain each variable.
- * This is helpful for removing false-positive variables from the analyzer by using gate selectors
- * combined with additional knowledge about variables (e.g., tau or range tags).
- *
- * This information is stored in an unordered map with keys of type std::pair<uint32_t, size_t>, where:
- * - uint32_t represents the real variable index
- * - size_t represents the index of the UltraTraceBlock in the reference array of TraceBlocks
- *   contained within the Ultra Circuit Builder
- *
- * Since std::unordered_map doesn't provide default hash and equality functions for std::pair keys,
- * we've implemented these ourselves. Our approach is based on the hash_combine function from the
- * Boost library, which efficiently combines hashes of the two elements in the pair.
- */
-using KeyPair = std::pair<uint32_t, size_t>;
-
-struct KeyHasher {
-    size_t operator()(const KeyPair& pair) const
-    {
-        size_t combined_hash = 0;
-        // Golden ratio constant (2^32 / phi) used in hash combining for better distribution
-        constexpr size_t HASH_COMBINE_CONSTANT = 0x9e3779b9;
-        auto hash_combiner = [](size_t lhs, size_t rhs) {
-            return lhs ^ (rhs + HASH_COMBINE_CONSTANT + (lhs << 6) + (lhs >> 2));
-        };
-        combined_hash = hash_combiner(combined_hash, std::hash<uint32_t>()(pair.first));
-        combined_hash = hash_combiner(combined_hash, std::hash<size_t>()(pair.second));
-        return combined_hash;
-    }
-};
-
-struct KeyEquals {
-    bool operator()(const KeyPair& p1, const KeyPair& p2) const
-    {
-        return (p1.first == p2.first && p1.second == p2.second);
-    }
-};
 
 /*
  * This class describes an arithmetic circuit as an undirected graph, where vertices are variables from the circuit.
@@ -59,6 +24,36 @@ struct KeyEquals {
  */
 template <typename FF> class Graph_ {
   public:
+    /**
+     * @brief A gate of the circuit in which a variable was found, given by the index of its block in the builder and
+     * its index in that block
+     */
+    struct VariableGate {
+        uint32_t variable_index;
+        uint32_t block_index;
+        uint32_t gate_index;
+    };
+
+    /**
+     * @brief Edges, variable gates and fixed witnesses collected from a contiguous range of gates. Ranges of a block
+     * are processed in parallel and their records are merged in gate order, so the graph doesn't depend on the
+     * number of threads.
+     */
+    struct GateRecords {
+        std::vector<std::pair<uint32_t, uint32_t>> edges;
+        std::vector<VariableGate> variable_gates;
+        std::vector<uint32_t> fixed_variables;
+    };
+
+    /**
+     * @brief The id of a lookup table used by the circuit together with the columns of this table that contain only
+     * one value
+     */
+    struct LookupTableColumns {
+        bb::plookup::BasicTableId id;
+        std::array<bool, 3> is_single_valued;
+    };
+
     Graph_() = default;
     Graph_(const Graph_& other) = delete;
     Graph_(Graph_&& other) = delete;
@@ -91,45 +86,67 @@ template <typename FF> class Graph_ {
     void process_gate_variables(bb::UltraCircuitBuilder& ultra_circuit_constructor,
                                 std::vector<uint32_t>& gate_variables,
                                 size_t gate_index,
-                                size_t blk_idx);
-    std::unordered_map<uint32_t, size_t> get_variables_gate_counts() { return this->variables_gate_counts; };
-
+                                size_t blk_idx,
+                                GateRecords& records);
+    std::unordered_map<uint32_t, size_t> get_variables_gate_counts();
+
+    void process_gates(bb::UltraCircuitBuilder& ultra_circuit_builder,
+                       size_t block_idx,
+                       UltraBlock& blk,
+                       size_t start,
+                       size_t end,
+                       GateRecords& records);
     std::vector<std::vector<uint32_t>> get_arithmetic_gate_connected_component(
-        bb::UltraCircuitBuilder& ultra_circuit_builder, size_t index, size_t block_idx, UltraBlock& blk);
+        bb::UltraCircuitBuilder& ultra_circuit_builder,
+        size_t index,
+        size_t block_idx,
+        UltraBlock& blk,
+        GateRecords& records);
     std::vector<uint32_t> get_elliptic_gate_connected_component(bb::UltraCircuitBuilder& ultra_circuit_builder,
                                                                 size_t index,
                                                                 size_t block_idx,
-                                                                UltraBlock& blk);
+                                                                UltraBlock& blk,
+                                                                GateRecords& records);
     std::vector<uint32_t> get_plookup_gate_connected_component(bb::UltraCircuitBuilder& ultra_circuit_builder,
                                                                size_t index,
                                                                size_t block_idx,
-                                                               UltraBlock& blk);
+                                                               UltraBlock& blk,
+                                                               GateRecords& records);
     std::vector<uint32_t> get_sort_constraint_connected_component(bb::UltraCircuitBuilder& ultra_circuit_builder,
                                                                   size_t index,
                                                                   size_t block_idx,
-                                                                  UltraBlock& blk);
+                                                                  UltraBlock& blk,
+                                                                  GateRecords& records);
     std::vector<uint32_t> get_poseido2s_gate_connected_component(bb::UltraCircuitBuilder& ultra_circuit_builder,
                                                                  size_t index,
                                                                  size_t block_idx,
-                                                                 UltraBlock& blk);
+                                                                 UltraBlock& blk,
+                                                                 GateRecords& records);
     std::vector<uint32_t> get_auxiliary_gate_connected_component(bb::UltraCircuitBuilder& ultra_circuit_builder,
                                                                  size_t index,
                                                                  size_t block_idx,
-                                                                 UltraBlock& blk);
+                                                                 UltraBlock& blk,
+                                                                 GateRecords& records);
     std::vector<uint32_t> get_rom_table_connected_component(bb::UltraCircuitBuilder& ultra_circuit_builder,
-                                                            const bb::UltraCircuitBuilder::RomTranscript& rom_array);
+                                                            const bb::UltraCircuitBuilder::RomTranscript& rom_array,
+                                                            GateRecords& records);
     std::vector<uint32_t> get_ram_table_connected_component(bb::UltraCircuitBuilder& ultra_builder,
-                                                            const bb::UltraCircuitBuilder::RamTranscript& ram_array);
+                                                            const bb::UltraCircuitBuilder::RamTranscript& ram_array,
+                                                            GateRecords& records);
 
-    void add_new_edge(const uint32_t& first_variable_index, const uint32_t& second_variable_index);
+    void build_graph(size_t num_variables, const std::vector<GateRecords>& all_records);
     std::vector<uint32_t> get_variable_adjacency_list(const uint32_t& variable_index)
     {
-        return variable_adjacency_lists[variable_index];
+        return { adjacent_variables.begin() + static_cast<std::ptrdiff_t>(adjacency_offsets[variable_index]),
+                 adjacent_variables.begin() + static_cast<std::ptrdiff_t>(adjacency_offsets[variable_index + 1]) };
+    };
+    size_t get_variable_degree(const uint32_t& variable_index) const
+    {
+        return adjacency_offsets[variable_index + 1] - adjacency_offsets[variable_index];
     };
 
-    void depth_first_search(const uint32_t& variable_index,
-                            std::unordered_set<uint32_t>& is_used,
-                            std::vector<uint32_t>& connected_component);
+    uint32_t find_component_root(uint32_t variable_index);
+    void unite_components(uint32_t first_variable_index, uint32_t second_variable_index);
     std::vector<std::vector<uint32_t>> find_connected_components();
 
     std::vector<uint32_t> find_variables_with_degree_one();
@@ -145,7 +162,8 @@ template <typename FF> class Graph_ {
                                              const uint32_t& var_index);
 
     void connect_all_variables_in_vector(bb::UltraCircuitBuilder& ultra_circuit_builder,
-                                         const std::vector<uint32_t>& variables_vector);
+                                         const std::vector<uint32_t>& variables_vector,
+                                         GateRecords& records);
     bool check_is_not_constant_variable(bb::UltraCircuitBuilder& ultra_circuit_builder, const uint32_t& variable_index);
 
     std::pair<std::vector<uint32_t>, size_t> get_connected_component_with_index(
@@ -157,7 +175,9 @@ template <typename FF> class Graph_ {
     size_t process_current_decompose_chain(bb::UltraCircuitBuilder& ultra_circuit_constructor,
                                            std::unordered_set<uint32_t>& variables_in_one_gate,
                                            size_t index);
-    void process_current_plookup_gate(bb::UltraCircuitBuilder& ultra_circuit_builder, size_t gate_index);
+    void process_current_plookup_gate(bb::UltraCircuitBuilder& ultra_circuit_builder,
+                                      size_t gate_index,
+                                      const LookupTableColumns& table);
     void remove_unnecessary_decompose_variables(bb::UltraCircuitBuilder& ultra_circuit_builder,
                                                 std::unordered_set<uint32_t>& variables_in_on_gate,
                                                 const std::unordered_set<uint32_t>& decompose_variables);
@@ -183,16 +203,17 @@ template <typename FF> class Graph_ {
     ~Graph_() = default;
 
   private:
-    std::unordered_map<uint32_t, std::vector<uint32_t>>
-        variable_adjacency_lists; // we use this data structure to contain information about variables and their
-                                  // connections between each other
-    std::unordered_map<uint32_t, size_t>
-        variables_gate_counts; // we use this data structure to count, how many gates use every variable
-    std::unordered_map<uint32_t, size_t>
-        variables_degree; // we use this data structure to count, how many every variable have edges
-    std::unordered_map<KeyPair, std::vector<size_t>, KeyHasher, KeyEquals>
-        variable_gates; // we use this data structure to store gates and TraceBlocks for every variables, where static
-                        // analyzer found them in the circuit.
+    // The graph is stored in compressed sparse row form: variables adjacent to the variable i are
+    // adjacent_variables[adjacency_offsets[i]], ..., adjacent_variables[adjacency_offsets[i + 1] - 1]
+    std::vector<size_t> adjacency_offsets;
+    std::vector<uint32_t> adjacent_variables;
+    std::vector<size_t> variables_gate_counts; // we use this data structure to count, how many gates use every variable
+    // Gates where static analyzer found the variable i are stored in the same form in variable_gates
+    std::vector<size_t> variable_gates_offsets;
+    std::vector<VariableGate> variable_gates;
+    std::vector<std::atomic<uint32_t>> component_parents; // union-find forest used to find connected components
+    std::vector<bool> is_constant_variable;
+    std::vector<uint32_t> real_variable_indices;
     std::unordered_set<uint32_t> variables_in_one_gate;
     std::unordered_set<uint32_t> fixed_variables;
 };
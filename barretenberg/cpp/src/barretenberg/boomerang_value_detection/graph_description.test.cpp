@@ -697,4 +697,43 @@ TEST(boomerang_ultra_circuit_constructor, composed_range_constraint)
     Graph graph = Graph(circuit_constructor);
     auto connected_components = graph.find_connected_components();
     EXPECT_EQ(connected_components.size(), 1);
-}
\ No newline at end of file
+}
+/**
+ * @brief Test graph description of a circuit whose blocks are large enough to be processed in several ranges
+ *
+ * @details This test verifies that:
+ * - Every big addition gate creates its own connected component, whose variables form a path a - b - c - d
+ * - A sort constraint spanning many delta range gates creates one connected component, whose variables also form a
+ *   path
+ * - The ends of all these paths are the only variables with degree one
+ */
+TEST(boomerang_ultra_circuit_constructor, test_graph_for_large_circuit)
+{
+    UltraCircuitBuilder circuit_constructor = UltraCircuitBuilder();
+    const size_t num_gates = 1 << 12;
+    std::vector<uint32_t> path_ends;
+    for (size_t i = 0; i < num_gates; ++i) {
+        uint32_t a_idx = circuit_constructor.add_variable(fr(i));
+        uint32_t b_idx = circuit_constructor.add_variable(fr(i + 1));
+        uint32_t c_idx = circuit_constructor.add_variable(fr(i + 2));
+        uint32_t d_idx = circuit_constructor.add_variable(fr(3 * i + 3));
+        circuit_constructor.create_big_add_gate({ a_idx, b_idx, c_idx, d_idx, fr(1), fr(1), fr(1), fr(-1), fr(0) });
+        path_ends.insert(path_ends.end(), { a_idx, d_idx });
+    }
+    const size_t num_sorted_variables = 1 << 13;
+    std::vector<uint32_t> sorted_variables;
+    for (size_t i = 0; i < num_sorted_variables; ++i) {
+        sorted_variables.emplace_back(circuit_constructor.add_variable(fr(i / 3)));
+    }
+    circuit_constructor.create_sort_constraint(sorted_variables);
+    path_ends.insert(path_ends.end(), { sorted_variables.front(), sorted_variables.back() });
+
+    Graph graph = Graph(circuit_constructor);
+    auto connected_components = graph.find_connected_components();
+    EXPECT_EQ(connected_components.size(), num_gates + 1);
+    for (size_t i = 0; i < num_gates; ++i) {
+        EXPECT_EQ(connected_components[i].size(), 4);
+    }
+    EXPECT_EQ(connected_components.back().size(), num_sorted_variables);
+    EXPECT_EQ(graph.find_variables_with_degree_one(), path_ends);
+}
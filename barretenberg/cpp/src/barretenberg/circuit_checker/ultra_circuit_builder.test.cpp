@@ -118,6 +118,61 @@ TEST(UltraCircuitBuilder, BadLookupFailure)
     EXPECT_FALSE(CircuitChecker::check(builder));
 }
 
+/**
+ * @brief Check that lookups are checked against the tables of the circuit being checked, even if an earlier check saw
+ * a table with the same id and size
+ */
+TEST(UltraCircuitBuilder, BadLookupTableAfterGoodCheck)
+{
+    UltraCircuitBuilder builder;
+    MockCircuits::add_lookup_gates(builder);
+    EXPECT_TRUE(CircuitChecker::check(builder));
+
+    // Change the entries of a table without changing its id or size
+    UltraCircuitBuilder bad_builder{ builder };
+    ASSERT_FALSE(bad_builder.lookup_tables.empty());
+    for (auto& value : bad_builder.lookup_tables[0].column_3) {
+        value += 1;
+    }
+
+    EXPECT_FALSE(CircuitChecker::check(bad_builder));
+}
+
+/**
+ * @brief Check that failures are caught in blocks large enough for their rows to be checked across several threads
+ */
+TEST(UltraCircuitBuilder, BadGatesInLargeBlock)
+{
+    UltraCircuitBuilder builder;
+    MockCircuits::construct_arithmetic_circuit(builder, /*target_log2_dyadic_size=*/14);
+    MockCircuits::add_lookup_gates(builder);
+    EXPECT_TRUE(CircuitChecker::check(builder));
+
+    // Break a gate towards the end of the arithmetic block
+    {
+        UltraCircuitBuilder bad_builder{ builder };
+        auto& block = bad_builder.blocks.arithmetic;
+        block.q_c()[block.size() - 2] += 1;
+        EXPECT_FALSE(CircuitChecker::check(bad_builder));
+    }
+
+    // Break gates at both ends of the arithmetic block
+    {
+        UltraCircuitBuilder bad_builder{ builder };
+        auto& block = bad_builder.blocks.arithmetic;
+        block.q_c()[1] += 1;
+        block.q_c()[block.size() - 2] += 1;
+        EXPECT_FALSE(CircuitChecker::check(bad_builder));
+    }
+
+    // Point a lookup gate at a table that does not exist
+    {
+        UltraCircuitBuilder bad_builder{ builder };
+        bad_builder.blocks.lookup.q_3()[0] = fr(bad_builder.lookup_tables.size());
+        EXPECT_FALSE(CircuitChecker::check(bad_builder));
+    }
+}
+
 TEST(UltraCircuitBuilder, BaseCase)
 {
     UltraCircuitBuilder builder = UltraCircuitBuilder();
@@ -871,6 +926,77 @@ TEST(UltraCircuitBuilder, RangeChecksOnDuplicates)
     EXPECT_EQ(result, true);
 }
 
+/**
+ * @brief Check that circuits constructed independently and spliced into a main circuit yield a valid circuit
+ * @details The fragments use shared variables, copy constraints, constants, range constraints (including a range that
+ * the main circuit also uses) and a lookup table that has a different table index in the main circuit.
+ */
+TEST(UltraCircuitBuilder, AppendFragment)
+{
+    UltraCircuitBuilder builder;
+    const uint32_t a = builder.add_variable(100);
+    const uint32_t b = builder.add_variable(200);
+    builder.create_add_gate({ a, b, builder.zero_idx, 1, -1, 0, 100 });
+    builder.create_new_range_constraint(a, 1000);
+    // Occupy the first table index of the main circuit with a table the fragments do not use
+    const fr left(5);
+    const fr right(7);
+    const auto left_idx = builder.add_variable(left);
+    const auto right_idx = builder.add_variable(right);
+    const auto accumulators =
+        plookup::get_lookup_accumulators(plookup::MultiTableId::UINT32_AND, left, right, /*is_2_to_1_lookup*/ true);
+    builder.create_gates_from_plookup_accumulators(
+        plookup::MultiTableId::UINT32_AND, accumulators, left_idx, right_idx);
+
+    const auto build_fragment = [&](const std::vector<fr>& shared_values) {
+        UltraCircuitBuilder fragment(0, shared_values, {}, shared_values.size());
+        const uint32_t x = 0;
+        const uint32_t y = 1;
+        const uint32_t sum = fragment.add_variable(fragment.get_variable(x) + fragment.get_variable(y));
+        fragment.create_add_gate({ x, y, sum, 1, 1, -1, 0 });
+        fragment.create_new_range_constraint(x, 1000);
+        fragment.create_new_range_constraint(sum, 5000);
+        fragment.decompose_into_default_range(sum, 20);
+        const uint32_t sum_copy = fragment.add_variable(fragment.get_variable(sum));
+        fragment.assert_equal(sum, sum_copy);
+        const uint32_t seven = fragment.put_constant_variable(7);
+        fragment.create_add_gate({ sum_copy, seven, fragment.zero_idx, 0, 0, 0, 0 });
+        MockCircuits::add_lookup_gates(fragment);
+        MockCircuits::add_arithmetic_gates(fragment);
+        return fragment;
+    };
+
+    for (size_t i = 0; i < 2; ++i) {
+        const auto fragment = build_fragment({ builder.get_variable(a), builder.get_variable(b) });
+        EXPECT_TRUE(fragment.is_appendable_fragment());
+        const std::array<uint32_t, 2> shared_variables{ a, b };
+        builder.append_fragment(fragment, shared_variables);
+    }
+    EXPECT_FALSE(builder.failed());
+    EXPECT_EQ(builder.lookup_tables.size(), 4); // UINT32_AND and UINT32_XOR, each with two basic tables
+    EXPECT_TRUE(CircuitChecker::check(builder));
+
+    // The gates fixing the zero of each fragment are dropped in favour of the one fixing the zero of the main circuit
+    auto& arithmetic = builder.blocks.arithmetic;
+    size_t num_zero_gates = 0;
+    for (size_t row = 0; row < arithmetic.size(); ++row) {
+        bool is_zero_gate = arithmetic.q_arith()[row] == 1 && arithmetic.q_1()[row] == 1 && arithmetic.q_c()[row] == 0;
+        for (const auto& wire : arithmetic.wires) {
+            is_zero_gate &= wire[row] == builder.zero_idx;
+        }
+        num_zero_gates += is_zero_gate ? 1 : 0;
+    }
+    EXPECT_EQ(num_zero_gates, 1);
+
+    // A fragment whose constraints are not satisfied by the shared values invalidates the main circuit
+    const uint32_t c = builder.add_variable(2000);
+    const auto bad_fragment = build_fragment({ builder.get_variable(c), builder.get_variable(b) });
+    const std::array<uint32_t, 2> shared_variables{ c, b };
+    builder.append_fragment(bad_fragment, shared_variables);
+    EXPECT_TRUE(builder.failed());
+    EXPECT_FALSE(CircuitChecker::check(builder));
+}
+
 TEST(UltraCircuitBuilder, CheckCircuitShowcase)
 {
     UltraCircuitBuilder builder = UltraCircuitBuilder();
@@ -1,5 +1,9 @@
 #include "ultra_circuit_checker.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/flavor/mega_flavor.hpp"
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
 #include <unordered_set>
 
 namespace bb {
@@ -20,23 +24,28 @@ template <typename Builder> bool UltraCircuitChecker::check(const Builder& build
     Builder builder{ builder_in };
     builder.finalize_circuit(/*ensure_nonzero=*/true); // Test the ensure_nonzero gates as well
 
-    // Construct a hash table for lookup table entries to efficiently determine if a lookup gate is valid
-    LookupHashTable lookup_hash_table;
+    // Gather an index of the entries of each lookup table to efficiently determine if a lookup gate is valid. Every
+    // table has its own table_index, so the indices are built in parallel, one table per task.
+    LookupIndices lookup_indices;
     for (const auto& table : builder.lookup_tables) {
-        const FF table_index(table.table_index);
-        for (size_t i = 0; i < table.size(); ++i) {
-            lookup_hash_table.insert({ table.column_1[i], table.column_2[i], table.column_3[i], table_index });
+        if (table.table_index >= lookup_indices.size()) {
+            lookup_indices.resize(table.table_index + 1);
         }
     }
+    parallel_for(builder.lookup_tables.size(), [&](size_t i) {
+        const auto& table = builder.lookup_tables[i];
+        lookup_indices[table.table_index] = std::make_unique<const LookupIndex>(table);
+    });
 
     // Instantiate structs used for checking tag and memory record correctness
     TagCheckData tag_data;
+    tag_data.encountered_variables.resize(builder.real_variable_tags.size(), false);
     MemoryCheckData memory_data{ builder };
 
     bool result = true;
     size_t block_idx = 0;
     for (auto& block : builder.blocks.get()) {
-        result = result && check_block(builder, block, tag_data, memory_data, lookup_hash_table);
+        result = result && check_block(builder, block, tag_data, memory_data, lookup_indices);
         if (!result) {
             info("Failed at block idx = ", block_idx);
             return false;
@@ -70,85 +79,100 @@ template <typename Builder>
 bool UltraCircuitChecker::check_block(Builder& builder,
                                       auto& block,
                                       TagCheckData& tag_data,
-                                      MemoryCheckData& memory_data,
-                                      LookupHashTable& lookup_hash_table)
+                                      const MemoryCheckData& memory_data,
+                                      const LookupIndices& lookup_indices)
 {
-    // Initialize empty AllValues of the correct Flavor based on Builder type; for input to Relation::accumulate
-    auto values = init_empty_values<Builder>();
-    Params params;
-    params.eta = memory_data.eta; // used in Auxiliary relation for RAM/ROM consistency
-    params.eta_two = memory_data.eta_two;
-    params.eta_three = memory_data.eta_three;
-
-    auto report_fail = [&](const char* message, size_t row_idx) {
-        info(message, row_idx);
+    // Rows are checked independently so we shard them across threads. The first (lowest) failing row is tracked so
+    // that rows beyond it can be skipped and the reported failure does not depend on the thread schedule.
+    constexpr size_t MIN_ROWS_FOR_MULTITHREADING = 1024;
+    std::atomic<size_t> first_failed_row = block.size();
+    const char* failure_message = nullptr;
+    std::mutex failure_mutex;
+
+    parallel_for_range(
+        block.size(),
+        [&](size_t start, size_t end) {
+            // Initialize empty AllValues of the correct Flavor based on Builder type; for input to Relation::accumulate
+            auto values = init_empty_values<Builder>();
+            Params params;
+            params.eta = memory_data.eta; // used in Auxiliary relation for RAM/ROM consistency
+            params.eta_two = memory_data.eta_two;
+            params.eta_three = memory_data.eta_three;
+
+            for (size_t idx = start; idx < end && idx < first_failed_row.load(std::memory_order_relaxed); ++idx) {
+                populate_values(builder, block, values, memory_data, idx);
+                const char* message = check_row(builder, values, params, lookup_indices);
+                if (message != nullptr) {
+                    std::lock_guard<std::mutex> lock(failure_mutex);
+                    if (idx < first_failed_row.load(std::memory_order_relaxed)) {
+                        first_failed_row.store(idx, std::memory_order_relaxed);
+                        failure_message = message;
+                    }
+                    return;
+                }
+            }
+        },
+        MIN_ROWS_FOR_MULTITHREADING);
+
+    if (failure_message != nullptr) {
+        const size_t row_idx = first_failed_row.load();
+        info(failure_message, row_idx);
 #ifdef CHECK_CIRCUIT_STACKTRACES
         block.stack_traces.print(row_idx);
 #endif
         return false;
-    };
-
-    // Perform checks on each gate defined in the builder
-    bool result = true;
-    for (size_t idx = 0; idx < block.size(); ++idx) {
+    }
 
-        populate_values(builder, block, values, tag_data, memory_data, idx);
+    update_tag_check_data(builder, block, tag_data, memory_data);
+    return true;
+};
 
-        result = result && check_relation<Arithmetic>(values, params);
-        if (!result) {
-            return report_fail("Failed Arithmetic relation at row idx = ", idx);
-        }
-        result = result && check_relation<Elliptic>(values, params);
-        if (!result) {
-            return report_fail("Failed Elliptic relation at row idx = ", idx);
-        }
+template <typename Builder>
+const char* UltraCircuitChecker::check_row(Builder& builder,
+                                           auto& values,
+                                           auto& params,
+                                           const LookupIndices& lookup_indices)
+{
+    if (!check_relation<Arithmetic>(values, params)) {
+        return "Failed Arithmetic relation at row idx = ";
+    }
+    if (!check_relation<Elliptic>(values, params)) {
+        return "Failed Elliptic relation at row idx = ";
+    }
 #ifndef ULTRA_FUZZ
-        result = result && check_relation<Auxiliary>(values, params);
-        if (!result) {
-            return report_fail("Failed Auxiliary relation at row idx = ", idx);
-        }
-        result = result && check_relation<DeltaRangeConstraint>(values, params);
-        if (!result) {
-            return report_fail("Failed DeltaRangeConstraint relation at row idx = ", idx);
-        }
+    if (!check_relation<Auxiliary>(values, params)) {
+        return "Failed Auxiliary relation at row idx = ";
+    }
+    if (!check_relation<DeltaRangeConstraint>(values, params)) {
+        return "Failed DeltaRangeConstraint relation at row idx = ";
+    }
 #else
-        // Bigfield related auxiliary gates
-        if (values.q_aux == 1) {
-            bool f0 = values.q_o == 1 && (values.q_4 == 1 || values.q_m == 1);
-            bool f1 = values.q_r == 1 && (values.q_o == 1 || values.q_4 == 1 || values.q_m == 1);
-            if (f0 && f1) {
-                result = result && check_relation<Auxiliary>(values, params);
-                if (!result) {
-                    return report_fail("Failed Non Native Auxiliary relation at row idx = ", idx);
-                }
+    // Bigfield related auxiliary gates
+    if (values.q_aux == 1) {
+        bool f0 = values.q_o == 1 && (values.q_4 == 1 || values.q_m == 1);
+        bool f1 = values.q_r == 1 && (values.q_o == 1 || values.q_4 == 1 || values.q_m == 1);
+        if (f0 && f1) {
+            if (!check_relation<Auxiliary>(values, params)) {
+                return "Failed Non Native Auxiliary relation at row idx = ";
             }
         }
+    }
 #endif
-        result = result && check_lookup(values, lookup_hash_table);
-        if (!result) {
-            return report_fail("Failed Lookup check relation at row idx = ", idx);
-        }
-        result = result && check_relation<PoseidonInternal>(values, params);
-        if (!result) {
-            return report_fail("Failed PoseidonInternal relation at row idx = ", idx);
-        }
-        result = result && check_relation<PoseidonExternal>(values, params);
-        if (!result) {
-            return report_fail("Failed PoseidonExternal relation at row idx = ", idx);
-        }
-
-        if constexpr (IsMegaBuilder<Builder>) {
-            result = result && check_databus_read(values, builder);
-            if (!result) {
-                return report_fail("Failed databus read at row idx = ", idx);
-            }
-        }
-        if (!result) {
-            return report_fail("Failed at row idx = ", idx);
+    if (!check_lookup(values, lookup_indices)) {
+        return "Failed Lookup check relation at row idx = ";
+    }
+    if (!check_relation<PoseidonInternal>(values, params)) {
+        return "Failed PoseidonInternal relation at row idx = ";
+    }
+    if (!check_relation<PoseidonExternal>(values, params)) {
+        return "Failed PoseidonExternal relation at row idx = ";
+    }
+    if constexpr (IsMegaBuilder<Builder>) {
+        if (!check_databus_read(values, builder)) {
+            return "Failed databus read at row idx = ";
         }
     }
-
-    return result;
+    return nullptr;
 };
 
 template <typename Relation> bool UltraCircuitChecker::check_relation(auto& values, auto& params)
@@ -172,18 +196,64 @@ template <typename Relation> bool UltraCircuitChecker::check_relation(auto& valu
     return true;
 }
 
-bool UltraCircuitChecker::check_lookup(auto& values, auto& lookup_hash_table)
+bool UltraCircuitChecker::check_lookup(auto& values, const LookupIndices& lookup_indices)
 {
-    // If this is a lookup gate, check the inputs are in the hash table containing all table entries
+    // If this is a lookup gate, check the inputs are in the table the gate refers to
     if (!values.q_lookup.is_zero()) {
-        return lookup_hash_table.contains({ values.w_l + values.q_r * values.w_l_shift,
-                                            values.w_r + values.q_m * values.w_r_shift,
-                                            values.w_o + values.q_c * values.w_o_shift,
-                                            values.q_o });
+        const uint256_t table_index(values.q_o);
+        if (table_index >= lookup_indices.size()) {
+            return false;
+        }
+        const auto& index = lookup_indices[static_cast<size_t>(table_index)];
+        return index != nullptr && index->contains({ values.w_l + values.q_r * values.w_l_shift,
+                                                     values.w_r + values.q_m * values.w_r_shift,
+                                                     values.w_o + values.q_c * values.w_o_shift });
     }
     return true;
 };
 
+UltraCircuitChecker::LookupIndex::LookupIndex(const plookup::BasicTable& table)
+    : num_entries(table.size())
+{
+    // Keep the load factor at or below 1/2 so probe sequences stay short
+    const size_t capacity = std::max(numeric::round_up_power_2(2 * num_entries), size_t(2));
+    slots.resize(capacity);
+    occupied.resize(capacity, false);
+    mask = capacity - 1;
+    for (size_t i = 0; i < num_entries; ++i) {
+        const Entry entry{ table.column_1[i], table.column_2[i], table.column_3[i] };
+        size_t slot = hash(entry) & mask;
+        while (occupied[slot] && slots[slot] != entry) {
+            slot = (slot + 1) & mask;
+        }
+        slots[slot] = entry;
+        occupied[slot] = true;
+    }
+}
+
+bool UltraCircuitChecker::LookupIndex::contains(const Entry& entry) const
+{
+    size_t slot = hash(entry) & mask;
+    while (occupied[slot]) {
+        if (slots[slot] == entry) {
+            return true;
+        }
+        slot = (slot + 1) & mask;
+    }
+    return false;
+}
+
+size_t UltraCircuitChecker::LookupIndex::hash(const Entry& entry)
+{
+    // Mix the low limbs of the (reduced) components; table entries are mostly small so the low limb carries the entropy
+    uint64_t result = 0;
+    for (const auto& component : entry) {
+        result = (result ^ component.reduce_once().data[0]) * 0x9e3779b97f4a7c15ULL;
+        result ^= result >> 29;
+    }
+    return static_cast<size_t>(result);
+}
+
 template <typename Builder> bool UltraCircuitChecker::check_databus_read(auto& values, Builder& builder)
 {
     if (!values.q_busread.is_zero()) {
@@ -222,72 +292,42 @@ bool UltraCircuitChecker::check_tag_data(const TagCheckData& tag_data)
 };
 
 template <typename Builder>
-void UltraCircuitChecker::populate_values(
-    Builder& builder, auto& block, auto& values, TagCheckData& tag_data, MemoryCheckData& memory_data, size_t idx)
+UltraCircuitChecker::FF UltraCircuitChecker::get_w_4(Builder& builder,
+                                                     auto& block,
+                                                     const MemoryCheckData& memory_data,
+                                                     size_t idx)
 {
-    // Function to quickly update tag products and encountered variable set by index and value
-    auto update_tag_check_data = [&](const size_t variable_index, const FF& value) {
-        size_t real_index = builder.real_variable_index[variable_index];
-        // Check to ensure that we are not including a variable twice
-        if (tag_data.encountered_variables.contains(real_index)) {
-            return;
-        }
-        uint32_t tag_in = builder.real_variable_tags[real_index];
-        if (tag_in != DUMMY_TAG) {
-            uint32_t tag_out = builder.tau.at(tag_in);
-            tag_data.left_product *= value + tag_data.gamma * FF(tag_in);
-            tag_data.right_product *= value + tag_data.gamma * FF(tag_out);
-            tag_data.encountered_variables.insert(real_index);
+    // Note: memory_data contains indices into the block to which RAM/ROM gates were added so we need to check that
+    // we are indexing into the correct block before computing a memory record
+    if (block.has_ram_rom) {
+        const bool is_read = memory_data.read_record_gates.contains(idx);
+        if (is_read || memory_data.write_record_gates.contains(idx)) {
+            // Memory record term of the form w3 * eta_three + w2 * eta_two + w1 * eta (+ 1 for writes)
+            FF record = builder.get_variable(block.w_o()[idx]) * memory_data.eta_three +
+                        builder.get_variable(block.w_r()[idx]) * memory_data.eta_two +
+                        builder.get_variable(block.w_l()[idx]) * memory_data.eta;
+            return is_read ? record : record + FF::one();
         }
-    };
-
-    // A lambda function for computing a memory record term of the form w3 * eta_three + w2 * eta_two + w1 * eta
-    auto compute_memory_record_term =
-        [](const FF& w_1, const FF& w_2, const FF& w_3, const FF& eta, const FF& eta_two, FF& eta_three) {
-            return (w_3 * eta_three + w_2 * eta_two + w_1 * eta);
-        };
+    }
+    return builder.get_variable(block.w_4()[idx]);
+}
 
+template <typename Builder>
+void UltraCircuitChecker::populate_values(
+    Builder& builder, auto& block, auto& values, const MemoryCheckData& memory_data, size_t idx)
+{
     // Set wire values. Wire 4 is treated specially since it may contain memory records
     values.w_l = builder.get_variable(block.w_l()[idx]);
     values.w_r = builder.get_variable(block.w_r()[idx]);
     values.w_o = builder.get_variable(block.w_o()[idx]);
-    // Note: memory_data contains indices into the block to which RAM/ROM gates were added so we need to check that
-    // we are indexing into the correct block before updating the w_4 value.
-    if (block.has_ram_rom && memory_data.read_record_gates.contains(idx)) {
-        values.w_4 = compute_memory_record_term(
-            values.w_l, values.w_r, values.w_o, memory_data.eta, memory_data.eta_two, memory_data.eta_three);
-    } else if (block.has_ram_rom && memory_data.write_record_gates.contains(idx)) {
-        values.w_4 =
-            compute_memory_record_term(
-                values.w_l, values.w_r, values.w_o, memory_data.eta, memory_data.eta_two, memory_data.eta_three) +
-            FF::one();
-    } else {
-        values.w_4 = builder.get_variable(block.w_4()[idx]);
-    }
+    values.w_4 = get_w_4(builder, block, memory_data, idx);
 
     // Set shifted wire values. Again, wire 4 is treated specially. On final row, set shift values to zero
     if (idx < block.size() - 1) {
         values.w_l_shift = builder.get_variable(block.w_l()[idx + 1]);
         values.w_r_shift = builder.get_variable(block.w_r()[idx + 1]);
         values.w_o_shift = builder.get_variable(block.w_o()[idx + 1]);
-        if (block.has_ram_rom && memory_data.read_record_gates.contains(idx + 1)) {
-            values.w_4_shift = compute_memory_record_term(values.w_l_shift,
-                                                          values.w_r_shift,
-                                                          values.w_o_shift,
-                                                          memory_data.eta,
-                                                          memory_data.eta_two,
-                                                          memory_data.eta_three);
-        } else if (block.has_ram_rom && memory_data.write_record_gates.contains(idx + 1)) {
-            values.w_4_shift = compute_memory_record_term(values.w_l_shift,
-                                                          values.w_r_shift,
-                                                          values.w_o_shift,
-                                                          memory_data.eta,
-                                                          memory_data.eta_two,
-                                                          memory_data.eta_three) +
-                               FF::one();
-        } else {
-            values.w_4_shift = builder.get_variable(block.w_4()[idx + 1]);
-        }
+        values.w_4_shift = get_w_4(builder, block, memory_data, idx + 1);
     } else {
         values.w_l_shift = 0;
         values.w_r_shift = 0;
@@ -295,12 +335,6 @@ void UltraCircuitChecker::populate_values(
         values.w_4_shift = 0;
     }
 
-    // Update tag check data
-    update_tag_check_data(block.w_l()[idx], values.w_l);
-    update_tag_check_data(block.w_r()[idx], values.w_r);
-    update_tag_check_data(block.w_o()[idx], values.w_o);
-    update_tag_check_data(block.w_4()[idx], values.w_4);
-
     // Set selector values
     values.q_m = block.q_m()[idx];
     values.q_c = block.q_c()[idx];
@@ -320,6 +354,36 @@ void UltraCircuitChecker::populate_values(
     }
 }
 
+template <typename Builder>
+void UltraCircuitChecker::update_tag_check_data(Builder& builder,
+                                                auto& block,
+                                                TagCheckData& tag_data,
+                                                const MemoryCheckData& memory_data)
+{
+    // Function to quickly update tag products and encountered variable set by index and value
+    auto update = [&](const size_t variable_index, const FF& value) {
+        size_t real_index = builder.real_variable_index[variable_index];
+        // Check to ensure that we are not including a variable twice
+        if (tag_data.encountered_variables[real_index]) {
+            return;
+        }
+        uint32_t tag_in = builder.real_variable_tags[real_index];
+        if (tag_in != DUMMY_TAG) {
+            uint32_t tag_out = builder.tau.at(tag_in);
+            tag_data.left_product *= value + tag_data.gamma * FF(tag_in);
+            tag_data.right_product *= value + tag_data.gamma * FF(tag_out);
+            tag_data.encountered_variables[real_index] = true;
+        }
+    };
+
+    for (size_t idx = 0; idx < block.size(); ++idx) {
+        update(block.w_l()[idx], builder.get_variable(block.w_l()[idx]));
+        update(block.w_r()[idx], builder.get_variable(block.w_r()[idx]));
+        update(block.w_o()[idx], builder.get_variable(block.w_o()[idx]));
+        update(block.w_4()[idx], get_w_4(builder, block, memory_data, idx));
+    }
+}
+
 #ifdef ULTRA_FUZZ
 
 /**
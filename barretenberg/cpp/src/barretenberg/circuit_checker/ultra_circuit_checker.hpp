@@ -10,7 +10,9 @@
 #include "barretenberg/relations/ultra_arithmetic_relation.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_circuit_builder.hpp"
 
+#include <memory>
 #include <optional>
+#include <vector>
 
 namespace bb {
 
@@ -33,6 +35,7 @@ class UltraCircuitChecker {
      * polynomials created by the prover. The lookup relation is also not checked for the same reason, however, we do
      * check the correctness of lookup gates by simply ensuring that the inputs to those gates are present in the lookup
      * tables attached to the circuit.
+     * The rows of each block are checked in parallel, and checking stops at the first failing row.
      *
      * @tparam Builder
      * @param builder
@@ -40,28 +43,37 @@ class UltraCircuitChecker {
     template <typename Builder> static bool check(const Builder& builder);
 
   private:
-    struct TagCheckData;           // Container for data pertaining to generalized permutation tag check
-    struct MemoryCheckData;        // Container for data pertaining to RAM/RAM record check
-    using Key = std::array<FF, 4>; // Key type for lookup table hash table
-    struct HashFunction;           // Custom hash function for lookup table hash table
-    using LookupHashTable = std::unordered_set<Key, HashFunction>;
+    struct TagCheckData;    // Container for data pertaining to generalized permutation tag check
+    struct MemoryCheckData; // Container for data pertaining to RAM/RAM record check
+    class LookupIndex;      // Set of the rows of a single basic lookup table
+    using LookupIndices = std::vector<std::unique_ptr<const LookupIndex>>; // Indexed by table_index
 
     /**
      * @brief Checks that the provided witness satisfies all gates contained in a single execution trace block
+     * @details Rows are sharded across threads. If a row fails, rows after it are not checked and the lowest failing
+     * row is reported.
      *
      * @tparam Builder
      * @param builder
      * @param block
      * @param tag_data
      * @param memory_data
-     * @param lookup_hash_table
+     * @param lookup_indices
      */
     template <typename Builder>
     static bool check_block(Builder& builder,
                             auto& block,
                             TagCheckData& tag_data,
-                            MemoryCheckData& memory_data,
-                            LookupHashTable& lookup_hash_table);
+                            const MemoryCheckData& memory_data,
+                            const LookupIndices& lookup_indices);
+
+    /**
+     * @brief Checks all relations on a single row
+     *
+     * @return nullptr if the row is valid, otherwise a description of the failure
+     */
+    template <typename Builder>
+    static const char* check_row(Builder& builder, auto& values, auto& params, const LookupIndices& lookup_indices);
 
 #ifdef ULTRA_FUZZ
     template <typename Builder> static bool relaxed_check_aux_relation(Builder& builder);
@@ -80,12 +92,12 @@ class UltraCircuitChecker {
     template <typename Relation> static bool check_relation(auto& values, auto& params);
 
     /**
-     * @brief Check whether the values in a lookup gate are contained within a corresponding hash table
+     * @brief Check whether the values in a lookup gate are contained within the table the gate refers to
      *
      * @param values Inputs to a lookup gate
-     * @param lookup_hash_table Preconstructed hash table representing entries of all tables in circuit
+     * @param lookup_indices Indices of the entries of all tables in the circuit
      */
-    static bool check_lookup(auto& values, auto& lookup_hash_table);
+    static bool check_lookup(auto& values, const LookupIndices& lookup_indices);
 
     /**
      * @brief Check that the {index, value} pair contained in a databus read gate reflects the actual value present in
@@ -115,18 +127,34 @@ class UltraCircuitChecker {
 
     /**
      * @brief Populate the values required to check the correctness of a single "row" of the circuit
-     * @details Populates all wire values (plus shifts) and selectors. Updates running tag product information.
-     * Populates 4th wire with memory records (as needed).
+     * @details Populates all wire values (plus shifts) and selectors. Populates 4th wire with memory records (as
+     * needed).
      *
      * @tparam Builder
      * @param builder
      * @param values
-     * @param tag_data
+     * @param memory_data
      * @param idx
      */
     template <typename Builder>
     static void populate_values(
-        Builder& builder, auto& block, auto& values, TagCheckData& tag_data, MemoryCheckData& memory_data, size_t idx);
+        Builder& builder, auto& block, auto& values, const MemoryCheckData& memory_data, size_t idx);
+
+    /**
+     * @brief Value of the 4th wire at a given row, which is a memory record for RAM/ROM read and write gates
+     */
+    template <typename Builder>
+    static FF get_w_4(Builder& builder, auto& block, const MemoryCheckData& memory_data, size_t idx);
+
+    /**
+     * @brief Updates the running tag products with the wire values of every row of a block
+     * @details Each variable contributes only the first time it is encountered, so the rows are processed in order.
+     */
+    template <typename Builder>
+    static void update_tag_check_data(Builder& builder,
+                                      auto& block,
+                                      TagCheckData& tag_data,
+                                      const MemoryCheckData& memory_data);
 
     /**
      * @brief Struct for managing the running tag product data for ensuring tag correctness
@@ -136,8 +164,8 @@ class UltraCircuitChecker {
         FF right_product = FF::one();          // product of (value + γ ⋅ tau[tag])
         const FF gamma = FF::random_element(); // randomness for the tag check
 
-        // We need to include each variable only once
-        std::unordered_set<size_t> encountered_variables;
+        // We need to include each variable only once; indexed by real variable index
+        std::vector<bool> encountered_variables;
     };
 
     /**
@@ -163,17 +191,25 @@ class UltraCircuitChecker {
         }
     };
 
-    // Hash for lookups hash table for efficiently checking if lookups are present in set of tables used by circuit
-    struct HashFunction {
-        const FF mult_const = FF(uint256_t(0x1337, 0x1336, 0x1335, 0x1334));
-        const FF mc_sqr = mult_const.sqr();
-        const FF mc_cube = mult_const * mc_sqr;
+    /**
+     * @brief Open-addressed hash set of the (column_1, column_2, column_3) rows of a basic lookup table
+     */
+    class LookupIndex {
+      public:
+        using Entry = std::array<FF, 3>;
 
-        size_t operator()(const Key& entry) const
-        {
-            FF result = entry[0] + mult_const * entry[1] + mc_sqr * entry[2] + mc_cube * entry[3];
-            return static_cast<size_t>(result.reduce_once().data[0]);
-        }
+        explicit LookupIndex(const plookup::BasicTable& table);
+
+        bool contains(const Entry& entry) const;
+        size_t size() const { return num_entries; }
+
+      private:
+        static size_t hash(const Entry& entry);
+
+        std::vector<Entry> slots;
+        std::vector<bool> occupied;
+        size_t mask = 0;
+        size_t num_entries = 0;
     };
 };
 
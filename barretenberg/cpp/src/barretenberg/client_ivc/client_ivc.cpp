@@ -8,6 +8,7 @@
 #include "barretenberg/common/op_count.hpp"
 #include "barretenberg/common/streams.hpp"
 #include "barretenberg/honk/proving_key_inspector.hpp"
+#include "barretenberg/honk/vk_cache.hpp"
 #include "barretenberg/serialize/msgpack_impl.hpp"
 #include "barretenberg/ultra_honk/oink_prover.hpp"
 
@@ -41,6 +42,8 @@ ClientIVC::ClientIVC(TraceSettings trace_settings)
 void ClientIVC::instantiate_stdlib_verification_queue(
     ClientCircuit& circuit, const std::vector<std::shared_ptr<RecursiveVerificationKey>>& input_keys)
 {
+    wait_for_pending_accumulation();
+
     bool vkeys_provided = !input_keys.empty();
     if (vkeys_provided) {
         BB_ASSERT_EQ(verification_queue.size(),
@@ -151,6 +154,9 @@ ClientIVC::PairingPoints ClientIVC::perform_recursive_verification_and_databus_c
  */
 void ClientIVC::complete_kernel_circuit_logic(ClientCircuit& circuit)
 {
+    // The kernel verifies the proofs produced by the previous accumulation steps
+    wait_for_pending_accumulation();
+
     circuit.databus_propagation_data.is_kernel = true;
 
     // Instantiate stdlib verifier inputs from their native counterparts
@@ -193,9 +199,13 @@ void ClientIVC::accumulate(ClientCircuit& circuit,
                            const std::shared_ptr<MegaVerificationKey>& precomputed_vk,
                            const bool mock_vk)
 {
-    // Construct the proving key for circuit
+    // Construct the proving key for circuit. In pipelined mode, this overlaps with the folding of the previous circuit.
     std::shared_ptr<DeciderProvingKey> proving_key = std::make_shared<DeciderProvingKey>(circuit, trace_settings);
 
+    // Everything below depends on the state left by the previous accumulation step. Waiting here also bounds the
+    // number of proving keys alive at any time to the accumulator, the key being folded and the key being constructed.
+    wait_for_pending_accumulation();
+
     // Construct merge proof for the present circuit
     goblin.prove_merge();
 
@@ -215,7 +225,8 @@ void ClientIVC::accumulate(ClientCircuit& circuit,
     // Set the verification key from precomputed if available, else compute it
     {
         PROFILE_THIS_NAME("ClientIVC::accumulate create MegaVerificationKey");
-        honk_vk = precomputed_vk ? precomputed_vk : std::make_shared<MegaVerificationKey>(proving_key->proving_key);
+        honk_vk = precomputed_vk ? precomputed_vk
+                                 : compute_verification_key_cached<MegaFlavor>(proving_key->proving_key);
     }
     if (mock_vk) {
         honk_vk->set_metadata(proving_key->proving_key);
@@ -241,15 +252,42 @@ void ClientIVC::accumulate(ClientCircuit& circuit,
 
         initialized = true;
     } else { // Otherwise, fold the new key into the accumulator
-        vinfo("computing folding proof");
-        auto vk = std::make_shared<DeciderVerificationKey_<Flavor>>(honk_vk);
-        FoldingProver folding_prover(
-            { fold_output.accumulator, proving_key }, { verifier_accumulator, vk }, trace_usage_tracker);
-        fold_output = folding_prover.prove();
-        vinfo("constructed folding proof");
-
-        // Add fold proof and corresponding verification key to the verification queue
-        verification_queue.push_back(VerifierInputs{ fold_output.proof, honk_vk, QUEUE_TYPE::PG });
+        auto fold = [this, proving_key, honk_vk = honk_vk]() {
+            vinfo("computing folding proof");
+            auto vk = std::make_shared<DeciderVerificationKey_<Flavor>>(honk_vk);
+            FoldingProver folding_prover(
+                { fold_output.accumulator, proving_key }, { verifier_accumulator, vk }, trace_usage_tracker);
+            fold_output = folding_prover.prove();
+            vinfo("constructed folding proof");
+
+            // Add fold proof and corresponding verification key to the verification queue
+            verification_queue.push_back(VerifierInputs{ fold_output.proof, honk_vk, QUEUE_TYPE::PG });
+        };
+#ifndef NO_MULTITHREADING
+        if (pipelined_accumulation) {
+            pending_accumulation = std::async(std::launch::async, fold).share();
+            return;
+        }
+#endif
+        fold();
+    }
+}
+
+ClientIVC::~ClientIVC()
+{
+    // Does not rethrow: an exception raised while folding is only of interest to a caller still using the IVC
+    if (pending_accumulation.valid()) {
+        pending_accumulation.wait();
+    }
+}
+
+void ClientIVC::wait_for_pending_accumulation()
+{
+    if (pending_accumulation.valid()) {
+        PROFILE_THIS_NAME("ClientIVC::wait_for_pending_accumulation");
+        // Rethrows any exception raised while folding
+        auto pending = std::move(pending_accumulation);
+        pending.get();
     }
 }
 
@@ -278,6 +316,7 @@ void ClientIVC::hide_op_queue_accumulation_result(ClientCircuit& circuit)
  */
 std::shared_ptr<ClientIVC::DeciderZKProvingKey> ClientIVC::construct_hiding_circuit_key()
 {
+    wait_for_pending_accumulation();
     trace_usage_tracker.print(); // print minimum structured sizes for each block
     BB_ASSERT_EQ(verification_queue.size(), static_cast<size_t>(1));
 
@@ -408,8 +447,10 @@ bool ClientIVC::verify(const Proof& proof) const
  *
  * @return HonkProof
  */
-HonkProof ClientIVC::decider_prove() const
+HonkProof ClientIVC::decider_prove()
 {
+    // The accumulator is only complete once the last folding step is done
+    wait_for_pending_accumulation();
     vinfo("prove decider...");
     fold_output.accumulator->proving_key.commitment_key = bn254_commitment_key;
     MegaDeciderProver decider_prover(fold_output.accumulator);
@@ -22,6 +22,7 @@
 #include "barretenberg/ultra_honk/ultra_prover.hpp"
 #include "barretenberg/ultra_honk/ultra_verifier.hpp"
 #include <algorithm>
+#include <future>
 
 namespace bb {
 
@@ -150,6 +151,9 @@ class ClientIVC {
     // Transcript for CIVC prover (shared between Hiding circuit, Merge, ECCVM, and Translator)
     std::shared_ptr<Transcript> transcript = std::make_shared<Transcript>();
 
+    // Folding step running in the background (only in pipelined mode)
+    std::shared_future<void> pending_accumulation;
+
   public:
     ProverFoldOutput fold_output; // prover accumulator and fold proof
     HonkProof mega_proof;
@@ -174,7 +178,19 @@ class ClientIVC {
 
     bool initialized = false; // Is the IVC accumulator initialized
 
+    // If set, accumulate() returns before the folding of the circuit is done and the folding continues in the
+    // background, overlapping with the construction of the next circuit and its proving key. Any use of the
+    // accumulation state (fold_output, verification_queue, etc.) must be preceded by wait_for_pending_accumulation(),
+    // which the ClientIVC methods do themselves.
+    bool pipelined_accumulation = false;
+
     ClientIVC(TraceSettings trace_settings = {});
+    ClientIVC(const ClientIVC&) = delete;
+    ClientIVC(ClientIVC&&) = delete;
+    ClientIVC& operator=(const ClientIVC&) = delete;
+    ClientIVC& operator=(ClientIVC&&) = delete;
+    // Waits for a folding step still running in the background, since it writes into the members of this object
+    ~ClientIVC();
 
     void instantiate_stdlib_verification_queue(
         ClientCircuit& circuit, const std::vector<std::shared_ptr<RecursiveVerificationKey>>& input_keys = {});
@@ -198,6 +214,9 @@ class ClientIVC {
                     const std::shared_ptr<MegaVerificationKey>& precomputed_vk = nullptr,
                     const bool mock_vk = false);
 
+    // Block until the accumulation started by the last call to accumulate() (if any) is done
+    void wait_for_pending_accumulation();
+
     Proof prove();
 
     std::shared_ptr<ClientIVC::DeciderZKProvingKey> construct_hiding_circuit_key();
@@ -210,7 +229,7 @@ class ClientIVC {
 
     bool prove_and_verify();
 
-    HonkProof decider_prove() const;
+    HonkProof decider_prove();
 
     VerificationKey get_vk() const;
 };
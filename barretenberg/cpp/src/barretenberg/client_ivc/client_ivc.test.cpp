@@ -255,6 +255,83 @@ TEST_F(ClientIVCTests, BasicStructured)
     EXPECT_TRUE(ivc.prove_and_verify());
 };
 
+/**
+ * @brief Accumulation with folding in the background produces a valid proof
+ *
+ */
+TEST_F(ClientIVCTests, BasicStructuredPipelined)
+{
+    ClientIVC ivc{ { SMALL_TEST_STRUCTURE } };
+    ivc.pipelined_accumulation = true;
+
+    ClientIVCMockCircuitProducer circuit_producer;
+
+    size_t NUM_CIRCUITS = 6;
+
+    // Construct and accumulate some circuits of varying size
+    size_t log2_num_gates = 5;
+    for (size_t idx = 0; idx < NUM_CIRCUITS; ++idx) {
+        auto circuit = circuit_producer.create_next_circuit(ivc, log2_num_gates);
+        ivc.accumulate(circuit);
+        log2_num_gates += 1;
+    }
+
+    EXPECT_TRUE(ivc.prove_and_verify());
+};
+
+/**
+ * @brief An IVC can be destroyed while a folding step is still running in the background
+ * @details Destroying the IVC must wait for the fold, which releases everything the fold holds, and must leave
+ * nothing behind that gets in the way of a new IVC.
+ */
+TEST_F(ClientIVCTests, DestroyedDuringPipelinedAccumulation)
+{
+    std::weak_ptr<VerificationKey> folded_vk;
+    {
+        ClientIVCMockCircuitProducer circuit_producer;
+        ClientIVC ivc{ { SMALL_TEST_STRUCTURE } };
+        ivc.pipelined_accumulation = true;
+        for (size_t idx = 0; idx < 2; ++idx) {
+            auto circuit = circuit_producer.create_next_circuit(ivc, /*log2_num_gates=*/5);
+            ivc.accumulate(circuit);
+        }
+        // The verification key of the second circuit is held by its fold, which is (possibly) still in flight
+        folded_vk = ivc.honk_vk;
+    }
+    EXPECT_TRUE(folded_vk.expired());
+
+    ClientIVCMockCircuitProducer circuit_producer;
+    ClientIVC ivc{ { SMALL_TEST_STRUCTURE } };
+    ivc.pipelined_accumulation = true;
+    for (size_t idx = 0; idx < 4; ++idx) {
+        auto circuit = circuit_producer.create_next_circuit(ivc, /*log2_num_gates=*/5);
+        ivc.accumulate(circuit);
+    }
+    EXPECT_TRUE(ivc.prove_and_verify());
+};
+
+/**
+ * @brief A decider proof constructed right after a pipelined accumulation step proves the completed accumulator
+ *
+ */
+TEST_F(ClientIVCTests, DeciderProveWaitsForPipelinedAccumulation)
+{
+    ClientIVCMockCircuitProducer circuit_producer;
+    ClientIVC ivc{ { SMALL_TEST_STRUCTURE } };
+    ivc.pipelined_accumulation = true;
+    for (size_t idx = 0; idx < 2; ++idx) {
+        auto circuit = circuit_producer.create_next_circuit(ivc, /*log2_num_gates=*/5);
+        ivc.accumulate(circuit);
+    }
+
+    HonkProof decider_proof = ivc.decider_prove();
+
+    // The accumulator read by the decider prover is the output of the second fold
+    ASSERT_FALSE(ivc.verification_queue.empty());
+    EXPECT_EQ(ivc.verification_queue.back().type, ClientIVC::QUEUE_TYPE::PG);
+    EXPECT_FALSE(decider_proof.empty());
+};
+
 /**
  * @brief Prove and verify accumulation of an arbitrary set of circuits using precomputed verification keys
  *
@@ -1,4 +1,5 @@
 #include "private_execution_steps.hpp"
+#include "barretenberg/api/file_io.hpp"
 #include "barretenberg/common/serialize.hpp"
 #include "barretenberg/dsl/acir_format/acir_to_constraint_buf.hpp"
 #include <libdeflate.h>
@@ -33,22 +34,18 @@ std::vector<uint8_t> decompress(const void* bytes, size_t size)
 
 template <typename T> T unpack_from_file(const std::filesystem::path& filename)
 {
-    std::ifstream fin;
-    fin.open(filename, std::ios::ate | std::ios::binary);
-    if (!fin.is_open()) {
+    if (!std::filesystem::exists(filename)) {
         THROW std::invalid_argument("file not found");
     }
-    if (fin.tellg() == -1) {
-        THROW std::invalid_argument("something went wrong");
-    }
-
-    size_t fsize = static_cast<size_t>(fin.tellg());
-    fin.seekg(0, std::ios_base::beg);
+    // The file is mapped, and binary fields reference the mapping while unpacking instead of being copied into the
+    // msgpack zone. The only copies made are the ones into the result.
+    MappedFile encoded_data(filename);
+    const auto reference_bin_and_str = [](msgpack::type::object_type, size_t, void*) { return true; };
 
     T result;
-    std::string encoded_data(fsize, '\0');
-    fin.read(encoded_data.data(), static_cast<std::streamsize>(fsize));
-    msgpack::unpack(encoded_data.data(), fsize).get().convert(result);
+    msgpack::unpack(reinterpret_cast<const char*>(encoded_data.data()), encoded_data.size(), reference_bin_and_str)
+        .get()
+        .convert(result);
     return result;
 }
 
@@ -8,6 +8,7 @@
 
 #include "barretenberg/commitment_schemes/claim.hpp"
 #include "barretenberg/commitment_schemes/claim_batcher.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
 #include "barretenberg/transcript/transcript.hpp"
 
@@ -171,7 +172,7 @@ template <typename Curve> class GeminiProver_ {
         void set_random_polynomial(Polynomial&& random)
         {
             has_random_polynomial = true;
-            random_polynomial = random;
+            random_polynomial = std::move(random);
         }
 
         void set_interleaved(RefVector<Polynomial> results, std::vector<RefVector<Polynomial>> groups)
@@ -185,14 +186,13 @@ template <typename Curve> class GeminiProver_ {
         }
 
         /**
-         * @brief Compute batched polynomial A₀ = F + G/X as the linear combination of all polynomials to be opened
-         * @details If the random polynomial is set, it is added to the batched polynomial for ZK
+         * @brief Compute the linear combinations F, G, H (and the batched interleaved polynomials) of the polynomials
+         * to be opened, without materializing A₀ = F + G/X + X^k*H
          *
          * @param challenge batching challenge
          * @param running_scalar power of the batching challenge
-         * @return Polynomial A₀
          */
-        Polynomial compute_batched(const Fr& challenge, Fr& running_scalar)
+        void batch(const Fr& challenge, Fr& running_scalar)
         {
             // lambda for batching polynomials; updates the running scalar in place
             auto batch = [&](Polynomial& batched, const RefVector<Polynomial>& polynomials_to_batch) {
@@ -202,30 +202,20 @@ template <typename Curve> class GeminiProver_ {
                 }
             };
 
-            Polynomial full_batched(full_batched_size);
-
-            // if necessary, add randomness to the full batched polynomial for ZK
-            if (has_random_polynomial) {
-                full_batched += random_polynomial; // A₀ += rand
-            }
-
             // compute the linear combination F of the unshifted polynomials
             if (has_unshifted()) {
                 batch(batched_unshifted, unshifted);
-                full_batched += batched_unshifted; // A₀ += F
             }
 
             // compute the linear combination G of the to-be-shifted polynomials
             if (has_to_be_shifted_by_one()) {
                 batch(batched_to_be_shifted_by_one, to_be_shifted_by_one);
-                full_batched += batched_to_be_shifted_by_one.shifted(); // A₀ += G/X
             }
 
             // compute the linear combination H of the to-be-shifted-by-k polynomials
             if (has_to_be_shifted_by_k()) {
                 batched_to_be_shifted_by_k = Polynomial(full_batched_size - k_shift_magnitude, full_batched_size, 0);
                 batch(batched_to_be_shifted_by_k, to_be_shifted_by_k);
-                full_batched += batched_to_be_shifted_by_k.right_shifted(k_shift_magnitude); // A₀ += X^k * H
             }
 
             // compute the linear combination of the interleaved polynomials and groups
@@ -241,35 +231,95 @@ template <typename Curve> class GeminiProver_ {
                     }
                     running_scalar *= challenge;
                 }
-                full_batched += batched_interleaved;
             }
+        }
 
+        /**
+         * @brief Compute batched polynomial A₀ = F + G/X as the linear combination of all polynomials to be opened
+         * @details If the random polynomial is set, it is added to the batched polynomial for ZK
+         *
+         * @param challenge batching challenge
+         * @param running_scalar power of the batching challenge
+         * @return Polynomial A₀
+         */
+        Polynomial compute_batched(const Fr& challenge, Fr& running_scalar)
+        {
+            batch(challenge, running_scalar);
+
+            Polynomial full_batched(full_batched_size);
+            for (const auto& term : batched_terms()) {
+                full_batched += term; // A₀ += rand + F + G/X + X^k * H + interleaved
+            }
             return full_batched;
         }
 
+        /**
+         * @brief Compute the first Gemini fold A₁ = (1-u₀)⋅even(A₀) + u₀⋅odd(A₀) straight from the batched polynomials
+         * @details Equivalent to folding the output of compute_batched(), but A₀ is only ever summed up one small block
+         * at a time, in a per-thread buffer, so the full-size A₀ is never allocated. Must be called after batch().
+         *
+         * @param u_0 first coordinate of the multilinear opening point
+         * @return Polynomial A₁
+         */
+        Polynomial compute_first_fold(const Fr& u_0) const
+        {
+            // Number of coefficients of A₀ summed up before being folded, must be even
+            static constexpr size_t BLOCK_SIZE = 64;
+
+            const std::vector<PolynomialSpan<const Fr>> terms = batched_terms();
+            const size_t fold_size = full_batched_size / 2;
+            Polynomial A_1(fold_size);
+            parallel_for_range(
+                fold_size,
+                [&](size_t start, size_t end) {
+                    std::array<Fr, BLOCK_SIZE> A_0_block;
+                    for (size_t block_start = 2 * start; block_start < 2 * end; block_start += BLOCK_SIZE) {
+                        const size_t block_end = std::min(block_start + BLOCK_SIZE, 2 * end);
+                        std::fill(A_0_block.begin(), A_0_block.end(), Fr::zero());
+                        for (const auto& term : terms) {
+                            const size_t term_start = std::max(block_start, term.start_index);
+                            const size_t term_end = std::min(block_end, term.end_index());
+                            for (size_t i = term_start; i < term_end; ++i) {
+                                A_0_block[i - block_start] += term[i];
+                            }
+                        }
+                        // A₁[j] = (1-u₀)⋅A₀[2j] + u₀⋅A₀[2j+1]
+                        for (size_t i = block_start; i < block_end; i += 2) {
+                            const Fr& even = A_0_block[i - block_start];
+                            const Fr& odd = A_0_block[i + 1 - block_start];
+                            A_1.at(i >> 1) = even + u_0 * (odd - even);
+                        }
+                    }
+                },
+                /*no_multhreading_if_less_or_equal=*/BLOCK_SIZE);
+            return A_1;
+        }
+
         /**
          * @brief Compute partially evaluated batched polynomials A₀(X, r) = A₀₊ = F + G/r, A₀(X, -r) = A₀₋ = F - G/r
-         * @details If the random polynomial is set, it is added to each batched polynomial for ZK
+         * @details If the random polynomial is set, it is added to each batched polynomial for ZK. The batched
+         * polynomials F, G, H and the random polynomial are released (A₀₊ reuses the memory of F), so this must be the
+         * last use of them.
          *
          * @param r_challenge partial evaluation challenge
          * @return std::pair<Polynomial, Polynomial> {A₀₊, A₀₋}
          */
         std::pair<Polynomial, Polynomial> compute_partially_evaluated_batch_polynomials(const Fr& r_challenge)
         {
-            // Initialize A₀₊ and compute A₀₊ += Random and A₀₊ += F as necessary
-            Polynomial A_0_pos(full_batched_size); // A₀₊
+            // A₀₊ takes over the memory of F, which is not needed anymore, and A₀₊ += Random and A₀₊ += r^k * H are
+            // computed as necessary
+            Polynomial A_0_pos = std::move(batched_unshifted); // A₀₊ = F
 
             if (has_random_polynomial) {
                 A_0_pos += random_polynomial; // A₀₊ += random
-            }
-            if (has_unshifted()) {
-                A_0_pos += batched_unshifted; // A₀₊ += F
+                random_polynomial = Polynomial();
             }
 
             if (has_to_be_shifted_by_k()) {
                 Fr r_pow_k = r_challenge.pow(k_shift_magnitude); // r^k
                 batched_to_be_shifted_by_k *= r_pow_k;
                 A_0_pos += batched_to_be_shifted_by_k; // A₀₊ += r^k * H
+                batched_to_be_shifted_by_k = Polynomial();
             }
 
             Polynomial A_0_neg = A_0_pos;
@@ -280,9 +330,10 @@ template <typename Curve> class GeminiProver_ {
 
                 A_0_pos += batched_to_be_shifted_by_one; // A₀₊ += G/r
                 A_0_neg -= batched_to_be_shifted_by_one; // A₀₋ -= G/r
+                batched_to_be_shifted_by_one = Polynomial();
             }
 
-            return { A_0_pos, A_0_neg };
+            return { std::move(A_0_pos), std::move(A_0_neg) };
         };
         /**
          * @brief Compute the partially evaluated polynomials P₊(X, r) and P₋(X, -r)
@@ -313,8 +364,34 @@ template <typename Curve> class GeminiProver_ {
         }
 
         size_t get_group_size() { return batched_group.size(); }
+
+      private:
+        // The terms of A₀ = rand + F + G/X + X^k*H + interleaved, as views of the batched polynomials
+        std::vector<PolynomialSpan<const Fr>> batched_terms() const
+        {
+            std::vector<PolynomialSpan<const Fr>> terms;
+            if (has_random_polynomial) {
+                terms.emplace_back(random_polynomial);
+            }
+            if (has_unshifted()) {
+                terms.emplace_back(batched_unshifted);
+            }
+            // The shifted polynomials are views sharing the memory of the batched ones, so the spans outlive them
+            if (has_to_be_shifted_by_one()) {
+                terms.emplace_back(batched_to_be_shifted_by_one.shifted());
+            }
+            if (has_to_be_shifted_by_k()) {
+                terms.emplace_back(batched_to_be_shifted_by_k.right_shifted(k_shift_magnitude));
+            }
+            if (has_interleaved()) {
+                terms.emplace_back(batched_interleaved);
+            }
+            return terms;
+        }
     };
 
+    static Polynomial compute_fold(const Polynomial& A_l, const size_t fold_size, const Fr& u_l);
+
     static std::vector<Polynomial> compute_fold_polynomials(const size_t log_n,
                                                             std::span<const Fr> multilinear_challenge,
                                                             const Polynomial& A_0);
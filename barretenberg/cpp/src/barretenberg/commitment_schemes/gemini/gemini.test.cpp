@@ -144,6 +144,52 @@ TYPED_TEST(GeminiTest, DoubleWithShiftAndInterleaving)
     this->execute_gemini_and_verify_claims(u, mock_claims);
 }
 
+/**
+ * @brief The first fold computed straight from the batched polynomials matches the fold of the materialized A₀
+ */
+TYPED_TEST(GeminiTest, FirstFoldMatchesFoldOfBatchedPolynomial)
+{
+    using Fr = TypeParam::ScalarField;
+    using GeminiProver = GeminiProver_<TypeParam>;
+
+    // Large enough for the first fold to span several blocks and threads
+    const size_t log_n = 9;
+    const size_t n = 1UL << log_n;
+    auto ck = create_commitment_key<typename TestFixture::CK>(n);
+    auto u = this->random_evaluation_point(log_n);
+    const Fr rho = Fr::random_element();
+
+    const auto check_first_fold = [&](MockClaimGenerator<TypeParam>& mock_claims, bool has_zk) {
+        if (has_zk) {
+            mock_claims.polynomial_batcher.set_random_polynomial(Polynomial<Fr>::random(n));
+        }
+        auto batcher_copy = mock_claims.polynomial_batcher;
+
+        Fr running_scalar = has_zk ? rho : 1;
+        Polynomial<Fr> A_0 = batcher_copy.compute_batched(rho, running_scalar);
+        auto fold_polynomials = GeminiProver::compute_fold_polynomials(log_n, u, A_0);
+
+        Fr lazy_running_scalar = has_zk ? rho : 1;
+        mock_claims.polynomial_batcher.batch(rho, lazy_running_scalar);
+        EXPECT_EQ(lazy_running_scalar, running_scalar);
+        EXPECT_EQ(mock_claims.polynomial_batcher.compute_first_fold(u[0]), fold_polynomials[0]);
+    };
+
+    MockClaimGenerator<TypeParam> shifts(
+        n, /*num_polynomials*/ 2, /*num_to_be_shifted*/ 1, /*num_to_be_right_shifted_by_k*/ 1, u, ck);
+    check_first_fold(shifts, /*has_zk=*/true);
+
+    MockClaimGenerator<TypeParam> interleaving(n,
+                                               /*num_polynomials*/ 2,
+                                               /*num_to_be_shifted*/ 1,
+                                               /*num_to_be_right_shifted_by_k*/ 0,
+                                               u,
+                                               ck,
+                                               /*num_interleaved*/ 3,
+                                               /*num_to_be_interleaved*/ 2);
+    check_first_fold(interleaving, /*has_zk=*/false);
+}
+
 /**
  * @brief Implementation of the [attack described by Ariel](https://hackmd.io/zm5SDfBqTKKXGpI-zQHtpA?view).
  *
@@ -77,16 +77,22 @@ std::vector<typename GeminiProver_<Curve>::Claim> GeminiProver_<Curve>::prove(
 
     Fr running_scalar = has_zk ? rho : 1; // ρ⁰ is used to batch the hiding polynomial
 
-    Polynomial A_0 = polynomial_batcher.compute_batched(rho, running_scalar);
-
-    // Construct the d-1 Gemini foldings of A₀(X)
-    std::vector<Polynomial> fold_polynomials = compute_fold_polynomials(log_n, multilinear_challenge, A_0);
+    // Compute the linear combinations of the polynomials to be opened. A₀ itself is never materialized.
+    polynomial_batcher.batch(rho, running_scalar);
 
+    // Construct the d-1 Gemini foldings of A₀(X), committing to each as soon as it is computed. The first one is
+    // computed straight from the batched polynomials, each of the next ones from the previous one.
     // If virtual_log_n >= log_n, pad the fold commitments with dummy group elements [1]_1.
+    std::vector<Polynomial> fold_polynomials;
+    fold_polynomials.reserve(log_n - 1);
     for (size_t l = 0; l < virtual_log_n - 1; l++) {
         std::string label = "Gemini:FOLD_" + std::to_string(l + 1);
         if (l < log_n - 1) {
-            transcript->send_to_verifier(label, commitment_key.commit(fold_polynomials[l]));
+            const size_t fold_size = 1 << (log_n - l - 1);
+            Polynomial fold = (l == 0) ? polynomial_batcher.compute_first_fold(multilinear_challenge[0])
+                                       : compute_fold(fold_polynomials.back(), fold_size, multilinear_challenge[l]);
+            transcript->send_to_verifier(label, commitment_key.commit(fold));
+            fold_polynomials.emplace_back(std::move(fold));
         } else {
             transcript->send_to_verifier(label, Commitment::one());
         }
@@ -136,6 +142,50 @@ std::vector<typename GeminiProver_<Curve>::Claim> GeminiProver_<Curve>::prove(
     return claims;
 };
 
+/**
+ * @brief Computes the fold Aₗ₊₁(X) = (1-uₗ)⋅even(Aₗ)(X) + uₗ⋅odd(Aₗ)(X) of Aₗ
+ *
+ * @param A_l Aₗ, of size at least 2 * fold_size
+ * @param fold_size size of Aₗ₊₁
+ * @param u_l opening point coordinate uₗ
+ * @return Polynomial Aₗ₊₁
+ */
+template <typename Curve>
+typename GeminiProver_<Curve>::Polynomial GeminiProver_<Curve>::compute_fold(const Polynomial& A_l,
+                                                                              const size_t fold_size,
+                                                                              const Fr& u_l)
+{
+    const size_t num_threads = get_num_cpus_pow2();
+    constexpr size_t efficient_operations_per_thread = 64; // A guess of the number of operation for which there
+                                                           // would be a point in sending them to a separate thread
+
+    // Use as many threads as it is useful so that 1 thread doesn't process 1 element, but make sure that there is
+    // at least 1
+    size_t num_used_threads = std::min(fold_size / efficient_operations_per_thread, num_threads);
+    num_used_threads = num_used_threads ? num_used_threads : 1;
+    size_t chunk_size = fold_size / num_used_threads;
+    size_t last_chunk_size = (fold_size % chunk_size) ? (fold_size % num_used_threads) : chunk_size;
+
+    // A_l_fold = Aₗ₊₁(X) = (1-uₗ)⋅even(Aₗ)(X) + uₗ⋅odd(Aₗ)(X)
+    Polynomial A_l_fold(fold_size);
+    const Fr* A_l_data = A_l.data();
+    Fr* A_l_fold_data = A_l_fold.data();
+
+    parallel_for(num_used_threads, [&](size_t i) {
+        size_t current_chunk_size = (i == (num_used_threads - 1)) ? last_chunk_size : chunk_size;
+        for (std::ptrdiff_t j = (std::ptrdiff_t)(i * chunk_size);
+             j < (std::ptrdiff_t)((i * chunk_size) + current_chunk_size);
+             j++) {
+            // fold(Aₗ)[j] = (1-uₗ)⋅even(Aₗ)[j] + uₗ⋅odd(Aₗ)[j]
+            //            = (1-uₗ)⋅Aₗ[2j]      + uₗ⋅Aₗ[2j+1]
+            //            = Aₗ₊₁[j]
+            A_l_fold_data[j] = A_l_data[j << 1] + u_l * (A_l_data[(j << 1) + 1] - A_l_data[j << 1]);
+        }
+    });
+
+    return A_l_fold;
+};
+
 /**
  * @brief Computes d-1 fold polynomials Fold_i, i = 1, ..., d-1
  *
@@ -147,55 +197,17 @@ template <typename Curve>
 std::vector<typename GeminiProver_<Curve>::Polynomial> GeminiProver_<Curve>::compute_fold_polynomials(
     const size_t log_n, std::span<const Fr> multilinear_challenge, const Polynomial& A_0)
 {
-    const size_t num_threads = get_num_cpus_pow2();
-    constexpr size_t efficient_operations_per_thread = 64; // A guess of the number of operation for which there
-                                                           // would be a point in sending them to a separate thread
-
-    // Reserve and allocate space for m-1 Fold polynomials, the foldings of the full batched polynomial A₀
     std::vector<Polynomial> fold_polynomials;
     fold_polynomials.reserve(log_n - 1);
-    for (size_t l = 0; l < log_n - 1; ++l) {
-        // size of the previous polynomial/2
-        const size_t n_l = 1 << (log_n - l - 1);
-
-        // A_l_fold = Aₗ₊₁(X) = (1-uₗ)⋅even(Aₗ)(X) + uₗ⋅odd(Aₗ)(X)
-        fold_polynomials.emplace_back(Polynomial(n_l));
-    }
 
     // A_l = Aₗ(X) is the polynomial being folded
     // in the first iteration, we take the batched polynomial
     // in the next iteration, it is the previously folded one
-    auto A_l = A_0.data();
     for (size_t l = 0; l < log_n - 1; ++l) {
         // size of the previous polynomial/2
         const size_t n_l = 1 << (log_n - l - 1);
-
-        // Use as many threads as it is useful so that 1 thread doesn't process 1 element, but make sure that there is
-        // at least 1
-        size_t num_used_threads = std::min(n_l / efficient_operations_per_thread, num_threads);
-        num_used_threads = num_used_threads ? num_used_threads : 1;
-        size_t chunk_size = n_l / num_used_threads;
-        size_t last_chunk_size = (n_l % chunk_size) ? (n_l % num_used_threads) : chunk_size;
-
-        // Opening point is the same for all
-        const Fr u_l = multilinear_challenge[l];
-
-        // A_l_fold = Aₗ₊₁(X) = (1-uₗ)⋅even(Aₗ)(X) + uₗ⋅odd(Aₗ)(X)
-        auto A_l_fold = fold_polynomials[l].data();
-
-        parallel_for(num_used_threads, [&](size_t i) {
-            size_t current_chunk_size = (i == (num_used_threads - 1)) ? last_chunk_size : chunk_size;
-            for (std::ptrdiff_t j = (std::ptrdiff_t)(i * chunk_size);
-                 j < (std::ptrdiff_t)((i * chunk_size) + current_chunk_size);
-                 j++) {
-                // fold(Aₗ)[j] = (1-uₗ)⋅even(Aₗ)[j] + uₗ⋅odd(Aₗ)[j]
-                //            = (1-uₗ)⋅Aₗ[2j]      + uₗ⋅Aₗ[2j+1]
-                //            = Aₗ₊₁[j]
-                A_l_fold[j] = A_l[j << 1] + u_l * (A_l[(j << 1) + 1] - A_l[j << 1]);
-            }
-        });
-        // set Aₗ₊₁ = Aₗ for the next iteration
-        A_l = A_l_fold;
+        const Polynomial& A_l = (l == 0) ? A_0 : fold_polynomials.back();
+        fold_polynomials.emplace_back(compute_fold(A_l, n_l, multilinear_challenge[l]));
     }
 
     return fold_polynomials;
@@ -19,6 +19,7 @@
 #include "barretenberg/stdlib/primitives/circuit_builders/circuit_builders_fwd.hpp"
 #include "barretenberg/stdlib/transcript/transcript.hpp"
 #include "barretenberg/transcript/transcript.hpp"
+#include <algorithm>
 #include <cstddef>
 #include <numeric>
 #include <string>
@@ -304,33 +305,23 @@ template <typename Curve_> class IPA {
     }
 
     /**
-     * @brief Natively verify the correctness of a Proof
-     *
-     * @tparam Transcript Allows to specify a transcript class. Useful for testing
-     * @param vk Verification_key containing srs and pippenger_runtime_state to be used for MSM
-     * @param opening_claim Contains the commitment C and opening pair \f$(\beta, f(\beta))\f$
-     * @param transcript Transcript with elements from the prover and generated challenges
-     *
-     * @return true/false depending on if the proof verifies
-     *
-     * @details The procedure runs as follows:
-     *
-     *1. Receive \f$d\f$ (polynomial degree plus one) from the prover
-     *2. Receive the generator challenge \f$u\f$, abort if it's zero, otherwise compute \f$U=u\cdot G\f$
-     *3. Compute  \f$C'=C+f(\beta)\cdot U\f$
-     *4. Receive \f$L_j, R_j\f$ and compute challenges \f$u_j\f$ for \f$j \in {k-1,..,0}\f$, abort immediately on
-     receiving a \f$u_j=0\f$
-     *5. Compute \f$C_0 = C' + \sum_{j=0}^{k-1}(u_j^{-1}L_j + u_jR_j)\f$
-     *6. Compute \f$b_0=g(\beta)=\prod_{i=0}^{k-1}(1+u_{i}^{-1}x^{2^{i}})\f$
-     *7. Compute vector \f$\vec{s}=(1,u_{0}^{-1},u_{1}^{-1},u_{0}^{-1}u_{1}^{-1},...,\prod_{i=0}^{k-1}u_{i}^{-1})\f$
-     *8. Compute \f$G_s=\langle \vec{s},\vec{G}\rangle\f$
-     *9. Receive \f$\vec{a}_{0}\f$ of length 1
-     *10. Compute \f$C_{right}=a_{0}G_{s}+a_{0}b_{0}U\f$
-     *11. Check that \f$C_{right} = C_0\f$. If they match, return true. Otherwise return false.
+     * @brief Everything a native verifier learns from an IPA proof before the \f$2^k\f$-point MSM computing \f$G_0\f$
      */
-    static bool reduce_verify_internal_native(const VK& vk,
-                                                      const OpeningClaim<Curve>& opening_claim,
-                                                      auto& transcript)
+    struct NativeReducedClaim {
+        uint32_t poly_length;
+        Polynomial<Fr> s_poly;
+        GroupElement C_zero;
+        Commitment G_zero_sent;
+        Fr a_zero;
+        Fr b_zero;
+        Commitment aux_generator;
+    };
+
+    /**
+     * @brief Run the steps of \link IPA::reduce_verify_internal_native reduce_verify_internal_native \endlink that
+     * do not involve the SRS, i.e. everything except for the computation of \f$G_0\f$
+     */
+    static NativeReducedClaim reduce_native_claim(const VK& vk, const OpeningClaim<Curve>& opening_claim, auto& transcript)
         requires(!Curve::is_stdlib_type)
     {
         // Step 1.
@@ -405,11 +396,37 @@ template <typename Curve_> class IPA {
         // Construct vector s
         Polynomial<Fr> s_poly(construct_poly_from_u_challenges_inv(log_poly_length, std::span(round_challenges_inv).subspan(0, log_poly_length)));
 
+        // Receive the prover's G₀, which is checked against ⟨s, G⟩ by the caller
+        Commitment G_zero_sent = transcript->template receive_from_prover<Commitment>("IPA:G_0");
+
+        // Step 9.
+        // Receive a₀ from the prover
+        auto a_zero = transcript->template receive_from_prover<Fr>("IPA:a_0");
+
+        return { poly_length, std::move(s_poly), C_zero, G_zero_sent, a_zero, b_zero, aux_generator };
+    }
+
+    /**
+     * @brief Steps 10 and 11 of \link IPA::reduce_verify_internal_native reduce_verify_internal_native \endlink:
+     * check that \f$C_0 = a_0G_0 + a_0b_0U\f$
+     */
+    static bool check_reduced_claim(const NativeReducedClaim& claim, const Commitment& G_zero)
+        requires(!Curve::is_stdlib_type)
+    {
+        GroupElement right_hand_side = G_zero * claim.a_zero + claim.aux_generator * claim.a_zero * claim.b_zero;
+        return (claim.C_zero.normalize() == right_hand_side.normalize());
+    }
+
+    /**
+     * @brief Copy the first poly_length points of the original SRS, i.e. the \f$\vec{G}\f$ vector, to local memory
+     */
+    static std::vector<Commitment> get_G_vec_local(const VK& vk, const size_t poly_length)
+        requires(!Curve::is_stdlib_type)
+    {
         std::span<const Commitment> srs_elements = vk.get_monomial_points();
         if (poly_length * 2 > srs_elements.size()) {
             throw_or_abort("potential bug: Not enough SRS points for IPA!");
         }
-        // Copy the G_vector to local memory.
         std::vector<Commitment> G_vec_local(poly_length);
 
         // The SRS stored in the commitment key is the result after applying the pippenger point table so the
@@ -421,23 +438,51 @@ template <typename Curve_> class IPA {
                 G_vec_local[i] = srs_elements[i * 2];
             }, thread_heuristics::FF_COPY_COST * 2);
 
+        return G_vec_local;
+    }
+
+    /**
+     * @brief Natively verify the correctness of a Proof
+     *
+     * @tparam Transcript Allows to specify a transcript class. Useful for testing
+     * @param vk Verification_key containing srs and pippenger_runtime_state to be used for MSM
+     * @param opening_claim Contains the commitment C and opening pair \f$(\beta, f(\beta))\f$
+     * @param transcript Transcript with elements from the prover and generated challenges
+     *
+     * @return true/false depending on if the proof verifies
+     *
+     * @details The procedure runs as follows:
+     *
+     *1. Receive \f$d\f$ (polynomial degree plus one) from the prover
+     *2. Receive the generator challenge \f$u\f$, abort if it's zero, otherwise compute \f$U=u\cdot G\f$
+     *3. Compute  \f$C'=C+f(\beta)\cdot U\f$
+     *4. Receive \f$L_j, R_j\f$ and compute challenges \f$u_j\f$ for \f$j \in {k-1,..,0}\f$, abort immediately on
+     receiving a \f$u_j=0\f$
+     *5. Compute \f$C_0 = C' + \sum_{j=0}^{k-1}(u_j^{-1}L_j + u_jR_j)\f$
+     *6. Compute \f$b_0=g(\beta)=\prod_{i=0}^{k-1}(1+u_{i}^{-1}x^{2^{i}})\f$
+     *7. Compute vector \f$\vec{s}=(1,u_{0}^{-1},u_{1}^{-1},u_{0}^{-1}u_{1}^{-1},...,\prod_{i=0}^{k-1}u_{i}^{-1})\f$
+     *8. Compute \f$G_s=\langle \vec{s},\vec{G}\rangle\f$
+     *9. Receive \f$\vec{a}_{0}\f$ of length 1
+     *10. Compute \f$C_{right}=a_{0}G_{s}+a_{0}b_{0}U\f$
+     *11. Check that \f$C_{right} = C_0\f$. If they match, return true. Otherwise return false.
+     */
+    static bool reduce_verify_internal_native(const VK& vk,
+                                                      const OpeningClaim<Curve>& opening_claim,
+                                                      auto& transcript)
+        requires(!Curve::is_stdlib_type)
+    {
+        NativeReducedClaim claim = reduce_native_claim(vk, opening_claim, transcript);
+        std::vector<Commitment> G_vec_local = get_G_vec_local(vk, claim.poly_length);
+
         // Step 8.
         // Compute G₀
         Commitment G_zero = bb::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
-           s_poly, {&G_vec_local[0], /*size*/ poly_length}, vk.pippenger_runtime_state.get());
-        Commitment G_zero_sent = transcript->template receive_from_prover<Commitment>("IPA:G_0");
-        BB_ASSERT_EQ(G_zero, G_zero_sent, "G_0 should be equal to G_0 sent in transcript.");
+           claim.s_poly, {&G_vec_local[0], /*size*/ claim.poly_length}, vk.pippenger_runtime_state.get());
+        BB_ASSERT_EQ(G_zero, claim.G_zero_sent, "G_0 should be equal to G_0 sent in transcript.");
 
-        // Step 9.
-        // Receive a₀ from the prover
-        auto a_zero = transcript->template receive_from_prover<Fr>("IPA:a_0");
-
-        // Step 10.
-        // Compute C_right
-        GroupElement right_hand_side = G_zero * a_zero + aux_generator * a_zero * b_zero;
-        // Step 11.
-        // Check if C_right == C₀
-        return (C_zero.normalize() == right_hand_side.normalize());
+        // Steps 10 and 11.
+        // Compute C_right and check if C_right == C₀
+        return check_reduced_claim(claim, G_zero);
     }
     /**
      * @brief  Recursively verify the correctness of an IPA proof, without computing G_zero. Unlike native verification, there is no
@@ -583,6 +628,64 @@ template <typename Curve_> class IPA {
         return reduce_verify_internal_native(vk, opening_claim, transcript);
     }
 
+    /**
+     * @brief Natively verify a batch of IPA proofs with a single MSM over \f$\vec{G}\f$
+     *
+     * @param vk Verification_key containing srs and pippenger_runtime_state to be used for MSM
+     * @param opening_claims The claims \f$(C_i, \beta_i, f_i(\beta_i))\f$, one per proof
+     * @param transcripts The verifier transcripts of the proofs, in the same order as the claims
+     *
+     * @return true/false depending on if all the proofs verify
+     *
+     * @details Each proof is reduced as in \link IPA::reduce_verify_internal_native reduce_verify_internal_native
+     * \endlink, except that \f$C_0 = a_0G_0 + a_0b_0U\f$ is checked against the \f$G_{0,i}\f$ sent by the prover.
+     * The \f$2^k\f$-point MSMs \f$G_{0,i} = \langle \vec{s}_i,\vec{G}\rangle\f$ are then replaced by a single check
+     * \f$\sum_i \alpha_i G_{0,i} = \langle \sum_i \alpha_i\vec{s}_i,\vec{G}\rangle\f$ with random weights
+     * \f$\alpha_i\f$ chosen by the verifier. Proofs may be of different lengths, the shorter \f$\vec{s}_i\f$ only
+     * contribute to a prefix of the combined vector.
+     */
+    static bool batch_reduce_verify(const VK& vk,
+                                    const std::vector<OpeningClaim<Curve>>& opening_claims,
+                                    const std::vector<std::shared_ptr<NativeTranscript>>& transcripts)
+        requires(!Curve::is_stdlib_type)
+    {
+        BB_ASSERT_EQ(opening_claims.size(), transcripts.size(), "Each IPA opening claim needs its own transcript.");
+        if (opening_claims.empty()) {
+            return true;
+        }
+
+        std::vector<NativeReducedClaim> claims;
+        claims.reserve(opening_claims.size());
+        size_t max_poly_length = 0;
+        for (size_t i = 0; i < opening_claims.size(); i++) {
+            claims.push_back(reduce_native_claim(vk, opening_claims[i], transcripts[i]));
+            max_poly_length = std::max(max_poly_length, static_cast<size_t>(claims.back().poly_length));
+        }
+
+        // The per-proof checks only involve a handful of points
+        for (const auto& claim : claims) {
+            if (!check_reduced_claim(claim, claim.G_zero_sent)) {
+                return false;
+            }
+        }
+
+        // Check all the G₀ at once: ∑ α_i G_{0,i} = ⟨∑ α_i s_i, G⟩
+        Polynomial<Fr> combined_s_poly(max_poly_length);
+        GroupElement combined_G_zero = GroupElement::infinity();
+        for (auto& claim : claims) {
+            const Fr alpha = Fr::random_element();
+            combined_s_poly.add_scaled(claim.s_poly, alpha);
+            combined_G_zero += claim.G_zero_sent * alpha;
+            // Release each s vector as soon as it has been folded in
+            claim.s_poly = Polynomial<Fr>();
+        }
+
+        std::vector<Commitment> G_vec_local = get_G_vec_local(vk, max_poly_length);
+        Commitment G_zero = bb::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
+            combined_s_poly, { &G_vec_local[0], /*size*/ max_poly_length }, vk.pippenger_runtime_state.get());
+        return (G_zero == Commitment(combined_G_zero.normalize()));
+    }
+
     /**
      * @brief Recursively verify the correctness of a proof
      *
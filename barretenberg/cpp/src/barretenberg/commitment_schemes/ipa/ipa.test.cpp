@@ -42,6 +42,39 @@ class IPATest : public CommitmentTest<Curve> {
         ck = create_commitment_key<CK>(n);
         vk = create_verifier_commitment_key<VK>();
     }
+
+    // Opening claims together with their proofs, for the batch verification tests
+    struct ClaimsAndProofs {
+        std::vector<OpeningClaim<Curve>> claims;
+        std::vector<HonkProof> proofs;
+    };
+
+    ClaimsAndProofs prove_claims()
+    {
+        ClaimsAndProofs result;
+        // Proofs of different lengths share the combined MSM
+        for (size_t poly_size : { n, small_n, n, n / 2 }) {
+            auto poly = Polynomial::random(poly_size);
+            auto [x, eval] = this->random_eval(poly);
+            const OpeningPair<Curve> opening_pair = { x, eval };
+            result.claims.push_back({ opening_pair, ck.commit(poly) });
+
+            auto prover_transcript = std::make_shared<NativeTranscript>();
+            PCS::compute_opening_proof(ck, { poly, opening_pair }, prover_transcript);
+            result.proofs.push_back(prover_transcript->export_proof());
+        }
+        return result;
+    }
+
+    static std::vector<std::shared_ptr<NativeTranscript>> verifier_transcripts(const std::vector<HonkProof>& proofs)
+    {
+        std::vector<std::shared_ptr<NativeTranscript>> transcripts;
+        for (const auto& proof : proofs) {
+            transcripts.push_back(std::make_shared<NativeTranscript>());
+            transcripts.back()->load_proof(proof);
+        }
+        return transcripts;
+    }
 };
 } // namespace
 
@@ -245,6 +278,58 @@ TEST_F(IPATest, Open)
     EXPECT_EQ(prover_transcript->get_manifest(), verifier_transcript->get_manifest());
 }
 
+TEST_F(IPATest, BatchVerify)
+{
+    auto [opening_claims, proofs] = prove_claims();
+
+    EXPECT_TRUE(PCS::batch_reduce_verify(vk, opening_claims, verifier_transcripts(proofs)));
+    EXPECT_TRUE(PCS::batch_reduce_verify(vk, {}, {}));
+
+    // A single wrong claim makes the whole batch fail
+    auto bad_claims = opening_claims;
+    bad_claims[2].opening_pair.evaluation += Fr::one();
+    EXPECT_FALSE(PCS::batch_reduce_verify(vk, bad_claims, verifier_transcripts(proofs)));
+}
+
+TEST_F(IPATest, BatchVerifyWrongChallenge)
+{
+    auto [opening_claims, proofs] = prove_claims();
+
+    // The evaluation is right for the polynomial, but at another point than the one the proof was computed for
+    opening_claims[1].opening_pair.challenge += Fr::one();
+    EXPECT_FALSE(PCS::batch_reduce_verify(vk, opening_claims, verifier_transcripts(proofs)));
+}
+
+// A prover can pick any G₀ (and a matching a₀) that passes the per-proof check C₀ = a₀G₀ + a₀b₀U, since nothing is
+// derived from the transcript after them. Only the combined check against ⟨s, G⟩ catches such a G₀.
+TEST_F(IPATest, BatchVerifyForgedGZero)
+{
+    auto [opening_claims, proofs] = prove_claims();
+    const size_t forged = 1;
+
+    auto transcript = verifier_transcripts({ proofs[forged] })[0];
+    const auto claim = PCS::reduce_native_claim(vk, opening_claims[forged], transcript);
+    const Fr a_zero = claim.a_zero + Fr::one();
+    const Commitment G_zero = (claim.C_zero - claim.aux_generator * (a_zero * claim.b_zero)) * a_zero.invert();
+    ASSERT_NE(G_zero, claim.G_zero_sent);
+    ASSERT_TRUE(PCS::check_reduced_claim({ .C_zero = claim.C_zero,
+                                           .a_zero = a_zero,
+                                           .b_zero = claim.b_zero,
+                                           .aux_generator = claim.aux_generator },
+                                         G_zero));
+
+    // G₀ and a₀ are the last elements of the proof
+    auto& proof = proofs[forged];
+    const auto G_zero_frs = field_conversion::convert_to_bn254_frs(G_zero);
+    const auto a_zero_frs = field_conversion::convert_to_bn254_frs(a_zero);
+    const size_t a_zero_offset = proof.size() - a_zero_frs.size();
+    const size_t G_zero_offset = a_zero_offset - G_zero_frs.size();
+    std::copy(G_zero_frs.begin(), G_zero_frs.end(), proof.begin() + static_cast<std::ptrdiff_t>(G_zero_offset));
+    std::copy(a_zero_frs.begin(), a_zero_frs.end(), proof.begin() + static_cast<std::ptrdiff_t>(a_zero_offset));
+
+    EXPECT_FALSE(PCS::batch_reduce_verify(vk, opening_claims, verifier_transcripts(proofs)));
+}
+
 TEST_F(IPATest, GeminiShplonkIPAWithShift)
 {
     // Generate multilinear polynomials, their commitments (genuine and mocked) and evaluations (genuine) at a random
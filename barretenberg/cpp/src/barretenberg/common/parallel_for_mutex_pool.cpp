@@ -14,6 +14,19 @@
 
 namespace {
 
+// Whether this thread is running a parallel_for (either as the caller or as a worker).
+thread_local bool in_parallel_for = false;
+
+// Marks the current thread as running a parallel_for for the lifetime of the guard, including when the task throws.
+struct ParallelForGuard {
+    ParallelForGuard() { in_parallel_for = true; }
+    ParallelForGuard(const ParallelForGuard&) = delete;
+    ParallelForGuard(ParallelForGuard&&) = delete;
+    ParallelForGuard& operator=(const ParallelForGuard&) = delete;
+    ParallelForGuard& operator=(ParallelForGuard&&) = delete;
+    ~ParallelForGuard() { in_parallel_for = false; }
+};
+
 class ThreadPool {
   public:
     ThreadPool(size_t num_threads);
@@ -101,6 +114,8 @@ ThreadPool::~ThreadPool()
 
 void ThreadPool::worker_loop(size_t /*unused*/)
 {
+    // Workers only ever run parallel_for iterations, so any parallel_for they call is nested.
+    in_parallel_for = true;
     // info("created worker ", worker_num);
     while (true) {
         {
@@ -125,18 +140,17 @@ namespace bb {
 void parallel_for_mutex_pool(size_t num_iterations, const std::function<void(size_t)>& func)
 {
     static ThreadPool pool(get_num_cpus() - 1);
-    // Note that if this is used safely, we don't need the std::atomic_bool (can use bool), but if we are catching the
-    // mess up case of nesting parallel_for this should be atomic
-    static std::atomic_bool nested = false;
-    // Check if we are already in a nested parallel_for_mutex_pool call
-    bool expected = false;
-    if (!nested.compare_exchange_strong(expected, true)) {
+    // Nested calls (from within an iteration) would deadlock, so they are an error.
+    if (in_parallel_for) {
         throw_or_abort("Error: Nested parallel_for_mutex_pool calls are not allowed.");
     }
+    // Concurrent calls from independent threads (e.g., a background prover task) take turns using the pool.
+    static std::mutex pool_mutex;
+    std::unique_lock<std::mutex> lock(pool_mutex);
+    ParallelForGuard guard;
     // info("starting job with iterations: ", num_iterations);
     pool.start_tasks(num_iterations, func);
     // info("done");
-    nested = false;
 }
 } // namespace bb
 #endif
\ No newline at end of file
@@ -19,6 +19,7 @@
    https://blake2.net.
 */
 
+#include <algorithm>
 #include <cstdint>
 #include <cstdio>
 #include <cstring>
@@ -239,4 +240,136 @@ std::array<uint8_t, BLAKE2S_OUTBYTES> blake2s(std::vector<uint8_t> const& input)
     return output;
 }
 
+
+namespace {
+/**
+ * @brief Number of messages hashed side by side by blake2s_many.
+ * @details Eight 32-bit lanes fill an AVX2 register. The vector type is split or widened to whatever the target
+ * architecture supports.
+ */
+constexpr size_t NUM_LANES = 8;
+using Lanes = uint32_t __attribute__((vector_size(NUM_LANES * sizeof(uint32_t))));
+
+inline Lanes rotr32_lanes(const Lanes& w, const unsigned c)
+{
+    return (w >> c) | (w << (32 - c));
+}
+
+inline void g_lanes(Lanes& a, Lanes& b, Lanes& c, Lanes& d, const Lanes& x, const Lanes& y)
+{
+    a = a + b + x;
+    d = rotr32_lanes(d ^ a, 16);
+    c = c + d;
+    b = rotr32_lanes(b ^ c, 12);
+    a = a + b + y;
+    d = rotr32_lanes(d ^ a, 8);
+    c = c + d;
+    b = rotr32_lanes(b ^ c, 7);
+}
+
+// blake2s_compress on NUM_LANES independent states, with the counters and the last block flags given per lane
+void blake2s_compress_lanes(
+    Lanes h[8], const Lanes m[16], const Lanes& counter_low, const Lanes& counter_high, const Lanes& last_block)
+{
+    Lanes v[16];
+    for (size_t i = 0; i < 8; ++i) {
+        v[i] = h[i];
+        v[i + 8] = Lanes{} + blake2s_IV[i];
+    }
+    v[12] ^= counter_low;
+    v[13] ^= counter_high;
+    v[14] ^= last_block;
+
+    for (size_t r = 0; r < 10; ++r) {
+        const uint8_t* sigma = blake2s_sigma[r];
+        g_lanes(v[0], v[4], v[8], v[12], m[sigma[0]], m[sigma[1]]);
+        g_lanes(v[1], v[5], v[9], v[13], m[sigma[2]], m[sigma[3]]);
+        g_lanes(v[2], v[6], v[10], v[14], m[sigma[4]], m[sigma[5]]);
+        g_lanes(v[3], v[7], v[11], v[15], m[sigma[6]], m[sigma[7]]);
+        g_lanes(v[0], v[5], v[10], v[15], m[sigma[8]], m[sigma[9]]);
+        g_lanes(v[1], v[6], v[11], v[12], m[sigma[10]], m[sigma[11]]);
+        g_lanes(v[2], v[7], v[8], v[13], m[sigma[12]], m[sigma[13]]);
+        g_lanes(v[3], v[4], v[9], v[14], m[sigma[14]], m[sigma[15]]);
+    }
+
+    for (size_t i = 0; i < 8; ++i) {
+        h[i] ^= v[i] ^ v[i + 8];
+    }
+}
+} // namespace
+
+/**
+ * @brief Hash many independent messages with the default (unkeyed, 32-byte output) parameters, NUM_LANES of them at a
+ * time
+ *
+ * @details Messages of different lengths share a batch: a lane whose message has run out of blocks keeps its state
+ * while the others are compressed.
+ */
+std::vector<std::array<uint8_t, BLAKE2S_OUTBYTES>> blake2s_many(const std::vector<std::vector<uint8_t>>& inputs)
+{
+    blake2s_state initial_state[1];
+    blake2s_init(initial_state, BLAKE2S_OUTBYTES);
+
+    // The empty message is still hashed as one (padding) block
+    const auto get_num_blocks = [](size_t size) {
+        return std::max<size_t>(1, (size + BLAKE2S_BLOCKBYTES - 1) / BLAKE2S_BLOCKBYTES);
+    };
+
+    std::vector<std::array<uint8_t, BLAKE2S_OUTBYTES>> outputs(inputs.size());
+    for (size_t start = 0; start < inputs.size(); start += NUM_LANES) {
+        const size_t num_lanes = std::min(NUM_LANES, inputs.size() - start);
+        size_t max_num_blocks = 0;
+        for (size_t lane = 0; lane < num_lanes; ++lane) {
+            max_num_blocks = std::max(max_num_blocks, get_num_blocks(inputs[start + lane].size()));
+        }
+
+        Lanes h[8];
+        for (size_t i = 0; i < 8; ++i) {
+            h[i] = Lanes{} + initial_state->h[i];
+        }
+        for (size_t block_index = 0; block_index < max_num_blocks; ++block_index) {
+            Lanes m[16] = {};
+            Lanes counter_low{};
+            Lanes counter_high{};
+            Lanes last_block{};
+            Lanes active{};
+            for (size_t lane = 0; lane < num_lanes; ++lane) {
+                const std::vector<uint8_t>& input = inputs[start + lane];
+                const size_t num_blocks = get_num_blocks(input.size());
+                if (block_index >= num_blocks) {
+                    continue;
+                }
+                const size_t block_start = block_index * BLAKE2S_BLOCKBYTES;
+                const size_t block_end = std::min(block_start + BLAKE2S_BLOCKBYTES, input.size());
+                uint8_t block[BLAKE2S_BLOCKBYTES] = {};
+                std::copy(input.begin() + static_cast<std::ptrdiff_t>(block_start),
+                          input.begin() + static_cast<std::ptrdiff_t>(block_end),
+                          block);
+                for (size_t i = 0; i < 16; ++i) {
+                    m[i][lane] = load32(block + i * sizeof(uint32_t));
+                }
+                const auto counter = static_cast<uint64_t>(block_end);
+                counter_low[lane] = static_cast<uint32_t>(counter);
+                counter_high[lane] = static_cast<uint32_t>(counter >> 32);
+                last_block[lane] = block_index + 1 == num_blocks ? ~0U : 0U;
+                active[lane] = ~0U;
+            }
+
+            Lanes next_h[8];
+            std::copy(h, h + 8, next_h);
+            blake2s_compress_lanes(next_h, m, counter_low, counter_high, last_block);
+            for (size_t i = 0; i < 8; ++i) {
+                h[i] = (next_h[i] & active) | (h[i] & ~active);
+            }
+        }
+
+        for (size_t lane = 0; lane < num_lanes; ++lane) {
+            for (size_t i = 0; i < 8; ++i) {
+                store32(outputs[start + lane].data() + i * sizeof(uint32_t), h[i][lane]);
+            }
+        }
+    }
+    return outputs;
+}
+
 } // namespace bb::crypto
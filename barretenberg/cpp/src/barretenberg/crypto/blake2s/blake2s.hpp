@@ -79,4 +79,7 @@ int blake2s_final(blake2s_state* S, void* out, size_t outlen);
 
 std::array<uint8_t, BLAKE2S_OUTBYTES> blake2s(std::vector<uint8_t> const& input);
 
+// Batch version of blake2s, which hashes several independent inputs side by side in SIMD lanes
+std::vector<std::array<uint8_t, BLAKE2S_OUTBYTES>> blake2s_many(const std::vector<std::vector<uint8_t>>& inputs);
+
 } // namespace bb::crypto
\ No newline at end of file
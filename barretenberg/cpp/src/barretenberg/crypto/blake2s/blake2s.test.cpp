@@ -386,4 +386,21 @@ TEST(misc_blake2s, test_vectors)
         std::vector<uint8_t> input(v.input.begin(), v.input.end());
         EXPECT_EQ(crypto::blake2s(input), v.output);
     }
-}
\ No newline at end of file
+}
+TEST(misc_blake2s, blake2s_many_matches_blake2s)
+{
+    std::vector<std::vector<uint8_t>> inputs;
+    for (auto v : test_vectors) {
+        inputs.emplace_back(v.input.begin(), v.input.end());
+    }
+    // Exact multiples of the block size, where the last block is a full one
+    inputs.emplace_back(64, 0x5a);
+    inputs.emplace_back(128, 0xa5);
+    inputs.emplace_back(200, 0x11);
+
+    auto results = crypto::blake2s_many(inputs);
+    ASSERT_EQ(results.size(), inputs.size());
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        EXPECT_EQ(results[i], crypto::blake2s(inputs[i]));
+    }
+}
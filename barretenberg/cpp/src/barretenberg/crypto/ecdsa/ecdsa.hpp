@@ -13,6 +13,7 @@
 #include "barretenberg/serialize/msgpack.hpp"
 #include <array>
 #include <string>
+#include <vector>
 
 namespace bb::crypto {
 template <typename Fr, typename G1> struct ecdsa_key_pair {
@@ -42,6 +43,16 @@ bool ecdsa_verify_signature(const std::string& message,
                             const typename G1::affine_element& public_key,
                             const ecdsa_signature& signature);
 
+/**
+ * @brief Verifies many signatures at once; the result for each is the same as that of ecdsa_verify_signature
+ * @details All signatures are checked together with a random linear combination and a single multi-scalar
+ * multiplication. If the combined check fails, each signature is verified on its own to find the invalid ones.
+ */
+template <typename Hash, typename Fq, typename Fr, typename G1>
+std::vector<bool> ecdsa_verify_signatures(const std::vector<std::string>& messages,
+                                          const std::vector<typename G1::affine_element>& public_keys,
+                                          const std::vector<ecdsa_signature>& signatures);
+
 inline bool operator==(ecdsa_signature const& lhs, ecdsa_signature const& rhs)
 {
     return lhs.r == rhs.r && lhs.s == rhs.s && lhs.v == rhs.v;
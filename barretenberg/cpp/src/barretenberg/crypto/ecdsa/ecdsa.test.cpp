@@ -179,3 +179,41 @@ TEST(ecdsa, verify_signature_secp256r1_sha256_NIST_1)
         ecdsa_verify_signature<Sha256Hasher, secp256r1::fq, secp256r1::fr, secp256r1::g1>(message, public_key, sig);
     EXPECT_EQ(result, true);
 }
+
+template <typename Fq, typename Fr, typename G1> void test_verify_signatures()
+{
+    const size_t num_signatures = 9;
+    std::vector<std::string> messages;
+    std::vector<typename G1::affine_element> public_keys;
+    std::vector<ecdsa_signature> signatures;
+    for (size_t i = 0; i < num_signatures; ++i) {
+        ecdsa_key_pair<Fr, G1> account;
+        account.private_key = Fr::random_element();
+        account.public_key = G1::one * account.private_key;
+        messages.push_back("message number " + std::to_string(i));
+        public_keys.push_back(account.public_key);
+        signatures.push_back(ecdsa_construct_signature<Sha256Hasher, Fq, Fr, G1>(messages.back(), account));
+    }
+
+    auto results = ecdsa_verify_signatures<Sha256Hasher, Fq, Fr, G1>(messages, public_keys, signatures);
+    EXPECT_EQ(results, std::vector<bool>(num_signatures, true));
+
+    // A wrong message, a wrong key, and a correct signature whose v does not match R only fails the combined check
+    messages[2] = "a different message";
+    public_keys[5] = public_keys[6];
+    signatures[7].v ^= 1;
+    results = ecdsa_verify_signatures<Sha256Hasher, Fq, Fr, G1>(messages, public_keys, signatures);
+    for (size_t i = 0; i < num_signatures; ++i) {
+        EXPECT_EQ(results[i], i != 2 && i != 5);
+    }
+}
+
+TEST(ecdsa, verify_signatures_secp256k1_sha256)
+{
+    test_verify_signatures<secp256k1::fq, secp256k1::fr, secp256k1::g1>();
+}
+
+TEST(ecdsa, verify_signatures_secp256r1_sha256)
+{
+    test_verify_signatures<secp256r1::fq, secp256r1::fr, secp256r1::g1>();
+}
@@ -8,8 +8,13 @@
 
 #include "../hmac/hmac.hpp"
 #include "barretenberg/common/serialize.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
 #include "barretenberg/numeric/uint256/uint256.hpp"
 
+#include <algorithm>
+#include <span>
+
 namespace bb::crypto {
 
 template <typename Hash, typename Fq, typename Fr, typename G1>
@@ -176,4 +181,171 @@ bool ecdsa_verify_signature(const std::string& message,
     Fr result(Rx);
     return result == r;
 }
+
+namespace ecdsa_detail {
+/**
+ * @brief Computes sum_i scalars[i] * points[i] with the bucket method, one window per task
+ * @details The pippenger in ecc/scalar_multiplication relies on the curve endomorphism and is only instantiated for
+ * BN254 and Grumpkin, so the secp curves use this plainer version. Points at infinity are skipped.
+ */
+template <typename G1>
+typename G1::element multi_scalar_mul(std::span<const typename G1::affine_element> points,
+                                      std::span<const uint256_t> scalars)
+{
+    using Element = typename G1::element;
+    constexpr size_t NUM_BITS = 256;
+    const size_t num_points = points.size();
+
+    // Choose the window size minimising the number of additions, ceil(256 / c) * (num_points + 2 * 2^c)
+    size_t bits_per_window = 1;
+    size_t best_cost = SIZE_MAX;
+    for (size_t c = 1; c <= 16; ++c) {
+        const size_t cost = ((NUM_BITS + c - 1) / c) * (num_points + (size_t(2) << c));
+        if (cost < best_cost) {
+            best_cost = cost;
+            bits_per_window = c;
+        }
+    }
+    const size_t num_windows = (NUM_BITS + bits_per_window - 1) / bits_per_window;
+    const size_t num_buckets = (size_t(1) << bits_per_window) - 1;
+
+    std::vector<Element> window_sums(num_windows);
+    parallel_for_heuristic(
+        num_windows,
+        [&](size_t window) {
+            std::vector<Element> buckets(num_buckets, G1::point_at_infinity);
+            const uint64_t lo_bit = window * bits_per_window;
+            const uint64_t hi_bit = std::min(lo_bit + bits_per_window, uint64_t(NUM_BITS));
+            for (size_t i = 0; i < num_points; ++i) {
+                const auto digit = static_cast<size_t>(scalars[i].slice(lo_bit, hi_bit).data[0]);
+                if (digit != 0 && !points[i].is_point_at_infinity()) {
+                    buckets[digit - 1] += points[i];
+                }
+            }
+            // sum_j j * bucket_j, via running sums from the top bucket down
+            Element running_sum = G1::point_at_infinity;
+            Element window_sum = G1::point_at_infinity;
+            for (size_t j = num_buckets; j-- > 0;) {
+                running_sum += buckets[j];
+                window_sum += running_sum;
+            }
+            window_sums[window] = window_sum;
+        },
+        thread_heuristics::GE_ADDITION_COST * (num_points + 2 * num_buckets));
+
+    Element result = window_sums[num_windows - 1];
+    for (size_t window = num_windows - 1; window-- > 0;) {
+        for (size_t k = 0; k < bits_per_window; ++k) {
+            result.self_dbl();
+        }
+        result += window_sums[window];
+    }
+    return result;
+}
+} // namespace ecdsa_detail
+
+template <typename Hash, typename Fq, typename Fr, typename G1>
+std::vector<bool> ecdsa_verify_signatures(const std::vector<std::string>& messages,
+                                          const std::vector<typename G1::affine_element>& public_keys,
+                                          const std::vector<ecdsa_signature>& signatures)
+{
+    using serialize::read;
+    using AffineElement = typename G1::affine_element;
+
+    const size_t num_signatures = signatures.size();
+    if (messages.size() != num_signatures || public_keys.size() != num_signatures) {
+        throw_or_abort("ecdsa_verify_signatures: the numbers of messages, public keys and signatures differ");
+    }
+    const uint256_t mod = uint256_t(Fr::modulus);
+
+    // A valid signature satisfies R = u1 * G + u2 * Q, where u1 = z / s, u2 = r / s and R is recovered from r and the
+    // parity bit of v. Signatures that cannot take part in the combined check (malformed, not in canonical form, or
+    // with R not recoverable) are left to ecdsa_verify_signature.
+    std::vector<bool> results(num_signatures, false);
+    std::vector<size_t> batched;
+    std::vector<size_t> individual;
+    std::vector<AffineElement> R_points;
+    std::vector<Fr> r_values;
+    std::vector<Fr> s_inverses;
+    std::vector<Fr> z_values;
+    for (size_t i = 0; i < num_signatures; ++i) {
+        const auto& sig = signatures[i];
+        uint256_t r_uint;
+        uint256_t s_uint;
+        const auto* r_buf = &sig.r[0];
+        const auto* s_buf = &sig.s[0];
+        read(r_buf, r_uint);
+        read(s_buf, s_uint);
+        const bool well_formed = public_keys[i].on_curve() && !public_keys[i].is_point_at_infinity() &&
+                                 r_uint != 0 && r_uint < mod && s_uint != 0 && s_uint * 2 <= mod &&
+                                 (sig.v == 27 || sig.v == 28);
+        if (!well_formed) {
+            individual.push_back(i);
+            continue;
+        }
+        const Fq x(r_uint);
+        Fq y_squared = x.sqr() * x + G1::curve_b;
+        if constexpr (G1::has_a) {
+            y_squared += x * G1::curve_a;
+        }
+        auto [is_square, y] = y_squared.sqrt();
+        if (!is_square) {
+            individual.push_back(i);
+            continue;
+        }
+        if ((sig.v & 1) ^ static_cast<uint8_t>(uint256_t(y).get_bit(0))) {
+            y = -y;
+        }
+
+        std::vector<uint8_t> message_buffer(messages[i].begin(), messages[i].end());
+        auto ev = Hash::hash(message_buffer);
+
+        batched.push_back(i);
+        R_points.push_back(AffineElement(x, y));
+        r_values.push_back(Fr(r_uint));
+        s_inverses.push_back(Fr(s_uint));
+        z_values.push_back(Fr::serialize_from_buffer(&ev[0]));
+    }
+
+    // A lone signature has no additions to share, so it is cheaper to verify on its own
+    if (batched.size() == 1) {
+        individual.push_back(batched[0]);
+    } else if (!batched.empty()) {
+        Fr::batch_invert(s_inverses);
+
+        // sum_i a_i * (u1_i * G + u2_i * Q_i - R_i) = 0 for random 128-bit a_i. The MSM runs over G, the Q_i and the
+        // negated R_i, whose scalars a_i are only half-length.
+        const size_t num_batched = batched.size();
+        std::vector<AffineElement> points;
+        std::vector<uint256_t> scalars;
+        points.reserve(2 * num_batched + 1);
+        scalars.reserve(2 * num_batched + 1);
+        Fr generator_scalar = Fr::zero();
+        auto& engine = numeric::get_randomness();
+        for (size_t k = 0; k < num_batched; ++k) {
+            const uint256_t weight_uint(engine.get_random_uint64(), engine.get_random_uint64(), 0, 0);
+            const Fr weight(weight_uint);
+            generator_scalar += weight * z_values[k] * s_inverses[k];
+            points.push_back(public_keys[batched[k]]);
+            scalars.push_back(uint256_t(weight * r_values[k] * s_inverses[k]));
+            points.push_back(-R_points[k]);
+            scalars.push_back(weight_uint);
+        }
+        points.push_back(G1::affine_one);
+        scalars.push_back(uint256_t(generator_scalar));
+
+        if (ecdsa_detail::multi_scalar_mul<G1>(points, scalars).is_point_at_infinity()) {
+            for (size_t i : batched) {
+                results[i] = true;
+            }
+        } else {
+            individual.insert(individual.end(), batched.begin(), batched.end());
+        }
+    }
+
+    for (size_t i : individual) {
+        results[i] = ecdsa_verify_signature<Hash, Fq, Fr, G1>(messages[i], public_keys[i], signatures[i]);
+    }
+    return results;
+}
 } // namespace bb::crypto
@@ -35,6 +35,14 @@ extern "C" {
  */
 void ethash_keccakf1600(uint64_t state[25]) NOEXCEPT;
 
+/**
+ * The Keccak-f[1600] function on many independent states, several of them at a time in SIMD lanes.
+ *
+ * @param states      The num_states states of 25 64-bit words each, stored one after the other.
+ * @param num_states  The number of states.
+ */
+void ethash_keccakf1600_many(uint64_t* states, size_t num_states) NOEXCEPT;
+
 struct keccak256 ethash_keccak256(const uint8_t* data, size_t size) NOEXCEPT;
 
 struct keccak256 hash_field_elements(const uint64_t* limbs, size_t num_elements);
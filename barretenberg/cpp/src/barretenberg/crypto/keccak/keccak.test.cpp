@@ -0,0 +1,22 @@
+#include "keccak.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+
+TEST(Keccak, KeccakF1600ManyMatchesKeccakF1600)
+{
+    // Not a multiple of the number of lanes, so that the last batch is partially filled
+    constexpr size_t num_states = 7;
+    std::vector<uint64_t> states(num_states * 25);
+    uint64_t word = 0x0123456789abcdef;
+    for (auto& element : states) {
+        word = word * 6364136223846793005ULL + 1442695040888963407ULL;
+        element = word;
+    }
+
+    std::vector<uint64_t> expected = states;
+    for (size_t i = 0; i < num_states; ++i) {
+        ethash_keccakf1600(&expected[i * 25]);
+    }
+    ethash_keccakf1600_many(states.data(), num_states);
+    EXPECT_EQ(states, expected);
+}
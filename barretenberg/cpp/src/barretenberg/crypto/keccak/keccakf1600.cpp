@@ -11,6 +11,7 @@
 
 #include "keccak.hpp"
 #include <stdint.h>
+#include <string.h>
 
 static uint64_t rol(uint64_t x, unsigned s)
 {
@@ -239,3 +240,79 @@ void ethash_keccakf1600(uint64_t state[25]) NOEXCEPT
     state[23] = Aso;
     state[24] = Asu;
 }
+
+/* Number of states permuted side by side by ethash_keccakf1600_many. Four 64-bit lanes fill an AVX2 register.
+   Targets with 128-bit vectors only lack 64-bit rotates and lose against the scalar code, so they permute one state
+   at a time. */
+#if defined(__AVX2__)
+#define KECCAK_USE_LANES 1
+#define KECCAK_NUM_LANES 4
+typedef uint64_t keccak_lanes __attribute__((vector_size(KECCAK_NUM_LANES * sizeof(uint64_t))));
+
+static inline keccak_lanes rol_lanes(keccak_lanes x, unsigned s)
+{
+    return s == 0 ? x : (x << s) | (x >> (64 - s));
+}
+
+/* Rotation offsets of the rho step and destinations of the pi step, indexed by the position x + 5y in the state. */
+static const unsigned rho_offsets[25] = { 0,  1,  62, 28, 27, 36, 44, 6,  55, 20, 3,  10, 43,
+                                          25, 39, 41, 45, 15, 21, 8,  18, 2,  61, 56, 14 };
+static const unsigned pi_destinations[25] = { 0,  10, 20, 5,  15, 16, 1,  11, 21, 6,  7,  17, 2,
+                                              12, 22, 23, 8,  18, 3,  13, 14, 24, 9,  19, 4 };
+
+static void keccakf1600_lanes(keccak_lanes A[25])
+{
+    keccak_lanes B[25];
+    keccak_lanes C[5];
+    keccak_lanes D[5];
+
+    for (int round = 0; round < 24; ++round) {
+        /* theta */
+        for (int x = 0; x < 5; ++x) {
+            C[x] = A[x] ^ A[x + 5] ^ A[x + 10] ^ A[x + 15] ^ A[x + 20];
+        }
+        for (int x = 0; x < 5; ++x) {
+            D[x] = C[(x + 4) % 5] ^ rol_lanes(C[(x + 1) % 5], 1);
+        }
+        /* rho and pi */
+        for (int i = 0; i < 25; ++i) {
+            B[pi_destinations[i]] = rol_lanes(A[i] ^ D[i % 5], rho_offsets[i]);
+        }
+        /* chi */
+        for (int y = 0; y < 25; y += 5) {
+            for (int x = 0; x < 5; ++x) {
+                A[y + x] = B[y + x] ^ (~B[y + (x + 1) % 5] & B[y + (x + 2) % 5]);
+            }
+        }
+        /* iota */
+        A[0] ^= round_constants[round];
+    }
+}
+#endif
+
+void ethash_keccakf1600_many(uint64_t* states, size_t num_states) NOEXCEPT
+{
+#ifndef KECCAK_USE_LANES
+    for (size_t i = 0; i < num_states; ++i) {
+        ethash_keccakf1600(&states[i * 25]);
+    }
+#else
+    for (size_t start = 0; start < num_states; start += KECCAK_NUM_LANES) {
+        const size_t remaining = num_states - start;
+        const size_t num_lanes = remaining < KECCAK_NUM_LANES ? remaining : KECCAK_NUM_LANES;
+        keccak_lanes A[25];
+        memset(A, 0, sizeof(A));
+        for (size_t lane = 0; lane < num_lanes; ++lane) {
+            for (size_t i = 0; i < 25; ++i) {
+                A[i][lane] = states[(start + lane) * 25 + i];
+            }
+        }
+        keccakf1600_lanes(A);
+        for (size_t lane = 0; lane < num_lanes; ++lane) {
+            for (size_t i = 0; i < 25; ++i) {
+                states[(start + lane) * 25 + i] = A[i][lane];
+            }
+        }
+    }
+#endif
+}
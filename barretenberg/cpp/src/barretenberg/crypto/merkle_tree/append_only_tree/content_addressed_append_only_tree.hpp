@@ -15,6 +15,7 @@
 #include <optional>
 #include <ostream>
 #include <random>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <utility>
@@ -1146,10 +1147,14 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::add_batch_internal(
         index >>= 1;
         --level;
         // std::cout << "To INSERT " << number_to_insert << std::endl;
+        // The pairs of a level are independent, so they are hashed in one batch
+        std::vector<fr> parents =
+            HashingPolicy::hash_pairs(std::span<const fr>(hashes_local.data(), size_t(number_to_insert) * 2));
         for (uint32_t i = 0; i < number_to_insert; ++i) {
-            fr left = hashes_local[i * 2];
-            fr right = hashes_local[i * 2 + 1];
-            hashes_local[i] = HashingPolicy::hash_pair(left, right);
+            // Copies, since hashes_local[i] is overwritten with the parent below
+            const fr left = hashes_local[i * 2];
+            const fr right = hashes_local[i * 2 + 1];
+            hashes_local[i] = parents[i];
             // std::cout << "Left: " << left << ", right: " << right << ", parent: " << hashes_local[i] << std::endl;
             store_->put_node_by_hash(hashes_local[i], { .left = left, .right = right, .ref = 1 });
             store_->put_cached_node_by_index(level, index + i, hashes_local[i]);
@@ -14,6 +14,7 @@
 #include "barretenberg/stdlib/hash/blake2s/blake2s.hpp"
 #include "barretenberg/stdlib/hash/pedersen/pedersen.hpp"
 #include "barretenberg/stdlib/primitives/field/field.hpp"
+#include <span>
 #include <vector>
 
 namespace bb::crypto::merkle_tree {
@@ -21,8 +22,23 @@ namespace bb::crypto::merkle_tree {
 struct PedersenHashPolicy {
     static fr hash(const std::vector<fr>& inputs) { return crypto::pedersen_hash::hash(inputs); }
 
+    static std::vector<fr> hash_many(const std::vector<std::vector<fr>>& inputs)
+    {
+        return crypto::pedersen_hash::hash_many(inputs);
+    }
+
     static fr hash_pair(const fr& lhs, const fr& rhs) { return hash(std::vector<fr>({ lhs, rhs })); }
 
+    // Hashes (inputs[0], inputs[1]), (inputs[2], inputs[3]), ...
+    static std::vector<fr> hash_pairs(std::span<const fr> inputs)
+    {
+        std::vector<fr> outputs(inputs.size() / 2);
+        for (size_t i = 0; i < outputs.size(); ++i) {
+            outputs[i] = hash_pair(inputs[2 * i], inputs[2 * i + 1]);
+        }
+        return outputs;
+    }
+
     static fr zero_hash() { return fr::zero(); }
 };
 
@@ -32,8 +48,19 @@ struct Poseidon2HashPolicy {
         return bb::crypto::Poseidon2<bb::crypto::Poseidon2Bn254ScalarFieldParams>::hash(inputs);
     }
 
+    static std::vector<fr> hash_many(const std::vector<std::vector<fr>>& inputs)
+    {
+        return bb::crypto::Poseidon2<bb::crypto::Poseidon2Bn254ScalarFieldParams>::hash_many(inputs);
+    }
+
     static fr hash_pair(const fr& lhs, const fr& rhs) { return hash(std::vector<fr>({ lhs, rhs })); }
 
+    // Hashes (inputs[0], inputs[1]), (inputs[2], inputs[3]), ...
+    static std::vector<fr> hash_pairs(std::span<const fr> inputs)
+    {
+        return bb::crypto::Poseidon2<bb::crypto::Poseidon2Bn254ScalarFieldParams>::hash_pairs(inputs);
+    }
+
     static fr zero_hash() { return fr::zero(); }
 };
 
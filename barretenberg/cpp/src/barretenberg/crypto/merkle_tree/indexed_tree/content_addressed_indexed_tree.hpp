@@ -898,9 +898,17 @@ void ContentAddressedIndexedTree<Store, HashingPolicy>::generate_hashes_for_appe
         [=, this](TypedResponse<HashGenerationResponse>& response) {
             response.inner.hashes = std::make_shared<std::vector<fr>>(leaves_to_hash->size(), 0);
             std::vector<IndexedLeafValueType>& leaves = *leaves_to_hash;
+            std::vector<std::vector<fr>> hash_inputs;
+            for (IndexedLeafValueType& leaf : leaves) {
+                if (!leaf.is_empty()) {
+                    hash_inputs.push_back(leaf.get_hash_inputs());
+                }
+            }
+            std::vector<fr> non_empty_hashes = HashingPolicy::hash_many(hash_inputs);
+            size_t next_hash = 0;
             for (uint32_t i = 0; i < leaves.size(); ++i) {
                 IndexedLeafValueType& leaf = leaves[i];
-                fr hash = leaf.is_empty() ? fr::zero() : HashingPolicy::hash(leaf.get_hash_inputs());
+                fr hash = leaf.is_empty() ? fr::zero() : non_empty_hashes[next_hash++];
                 (*response.inner.hashes)[i] = hash;
                 store_->put_leaf_by_hash(hash, leaf);
             }
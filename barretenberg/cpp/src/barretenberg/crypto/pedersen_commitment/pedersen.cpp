@@ -6,11 +6,121 @@
 
 #include "./pedersen.hpp"
 #include "barretenberg/common/serialize.hpp"
+#include "barretenberg/common/assert.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
 #include <iostream>
 
 namespace bb::crypto {
 
+template <typename Curve> FixedBaseTable<Curve>::FixedBaseTable(const AffineElement& generator)
+{
+    std::vector<Element> elements(NUM_WINDOWS * NUM_DIGITS);
+    Element window_base = generator;
+    for (size_t window = 0; window < NUM_WINDOWS; ++window) {
+        Element* multiples = &elements[window * NUM_DIGITS];
+        multiples[0] = window_base;
+        for (size_t digit = 1; digit < NUM_DIGITS; ++digit) {
+            multiples[digit] = multiples[digit - 1] + window_base;
+        }
+        // 2^{4(w + 1)} * g = 15 * 2^{4w} * g + 2^{4w} * g
+        window_base = multiples[NUM_DIGITS - 1] + window_base;
+    }
+    Element::batch_normalize(elements.data(), elements.size());
+
+    points.reserve(elements.size());
+    for (const auto& element : elements) {
+        points.emplace_back(element.x, element.y);
+    }
+}
+
+template <typename Curve> void FixedBaseTable<Curve>::accumulate(Element& accumulator, const uint256_t& scalar) const
+{
+    constexpr size_t WINDOWS_PER_LIMB = 64 / WINDOW_BITS;
+    for (size_t window = 0; window < NUM_WINDOWS; ++window) {
+        const uint64_t limb = scalar.data[window / WINDOWS_PER_LIMB];
+        const auto digit = static_cast<size_t>((limb >> ((window % WINDOWS_PER_LIMB) * WINDOW_BITS)) & NUM_DIGITS);
+        if (digit != 0) {
+            accumulator += points[window * NUM_DIGITS + digit - 1];
+        }
+    }
+}
+
+template <typename Curve>
+typename pedersen_commitment_base<Curve>::DefaultTables& pedersen_commitment_base<Curve>::default_tables()
+{
+    static DefaultTables tables;
+    return tables;
+}
+
+/**
+ * @brief Get the fixed-base table of the default generator with the given index, building it if it is missing
+ *
+ * @details The table is built by the first thread that needs it, without holding any lock shared with other tables
+ * and without using the thread pool, so this can be called from within a parallel_for. The generator is derived
+ * directly rather than through generator_data, which is not safe to extend concurrently.
+ */
+template <typename Curve>
+const typename pedersen_commitment_base<Curve>::Table* pedersen_commitment_base<Curve>::get_default_table(
+    const size_t generator_index)
+{
+    ASSERT(generator_index < MAX_DEFAULT_TABLES);
+    DefaultTables& cache = default_tables();
+    if (const Table* table = cache.published[generator_index].load(std::memory_order_acquire)) {
+        return table;
+    }
+    std::call_once(cache.built[generator_index], [&]() {
+        using Generators = generator_data<Curve>;
+        const AffineElement generator =
+            generator_index < Generators::DEFAULT_NUM_GENERATORS
+                ? Generators::precomputed_generators[generator_index]
+                : Group::derive_generators(Generators::DEFAULT_DOMAIN_SEPARATOR, 1, generator_index)[0];
+        cache.tables[generator_index] = std::make_unique<const Table>(generator);
+        cache.published[generator_index].store(cache.tables[generator_index].get(), std::memory_order_release);
+    });
+    return cache.tables[generator_index].get();
+}
+
+/**
+ * @brief Get the fixed-base tables of the default generators [generator_offset, generator_offset + num_generators),
+ * building the ones that are missing
+ */
+template <typename Curve>
+std::vector<const typename pedersen_commitment_base<Curve>::Table*> pedersen_commitment_base<Curve>::get_default_tables(
+    const size_t num_generators, const size_t generator_offset)
+{
+    std::vector<const Table*> result(num_generators);
+    for (size_t i = 0; i < num_generators; ++i) {
+        result[i] = get_default_table(generator_offset + i);
+    }
+    return result;
+}
+
+/**
+ * @brief Same as commit_native, without normalizing the result
+ *
+ * @details The default generators go through their precomputed fixed-base tables, so the whole commitment is a sum of
+ * table entries and needs no doublings. Other generator sets, and default generators past MAX_DEFAULT_TABLES, fall
+ * back to a variable-base multiplication per input.
+ */
+template <typename Curve>
+typename Curve::Element pedersen_commitment_base<Curve>::commit_native_projective(const std::vector<Fq>& inputs,
+                                                                                  const GeneratorContext& context)
+{
+    Element result = Group::point_at_infinity;
+    if (uses_default_tables(context, inputs.size())) {
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            get_default_table(context.offset + i)->accumulate(result, static_cast<uint256_t>(inputs[i]));
+        }
+        return result;
+    }
+
+    const auto generators = context.generators->get(inputs.size(), context.offset, context.domain_separator);
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        result += Element(generators[i]) * static_cast<uint256_t>(inputs[i]);
+    }
+    return result;
+}
+
 /**
  * @brief Given a vector of fields, generate a pedersen commitment using the indexed generators.
  *
@@ -24,13 +134,8 @@ template <typename Curve>
 typename Curve::AffineElement pedersen_commitment_base<Curve>::commit_native(const std::vector<Fq>& inputs,
                                                                              const GeneratorContext context)
 {
-    const auto generators = context.generators->get(inputs.size(), context.offset, context.domain_separator);
-    Element result = Group::point_at_infinity;
-
-    for (size_t i = 0; i < inputs.size(); ++i) {
-        result += Element(generators[i]) * static_cast<uint256_t>(inputs[i]);
-    }
-    return result.normalize();
+    return commit_native_projective(inputs, context).normalize();
 }
+template class FixedBaseTable<curve::Grumpkin>;
 template class pedersen_commitment_base<curve::Grumpkin>;
 } // namespace bb::crypto
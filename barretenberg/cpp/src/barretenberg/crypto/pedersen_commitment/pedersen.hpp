@@ -11,9 +11,38 @@
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
 
 namespace bb::crypto {
 
+/**
+ * @brief Precomputed 4-bit windows of a fixed generator `g`, i.e. `d * 2^{4w} * g` for every window w and digit d
+ *
+ * @details Multiplying `g` by a scalar then costs one mixed addition per non-zero window and no doublings. The
+ * accumulator is passed in, so that the terms of a multi-scalar multiplication over several tables are all added into
+ * the same point.
+ */
+template <typename Curve> class FixedBaseTable {
+  public:
+    using AffineElement = typename Curve::AffineElement;
+    using Element = typename Curve::Element;
+
+    static constexpr size_t WINDOW_BITS = 4;
+    static constexpr size_t NUM_WINDOWS = 256 / WINDOW_BITS;
+    // Zero digits contribute nothing and are not stored
+    static constexpr size_t NUM_DIGITS = (1UL << WINDOW_BITS) - 1;
+
+    explicit FixedBaseTable(const AffineElement& generator);
+
+    // accumulator += scalar * g
+    void accumulate(Element& accumulator, const uint256_t& scalar) const;
+
+  private:
+    std::vector<AffineElement> points;
+};
+
 /**
  * @brief Performs pedersen commitments!
  *
@@ -32,8 +61,34 @@ template <typename Curve> class pedersen_commitment_base {
     using Fq = typename Curve::BaseField;
     using Group = typename Curve::Group;
     using GeneratorContext = typename crypto::GeneratorContext<Curve>;
+    using Table = FixedBaseTable<Curve>;
+
+    // Number of default generators that get a fixed-base table (~61KB each). Tables are built on first use and kept
+    // for the lifetime of the process, so the cache is bounded by MAX_DEFAULT_TABLES tables (~15.6MB); commitments
+    // that use default generators beyond these go through variable-base multiplications instead.
+    static constexpr size_t MAX_DEFAULT_TABLES = 256;
 
     static AffineElement commit_native(const std::vector<Fq>& inputs, GeneratorContext context = {});
+    static Element commit_native_projective(const std::vector<Fq>& inputs, const GeneratorContext& context = {});
+    static std::vector<const Table*> get_default_tables(size_t num_generators, size_t generator_offset);
+    // Whether commitments of num_inputs inputs with the given generators go through the fixed-base tables
+    static bool uses_default_tables(const GeneratorContext& context, const size_t num_inputs)
+    {
+        return context.generators == generator_data<Curve>::get_default_generators() &&
+               context.domain_separator == generator_data<Curve>::DEFAULT_DOMAIN_SEPARATOR &&
+               context.offset + num_inputs <= MAX_DEFAULT_TABLES;
+    }
+
+  private:
+    // Fixed-base tables of the default generators, indexed by generator index. A table is published once it is built,
+    // so looking up an existing table takes no lock.
+    struct DefaultTables {
+        std::array<std::atomic<const Table*>, MAX_DEFAULT_TABLES> published{};
+        std::array<std::once_flag, MAX_DEFAULT_TABLES> built;
+        std::array<std::unique_ptr<const Table>, MAX_DEFAULT_TABLES> tables;
+    };
+    static DefaultTables& default_tables();
+    static const Table* get_default_table(size_t generator_index);
 };
 
 using pedersen_commitment = pedersen_commitment_base<curve::Grumpkin>;
@@ -1,4 +1,5 @@
 #include "pedersen.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/timer.hpp"
 #include "barretenberg/crypto/generators/generator_data.hpp"
 #include <gtest/gtest.h>
@@ -28,6 +29,67 @@ TEST(Pedersen, CommitmentWithZero)
     EXPECT_EQ(r, expected);
 }
 
+TEST(Pedersen, FixedBaseCommitmentMatchesVariableBase)
+{
+    // Sizes and offsets on both sides of the compile-time precomputed generators
+    for (size_t offset : { 0, 3, 9 }) {
+        for (size_t num_inputs : { 1, 2, 7, 8, 20 }) {
+            std::vector<pedersen_commitment::Fq> inputs(num_inputs);
+            for (auto& input : inputs) {
+                input = pedersen_commitment::Fq::random_element();
+            }
+            inputs[0] = -pedersen_commitment::Fq::one();
+
+            const auto generators = generator_data<curve::Grumpkin>::get_default_generators()->get(num_inputs, offset);
+            pedersen_commitment::Element expected = grumpkin::g1::point_at_infinity;
+            for (size_t i = 0; i < num_inputs; ++i) {
+                expected += pedersen_commitment::Element(generators[i]) * static_cast<uint256_t>(inputs[i]);
+            }
+            EXPECT_EQ(pedersen_commitment::commit_native(inputs, offset), pedersen_commitment::AffineElement(expected));
+        }
+    }
+}
+
+// Commitment to inputs computed with variable-base multiplications
+pedersen_commitment::AffineElement variable_base_commitment(const std::vector<pedersen_commitment::Fq>& inputs,
+                                                            const size_t offset)
+{
+    const auto generators = generator_data<curve::Grumpkin>::get_default_generators()->get(inputs.size(), offset);
+    pedersen_commitment::Element result = grumpkin::g1::point_at_infinity;
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        result += pedersen_commitment::Element(generators[i]) * static_cast<uint256_t>(inputs[i]);
+    }
+    return pedersen_commitment::AffineElement(result);
+}
+
+TEST(Pedersen, CommitmentInsideParallelFor)
+{
+    // Tables not built by any other test are built from inside the parallel loop, several threads needing each of them
+    const size_t num_commitments = 16;
+    const size_t first_offset = 100;
+    std::vector<std::vector<pedersen_commitment::Fq>> inputs(num_commitments);
+    for (auto& input : inputs) {
+        input = { pedersen_commitment::Fq::random_element(), pedersen_commitment::Fq::random_element() };
+    }
+    std::vector<pedersen_commitment::AffineElement> results(num_commitments);
+    parallel_for(num_commitments, [&](size_t i) {
+        results[i] = pedersen_commitment::commit_native(inputs[i], first_offset + i % 4);
+    });
+
+    for (size_t i = 0; i < num_commitments; ++i) {
+        EXPECT_EQ(results[i], variable_base_commitment(inputs[i], first_offset + i % 4));
+    }
+}
+
+TEST(Pedersen, CommitmentPastCachedTables)
+{
+    // Generators past the cached tables go through variable-base multiplications
+    const size_t offset = pedersen_commitment::MAX_DEFAULT_TABLES - 1;
+    const std::vector<pedersen_commitment::Fq> inputs{ pedersen_commitment::Fq::random_element(),
+                                                       pedersen_commitment::Fq::random_element() };
+    EXPECT_EQ(pedersen_commitment::commit_native(inputs, offset), variable_base_commitment(inputs, offset));
+}
+
 TEST(Pedersen, CommitmentProf)
 {
     GTEST_SKIP() << "Skipping mini profiler.";
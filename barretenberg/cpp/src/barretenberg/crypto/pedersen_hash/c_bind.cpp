@@ -7,6 +7,7 @@
 #include "c_bind.hpp"
 #include "barretenberg/common/mem.hpp"
 #include "barretenberg/common/serialize.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
 #include "pedersen.hpp"
 
 using namespace bb;
@@ -38,6 +39,26 @@ WASM_EXPORT void pedersen_hashes(fr::vec_in_buf inputs_buffer, uint32_t const* h
     write(output, results);
 }
 
+WASM_EXPORT void pedersen_hash_many(fr::vec_in_buf inputs_buffer,
+                                    uint32_t const* hash_size,
+                                    uint32_t const* hash_index,
+                                    fr::vec_out_buf output)
+{
+    std::vector<grumpkin::fq> to_hash;
+    read(inputs_buffer, to_hash);
+    const auto size = static_cast<size_t>(ntohl(*hash_size));
+    if (size == 0 || to_hash.size() % size != 0) {
+        throw_or_abort("pedersen_hash_many: the inputs do not split into hashes of the given size");
+    }
+    std::vector<std::vector<grumpkin::fq>> inputs;
+    for (auto it = to_hash.begin(); it != to_hash.end(); it += static_cast<std::ptrdiff_t>(size)) {
+        inputs.emplace_back(it, it + static_cast<std::ptrdiff_t>(size));
+    }
+    crypto::GeneratorContext<curve::Grumpkin> ctx;
+    ctx.offset = static_cast<size_t>(ntohl(*hash_index));
+    *output = to_heap_buffer(crypto::pedersen_hash::hash_many(inputs, ctx));
+}
+
 WASM_EXPORT void pedersen_hash_buffer(uint8_t const* input_buffer, uint32_t const* hash_index, fr::out_buf output)
 {
     std::vector<uint8_t> to_hash;
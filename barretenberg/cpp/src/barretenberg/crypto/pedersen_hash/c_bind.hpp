@@ -15,5 +15,9 @@ using namespace bb;
 
 WASM_EXPORT void pedersen_hash(fr::vec_in_buf inputs_buffer, uint32_t const* hash_index, fr::out_buf output);
 WASM_EXPORT void pedersen_hashes(fr::vec_in_buf inputs_buffer, uint32_t const* hash_index, fr::out_buf output);
+WASM_EXPORT void pedersen_hash_many(fr::vec_in_buf inputs_buffer,
+                                    uint32_t const* hash_size,
+                                    uint32_t const* hash_index,
+                                    fr::vec_out_buf output);
 WASM_EXPORT void pedersen_hash_buffer(uint8_t const* input_buffer, uint32_t const* hash_index, fr::out_buf output);
 }
\ No newline at end of file
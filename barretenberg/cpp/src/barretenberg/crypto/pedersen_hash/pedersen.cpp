@@ -6,6 +6,7 @@
 
 #include "./pedersen.hpp"
 #include "../pedersen_commitment/pedersen.hpp"
+#include "barretenberg/common/thread.hpp"
 
 namespace bb::crypto {
 
@@ -77,8 +78,59 @@ std::vector<typename Curve::BaseField> pedersen_hash_base<Curve>::convert_buffer
 template <typename Curve>
 typename Curve::BaseField pedersen_hash_base<Curve>::hash(const std::vector<Fq>& inputs, const GeneratorContext context)
 {
-    Element result = length_generator * Fr(inputs.size());
-    return (result + pedersen_commitment_base<Curve>::commit_native(inputs, context)).normalize().x;
+    return hash_projective(inputs, context).normalize().x;
+}
+
+template <typename Curve> const FixedBaseTable<Curve>& pedersen_hash_base<Curve>::length_generator_table()
+{
+    static const FixedBaseTable<Curve> table(length_generator);
+    return table;
+}
+
+template <typename Curve>
+typename Curve::Element pedersen_hash_base<Curve>::hash_projective(const std::vector<Fq>& inputs,
+                                                                   const GeneratorContext& context)
+{
+    Element result = pedersen_commitment_base<Curve>::commit_native_projective(inputs, context);
+    length_generator_table().accumulate(result, uint256_t(inputs.size()));
+    return result;
+}
+
+/**
+ * @brief Hash each of `inputs` with the generators from `context`, i.e. `hash(inputs[i], context)` for every i.
+ *
+ * @details The hashes are computed in parallel and share a single batched normalization.
+ */
+template <typename Curve>
+std::vector<typename Curve::BaseField> pedersen_hash_base<Curve>::hash_many(const std::vector<std::vector<Fq>>& inputs,
+                                                                            const GeneratorContext context)
+{
+    // Extend the generators up front, generator_data should not grow from inside the parallel loop. The tables could be
+    // built from inside it, but building them here avoids all threads waiting on the first one that needs them.
+    size_t max_num_inputs = 0;
+    for (const auto& input : inputs) {
+        max_num_inputs = std::max(max_num_inputs, input.size());
+    }
+    if (pedersen_commitment_base<Curve>::uses_default_tables(context, max_num_inputs)) {
+        pedersen_commitment_base<Curve>::get_default_tables(max_num_inputs, context.offset);
+    } else {
+        static_cast<void>(context.generators->get(max_num_inputs, context.offset, context.domain_separator));
+    }
+    length_generator_table();
+
+    std::vector<Element> results(inputs.size());
+    parallel_for_heuristic(
+        inputs.size(),
+        [&](size_t i) { results[i] = hash_projective(inputs[i], context); },
+        thread_heuristics::GE_ADDITION_COST * FixedBaseTable<Curve>::NUM_WINDOWS * (max_num_inputs + 1));
+    Element::batch_normalize(results.data(), results.size());
+
+    std::vector<Fq> hashes;
+    hashes.reserve(results.size());
+    for (const auto& result : results) {
+        hashes.emplace_back(result.x);
+    }
+    return hashes;
 }
 
 /**
@@ -7,6 +7,7 @@
 #pragma once
 
 #include "../generators/generator_data.hpp"
+#include "../pedersen_commitment/pedersen.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include "barretenberg/ecc/groups/precomputed_generators_grumpkin_impl.hpp"
 namespace bb::crypto {
@@ -39,9 +40,12 @@ template <typename Curve> class pedersen_hash_base {
         get_precomputed_generators<Group, "pedersen_hash_length", 1>()[0];
     static Fq hash(const std::vector<Fq>& inputs, GeneratorContext context = {});
     static Fq hash_buffer(const std::vector<uint8_t>& input, GeneratorContext context = {});
+    static std::vector<Fq> hash_many(const std::vector<std::vector<Fq>>& inputs, GeneratorContext context = {});
 
   private:
     static std::vector<Fq> convert_buffer(const std::vector<uint8_t>& input);
+    static Element hash_projective(const std::vector<Fq>& inputs, const GeneratorContext& context);
+    static const FixedBaseTable<Curve>& length_generator_table();
 };
 
 using pedersen_hash = pedersen_hash_base<curve::Grumpkin>;
@@ -32,4 +32,23 @@ TEST(Pedersen, HashWithIndex)
     EXPECT_EQ(r, fr(uint256_t("1c446df60816b897cda124524e6b03f36df0cec333fad87617aab70d7861daa6")));
 }
 
-} // namespace bb::crypto
\ No newline at end of file
+TEST(Pedersen, HashMany)
+{
+    std::vector<std::vector<pedersen_hash::Fq>> inputs;
+    for (size_t num_inputs = 0; num_inputs < 12; ++num_inputs) {
+        std::vector<pedersen_hash::Fq> input(num_inputs);
+        for (auto& element : input) {
+            element = pedersen_hash::Fq::random_element();
+        }
+        inputs.push_back(input);
+    }
+    for (size_t hash_index : { 0, 5 }) {
+        const auto hashes = pedersen_hash::hash_many(inputs, hash_index);
+        ASSERT_EQ(hashes.size(), inputs.size());
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            EXPECT_EQ(hashes[i], pedersen_hash::hash(inputs[i], hash_index));
+        }
+    }
+}
+
+} // namespace bb::crypto
@@ -7,6 +7,7 @@
 #include "c_bind.hpp"
 #include "barretenberg/common/mem.hpp"
 #include "barretenberg/common/serialize.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
 #include "poseidon2.hpp"
 #include "poseidon2_permutation.hpp"
 
@@ -25,15 +26,51 @@ WASM_EXPORT void poseidon2_hashes(fr::vec_in_buf inputs_buffer, fr::out_buf outp
     std::vector<fr> to_hash;
     read(inputs_buffer, to_hash);
     const size_t numHashes = to_hash.size() / 2;
+    std::vector<std::vector<fr>> inputs;
+    inputs.reserve(numHashes);
+    for (size_t count = 0; count < numHashes; ++count) {
+        inputs.push_back({ to_hash[count * 2], to_hash[count * 2 + 1] });
+    }
+    write(output, crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>::hash_many(inputs));
+}
+
+WASM_EXPORT void poseidon2_hash_many(fr::vec_in_buf inputs_buffer, uint32_t const* hash_size, fr::vec_out_buf output)
+{
+    std::vector<fr> to_hash;
+    read(inputs_buffer, to_hash);
+    const auto size = static_cast<size_t>(ntohl(*hash_size));
+    if (size == 0 || to_hash.size() % size != 0) {
+        throw_or_abort("poseidon2_hash_many: the inputs do not split into hashes of the given size");
+    }
+    std::vector<std::vector<fr>> inputs;
+    for (auto it = to_hash.begin(); it != to_hash.end(); it += static_cast<std::ptrdiff_t>(size)) {
+        inputs.emplace_back(it, it + static_cast<std::ptrdiff_t>(size));
+    }
+    *output = to_heap_buffer(crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>::hash_many(inputs));
+}
+
+WASM_EXPORT void poseidon2_permutations(fr::vec_in_buf inputs_buffer, fr::vec_out_buf output)
+{
+    using Permutation = crypto::Poseidon2Permutation<crypto::Poseidon2Bn254ScalarFieldParams>;
+
+    std::vector<fr> to_permute;
+    read(inputs_buffer, to_permute);
+    if (to_permute.size() % Permutation::t != 0) {
+        throw_or_abort("poseidon2_permutations: the inputs do not split into permutation states");
+    }
+    std::vector<Permutation::State> states(to_permute.size() / Permutation::t);
+    for (size_t i = 0; i < states.size(); ++i) {
+        std::copy_n(&to_permute[i * Permutation::t], Permutation::t, states[i].data());
+    }
+
+    Permutation::permutation_many(states);
+
     std::vector<fr> results;
-    size_t count = 0;
-    while (count < numHashes) {
-        auto r = crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>::hash(
-            { to_hash[count * 2], to_hash[count * 2 + 1] });
-        results.push_back(r);
-        ++count;
+    results.reserve(to_permute.size());
+    for (const auto& state : states) {
+        results.insert(results.end(), state.begin(), state.end());
     }
-    write(output, results);
+    *output = to_heap_buffer(results);
 }
 
 WASM_EXPORT void poseidon2_permutation(fr::vec_in_buf inputs_buffer, fr::vec_out_buf output)
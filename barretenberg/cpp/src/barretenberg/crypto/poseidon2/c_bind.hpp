@@ -15,6 +15,8 @@ using namespace bb;
 
 WASM_EXPORT void poseidon2_hash(fr::vec_in_buf inputs_buffer, fr::out_buf output);
 WASM_EXPORT void poseidon2_hashes(fr::vec_in_buf inputs_buffer, fr::out_buf output);
+WASM_EXPORT void poseidon2_hash_many(fr::vec_in_buf inputs_buffer, uint32_t const* hash_size, fr::vec_out_buf output);
 WASM_EXPORT void poseidon2_permutation(fr::vec_in_buf inputs_buffer, fr::vec_out_buf output);
+WASM_EXPORT void poseidon2_permutations(fr::vec_in_buf inputs_buffer, fr::vec_out_buf output);
 WASM_EXPORT void poseidon2_hash_accumulate(fr::vec_in_buf inputs_buffer, fr::out_buf output);
 }
@@ -5,6 +5,7 @@
 // =====================
 
 #include "poseidon2.hpp"
+#include "barretenberg/common/assert.hpp"
 
 namespace bb::crypto {
 /**
@@ -16,6 +17,89 @@ typename Poseidon2<Params>::FF Poseidon2<Params>::hash(const std::vector<typenam
     return Sponge::hash_internal(input);
 }
 
+/**
+ * @brief Hashes each vector of field elements in `inputs`
+ * @details Mirrors Sponge::hash_internal<1>: the inputs are absorbed `rate` elements at a time with one permutation
+ * per chunk (and one for an empty input), and the output is the first element of the final state. Chunk i of every
+ * input that has one is absorbed at once and the corresponding states are permuted together.
+ */
+template <typename Params>
+std::vector<typename Poseidon2<Params>::FF> Poseidon2<Params>::hash_many(
+    const std::vector<std::vector<typename Poseidon2<Params>::FF>>& inputs)
+{
+    using State = typename Permutation::State;
+    constexpr size_t rate = Params::t - 1;
+
+    const auto get_num_chunks = [](size_t in_len) { return std::max((in_len + rate - 1) / rate, size_t(1)); };
+
+    std::vector<State> states(inputs.size());
+    size_t max_num_chunks = 0;
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        const uint256_t iv = static_cast<uint256_t>(inputs[i].size()) << 64;
+        states[i] = State{};
+        states[i][rate] = iv;
+        max_num_chunks = std::max(max_num_chunks, get_num_chunks(inputs[i].size()));
+    }
+
+    std::vector<size_t> active;
+    std::vector<State> active_states;
+    for (size_t chunk = 0; chunk < max_num_chunks; ++chunk) {
+        active.clear();
+        active_states.clear();
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            if (chunk >= get_num_chunks(inputs[i].size())) {
+                continue;
+            }
+            State state = states[i];
+            for (size_t j = chunk * rate; j < std::min((chunk + 1) * rate, inputs[i].size()); ++j) {
+                state[j - chunk * rate] += inputs[i][j];
+            }
+            active.push_back(i);
+            active_states.push_back(state);
+        }
+        Permutation::permutation_many(active_states);
+        for (size_t k = 0; k < active.size(); ++k) {
+            states[active[k]] = active_states[k];
+        }
+    }
+
+    std::vector<FF> outputs(inputs.size());
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        outputs[i] = states[i][0];
+    }
+    return outputs;
+}
+
+/**
+ * @brief Hashes the pairs (inputs[0], inputs[1]), (inputs[2], inputs[3]), ...
+ * @details A pair fits in the rate, so every pair is absorbed into its own state, as in Sponge::hash_internal<1>, and
+ * all the states are permuted together.
+ */
+template <typename Params>
+std::vector<typename Poseidon2<Params>::FF> Poseidon2<Params>::hash_pairs(std::span<const FF> inputs)
+{
+    using State = typename Permutation::State;
+    constexpr size_t rate = Params::t - 1;
+    static_assert(rate >= 2);
+    BB_ASSERT_EQ(inputs.size() % 2, static_cast<size_t>(0), "Poseidon2::hash_pairs: odd number of inputs");
+
+    const uint256_t iv = static_cast<uint256_t>(2) << 64;
+    std::vector<State> states(inputs.size() / 2);
+    for (size_t i = 0; i < states.size(); ++i) {
+        states[i] = State{};
+        states[i][0] = inputs[2 * i];
+        states[i][1] = inputs[2 * i + 1];
+        states[i][rate] = iv;
+    }
+    Permutation::permutation_many(states);
+
+    std::vector<FF> outputs(states.size());
+    for (size_t i = 0; i < states.size(); ++i) {
+        outputs[i] = states[i][0];
+    }
+    return outputs;
+}
+
 /**
  * @brief Hashes vector of bytes by chunking it into 31 byte field elements and calling hash()
  * @details Slice function cuts out the required number of bytes from the byte vector
@@ -10,6 +10,8 @@
 #include "poseidon2_permutation.hpp"
 #include "sponge/sponge.hpp"
 
+#include <span>
+
 namespace bb::crypto {
 
 template <typename Params> class Poseidon2 {
@@ -17,12 +19,23 @@ template <typename Params> class Poseidon2 {
     using FF = typename Params::FF;
 
     // We choose our rate to be t-1 and capacity to be 1.
-    using Sponge = FieldSponge<FF, Params::t - 1, 1, Params::t, Poseidon2Permutation<Params>>;
+    using Permutation = Poseidon2Permutation<Params>;
+    using Sponge = FieldSponge<FF, Params::t - 1, 1, Params::t, Permutation>;
 
     /**
      * @brief Hashes a vector of field elements
      */
     static FF hash(const std::vector<FF>& input);
+    /**
+     * @brief Hashes each vector of field elements in `inputs`, equivalent to calling hash() on each of them
+     * @details The sponges of all inputs are permuted together with Permutation::permutation_many.
+     */
+    static std::vector<FF> hash_many(const std::vector<std::vector<FF>>& inputs);
+    /**
+     * @brief Hashes the pairs (inputs[0], inputs[1]), (inputs[2], inputs[3]), ..., equivalent to calling hash() on each
+     * @details Same as hash_many, without a vector per pair. `inputs` must have an even size.
+     */
+    static std::vector<FF> hash_pairs(std::span<const FF> inputs);
     /**
      * @brief Hashes vector of bytes by chunking it into 31 byte field elements and calling hash()
      * @details Slice function cuts out the required number of bytes from the byte vector
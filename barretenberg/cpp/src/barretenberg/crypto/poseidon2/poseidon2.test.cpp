@@ -64,3 +64,44 @@ TEST(Poseidon2, HashBufferConsistencyCheck)
     EXPECT_NE(result1, expected);
     EXPECT_EQ(result2, expected);
 }
+
+TEST(Poseidon2, HashManyMatchesHash)
+{
+    using Poseidon2 = crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>;
+
+    // Lengths on both sides of the sponge rate, including an empty input
+    std::vector<std::vector<fr>> inputs;
+    for (size_t length : std::vector<size_t>{ 2, 0, 1, 3, 4, 7, 2, 2, 9, 2 }) {
+        std::vector<fr> input(length);
+        for (auto& element : input) {
+            element = fr::random_element(&engine);
+        }
+        inputs.push_back(input);
+    }
+
+    auto results = Poseidon2::hash_many(inputs);
+
+    ASSERT_EQ(results.size(), inputs.size());
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        EXPECT_EQ(results[i], Poseidon2::hash(inputs[i]));
+    }
+}
+
+TEST(Poseidon2, HashPairsMatchesHash)
+{
+    using Poseidon2 = crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>;
+
+    // Enough pairs for a partial block of interleaved states
+    std::vector<fr> inputs(2 * 7);
+    for (auto& element : inputs) {
+        element = fr::random_element(&engine);
+    }
+
+    auto results = Poseidon2::hash_pairs(inputs);
+
+    ASSERT_EQ(results.size(), inputs.size() / 2);
+    for (size_t i = 0; i < results.size(); ++i) {
+        EXPECT_EQ(results[i], Poseidon2::hash({ inputs[2 * i], inputs[2 * i + 1] }));
+    }
+    EXPECT_TRUE(Poseidon2::hash_pairs({}).empty());
+}
@@ -10,9 +10,12 @@
 
 #include "barretenberg/common/throw_or_abort.hpp"
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <span>
+#include <utility>
 
 namespace bb::crypto {
 
@@ -166,5 +169,75 @@ template <typename Params> class Poseidon2Permutation {
         }
         return current_state;
     }
+
+    // Number of states advanced side by side by permutation_many
+    static constexpr size_t NUM_INTERLEAVED_STATES = 4;
+
+    /**
+     * @brief Applies the permutation to N independent states in lock-step.
+     * @details Every step of a round is applied to all N states before moving on. In the partial rounds a single state
+     * is one long chain of dependent multiplications; interleaving N of them keeps the multiplier busy with independent
+     * work. `on_round(r, states)` is called after the initial linear layer (r = 0) and after every round
+     * (r = 1, ..., NUM_ROUNDS), which lets witness generation record the intermediate states.
+     */
+    template <size_t N, typename OnRound>
+    static constexpr void permutation_interleaved(std::array<State, N>& states, OnRound&& on_round)
+    {
+        for (auto& state : states) {
+            matrix_multiplication_external(state);
+        }
+        on_round(size_t(0), std::as_const(states));
+
+        constexpr size_t rounds_f_beginning = rounds_f / 2;
+        constexpr size_t p_end = rounds_f_beginning + rounds_p;
+        for (size_t i = 0; i < NUM_ROUNDS; ++i) {
+            if (i >= rounds_f_beginning && i < p_end) {
+                for (auto& state : states) {
+                    state[0] += round_constants[i][0];
+                }
+                for (auto& state : states) {
+                    apply_single_sbox(state[0]);
+                }
+                for (auto& state : states) {
+                    matrix_multiplication_internal(state);
+                }
+            } else {
+                for (auto& state : states) {
+                    add_round_constants(state, round_constants[i]);
+                }
+                for (auto& state : states) {
+                    apply_sbox(state);
+                }
+                for (auto& state : states) {
+                    matrix_multiplication_external(state);
+                }
+            }
+            on_round(i + 1, std::as_const(states));
+        }
+    }
+
+    template <size_t N> static constexpr void permutation_interleaved(std::array<State, N>& states)
+    {
+        permutation_interleaved(states, [](size_t, const std::array<State, N>&) {});
+    }
+
+    /**
+     * @brief Applies the permutation in place to every state in `states`, NUM_INTERLEAVED_STATES at a time.
+     */
+    static void permutation_many(std::span<State> states)
+    {
+        std::array<State, NUM_INTERLEAVED_STATES> block;
+        for (size_t start = 0; start < states.size(); start += NUM_INTERLEAVED_STATES) {
+            const size_t block_size = std::min(NUM_INTERLEAVED_STATES, states.size() - start);
+            // The tail of the last block is padded with zero states whose output is discarded
+            for (size_t j = 0; j < NUM_INTERLEAVED_STATES; ++j) {
+                block[j] = j < block_size ? states[start + j] : State{};
+            }
+            permutation_interleaved(block);
+            for (size_t j = 0; j < block_size; ++j) {
+                states[start + j] = block[j];
+            }
+        }
+    }
 };
 } // namespace bb::crypto
@@ -59,3 +59,24 @@ TEST(Poseidon2Permutation, ConsistencyCheck)
     };
     EXPECT_EQ(result, expected);
 }
+
+TEST(Poseidon2Permutation, PermutationManyMatchesPermutation)
+{
+    using Permutation = crypto::Poseidon2Permutation<crypto::Poseidon2Bn254ScalarFieldParams>;
+
+    // Not a multiple of the number of interleaved states, so the padded tail is exercised
+    std::vector<Permutation::State> states(2 * Permutation::NUM_INTERLEAVED_STATES + 1);
+    for (auto& state : states) {
+        for (auto& element : state) {
+            element = fr::random_element(&engine);
+        }
+    }
+    std::vector<Permutation::State> expected;
+    for (const auto& state : states) {
+        expected.push_back(Permutation::permutation(state));
+    }
+
+    Permutation::permutation_many(states);
+
+    EXPECT_EQ(states, expected);
+}
@@ -6,6 +6,7 @@
 
 #include "./sha256.hpp"
 #include "barretenberg/common/net.hpp"
+#include <algorithm>
 #include <array>
 #include <memory.h>
 
@@ -29,6 +30,101 @@ constexpr uint32_t ror(uint32_t val, uint32_t shift)
     return (val >> (shift & 31U)) | (val << (32U - (shift & 31U)));
 }
 
+/**
+ * @brief Number of independent messages compressed side by side by the batch functions.
+ * @details Eight 32-bit lanes fill an AVX2 register. The vector type is split or widened to whatever the target
+ * architecture supports, down to scalar code where there is no SIMD at all.
+ */
+constexpr size_t NUM_LANES = 8;
+using Lanes = uint32_t __attribute__((vector_size(NUM_LANES * sizeof(uint32_t))));
+
+inline Lanes broadcast(uint32_t val)
+{
+    return Lanes{} + val;
+}
+
+inline Lanes ror(const Lanes& val, uint32_t shift)
+{
+    return (val >> shift) | (val << (32U - shift));
+}
+
+/**
+ * @brief The SHA-256 compression function on NUM_LANES independent states at once, the lane-wise version of
+ * bb::crypto::sha256_block
+ */
+void sha256_block_lanes(std::array<Lanes, 8>& state, const std::array<Lanes, 16>& input)
+{
+    std::array<Lanes, 64> w;
+    for (size_t i = 0; i < 16; ++i) {
+        w[i] = input[i];
+    }
+    for (size_t i = 16; i < 64; ++i) {
+        Lanes s0 = ror(w[i - 15], 7) ^ ror(w[i - 15], 18) ^ (w[i - 15] >> 3);
+        Lanes s1 = ror(w[i - 2], 17) ^ ror(w[i - 2], 19) ^ (w[i - 2] >> 10);
+        w[i] = w[i - 16] + w[i - 7] + s0 + s1;
+    }
+
+    Lanes a = state[0];
+    Lanes b = state[1];
+    Lanes c = state[2];
+    Lanes d = state[3];
+    Lanes e = state[4];
+    Lanes f = state[5];
+    Lanes g = state[6];
+    Lanes h = state[7];
+
+    for (size_t i = 0; i < 64; ++i) {
+        Lanes S1 = ror(e, 6U) ^ ror(e, 11U) ^ ror(e, 25U);
+        Lanes ch = (e & f) ^ (~e & g);
+        Lanes temp1 = h + S1 + ch + round_constants[i] + w[i];
+        Lanes S0 = ror(a, 2U) ^ ror(a, 13U) ^ ror(a, 22U);
+        Lanes maj = (a & b) ^ (a & c) ^ (b & c);
+        Lanes temp2 = S0 + maj;
+
+        h = g;
+        g = f;
+        f = e;
+        e = d + temp1;
+        d = c;
+        c = b;
+        b = a;
+        a = temp1 + temp2;
+    }
+
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
+    state[5] += f;
+    state[6] += g;
+    state[7] += h;
+}
+
+// Append the 0x80 byte, the zero padding and the 64-bit message length, so that the result is a whole number of blocks
+std::vector<uint8_t> pad_message(std::vector<uint8_t> message_schedule)
+{
+    uint64_t l = message_schedule.size() * 8;
+    message_schedule.push_back(0x80);
+
+    uint32_t num_zero_bytes = ((448U - (message_schedule.size() << 3U)) & 511U) >> 3U;
+
+    for (size_t i = 0; i < num_zero_bytes; ++i) {
+        message_schedule.push_back(0x00);
+    }
+    for (size_t i = 0; i < 8; ++i) {
+        uint8_t byte = static_cast<uint8_t>(l >> (uint64_t)(56 - (i * 8)));
+        message_schedule.push_back(byte);
+    }
+    return message_schedule;
+}
+
+uint32_t read_be32(const uint8_t* data)
+{
+    return (static_cast<uint32_t>(data[0]) << 24) | (static_cast<uint32_t>(data[1]) << 16) |
+           (static_cast<uint32_t>(data[2]) << 8) | static_cast<uint32_t>(data[3]);
+}
+
 } // namespace
 
 namespace bb::crypto {
@@ -140,21 +236,7 @@ Sha256Hash sha256_block(const std::vector<uint8_t>& input)
 
 template <typename ByteContainer> Sha256Hash sha256(const ByteContainer& input)
 {
-    std::vector<uint8_t> message_schedule;
-
-    std::copy(input.begin(), input.end(), std::back_inserter(message_schedule));
-    uint64_t l = message_schedule.size() * 8;
-    message_schedule.push_back(0x80);
-
-    uint32_t num_zero_bytes = ((448U - (message_schedule.size() << 3U)) & 511U) >> 3U;
-
-    for (size_t i = 0; i < num_zero_bytes; ++i) {
-        message_schedule.push_back(0x00);
-    }
-    for (size_t i = 0; i < 8; ++i) {
-        uint8_t byte = static_cast<uint8_t>(l >> (uint64_t)(56 - (i * 8)));
-        message_schedule.push_back(byte);
-    }
+    const std::vector<uint8_t> message_schedule = pad_message(std::vector<uint8_t>(input.begin(), input.end()));
     std::array<uint32_t, 8> rolling_hash;
     prepare_constants(rolling_hash);
     const size_t num_blocks = message_schedule.size() / 64;
@@ -181,6 +263,91 @@ template <typename ByteContainer> Sha256Hash sha256(const ByteContainer& input)
     return output;
 }
 
+/**
+ * @brief Apply the compression function to many independent (state, block) pairs, NUM_LANES of them at a time
+ *
+ * @details outputs[i] = sha256_block(h_init[i], inputs[i]). The output may alias h_init.
+ */
+void sha256_block_many(std::span<const std::array<uint32_t, 8>> h_init,
+                       std::span<const std::array<uint32_t, 16>> inputs,
+                       std::span<std::array<uint32_t, 8>> outputs)
+{
+    ASSERT(h_init.size() == inputs.size() && outputs.size() == inputs.size());
+    for (size_t start = 0; start < inputs.size(); start += NUM_LANES) {
+        const size_t num_lanes = std::min(NUM_LANES, inputs.size() - start);
+        std::array<Lanes, 8> state{};
+        std::array<Lanes, 16> block{};
+        for (size_t lane = 0; lane < num_lanes; ++lane) {
+            for (size_t i = 0; i < 8; ++i) {
+                state[i][lane] = h_init[start + lane][i];
+            }
+            for (size_t i = 0; i < 16; ++i) {
+                block[i][lane] = inputs[start + lane][i];
+            }
+        }
+        sha256_block_lanes(state, block);
+        for (size_t lane = 0; lane < num_lanes; ++lane) {
+            for (size_t i = 0; i < 8; ++i) {
+                outputs[start + lane][i] = state[i][lane];
+            }
+        }
+    }
+}
+
+/**
+ * @brief Hash many independent messages, NUM_LANES of them at a time
+ *
+ * @details Messages of different lengths share a batch: a lane whose message has run out of blocks keeps its state
+ * while the others are compressed.
+ */
+std::vector<Sha256Hash> sha256_many(const std::vector<std::vector<uint8_t>>& inputs)
+{
+    std::vector<Sha256Hash> outputs(inputs.size());
+    for (size_t start = 0; start < inputs.size(); start += NUM_LANES) {
+        const size_t num_lanes = std::min(NUM_LANES, inputs.size() - start);
+        std::array<std::vector<uint8_t>, NUM_LANES> messages;
+        size_t max_num_blocks = 0;
+        for (size_t lane = 0; lane < num_lanes; ++lane) {
+            messages[lane] = pad_message(inputs[start + lane]);
+            max_num_blocks = std::max(max_num_blocks, messages[lane].size() / 64);
+        }
+
+        std::array<Lanes, 8> state;
+        for (size_t i = 0; i < 8; ++i) {
+            state[i] = broadcast(init_constants[i]);
+        }
+        for (size_t block_index = 0; block_index < max_num_blocks; ++block_index) {
+            std::array<Lanes, 16> block{};
+            Lanes active{};
+            for (size_t lane = 0; lane < num_lanes; ++lane) {
+                if (block_index * 64 >= messages[lane].size()) {
+                    continue;
+                }
+                active[lane] = ~0U;
+                for (size_t i = 0; i < 16; ++i) {
+                    block[i][lane] = read_be32(&messages[lane][block_index * 64 + i * 4]);
+                }
+            }
+            std::array<Lanes, 8> next_state = state;
+            sha256_block_lanes(next_state, block);
+            for (size_t i = 0; i < 8; ++i) {
+                state[i] = (next_state[i] & active) | (state[i] & ~active);
+            }
+        }
+
+        for (size_t lane = 0; lane < num_lanes; ++lane) {
+            for (size_t i = 0; i < 8; ++i) {
+                const uint32_t word = state[i][lane];
+                outputs[start + lane][i * 4] = static_cast<uint8_t>(word >> 24);
+                outputs[start + lane][i * 4 + 1] = static_cast<uint8_t>(word >> 16);
+                outputs[start + lane][i * 4 + 2] = static_cast<uint8_t>(word >> 8);
+                outputs[start + lane][i * 4 + 3] = static_cast<uint8_t>(word);
+            }
+        }
+    }
+    return outputs;
+}
+
 template Sha256Hash sha256<std::vector<uint8_t>>(const std::vector<uint8_t>& input);
 template Sha256Hash sha256<std::array<uint8_t, 32>>(const std::array<uint8_t, 32>& input);
 template Sha256Hash sha256<std::string>(const std::string& input);
@@ -11,6 +11,7 @@
 #include <array>
 #include <iomanip>
 #include <ostream>
+#include <span>
 #include <vector>
 
 namespace bb::crypto {
@@ -19,8 +20,17 @@ using Sha256Hash = std::array<uint8_t, 32>;
 
 Sha256Hash sha256_block(const std::vector<uint8_t>& input);
 
+// The SHA-256 compression function
+std::array<uint32_t, 8> sha256_block(const std::array<uint32_t, 8>& h_init, const std::array<uint32_t, 16>& input);
+
 template <typename T> Sha256Hash sha256(const T& input);
 
+// Batch versions of the above, which process several independent inputs side by side in SIMD lanes
+void sha256_block_many(std::span<const std::array<uint32_t, 8>> h_init,
+                       std::span<const std::array<uint32_t, 16>> inputs,
+                       std::span<std::array<uint32_t, 8>> outputs);
+std::vector<Sha256Hash> sha256_many(const std::vector<std::vector<uint8_t>>& inputs);
+
 inline bb::fr sha256_to_field(std::vector<uint8_t> const& input)
 {
     auto result = sha256(input);
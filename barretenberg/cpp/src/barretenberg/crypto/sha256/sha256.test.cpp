@@ -101,3 +101,40 @@ TEST(misc_sha256, test_NIST_vector_five)
         EXPECT_EQ(result[i], expected[i]);
     }
 }
+
+TEST(misc_sha256, sha256_many_matches_sha256)
+{
+    // Lengths on both sides of the one and two block boundaries, in batches that do not fill the last group of lanes
+    std::vector<std::vector<uint8_t>> inputs;
+    for (size_t length = 0; length < 140; length += 3) {
+        std::vector<uint8_t> input(length);
+        for (size_t i = 0; i < length; ++i) {
+            input[i] = static_cast<uint8_t>(length * 31 + i);
+        }
+        inputs.push_back(input);
+    }
+    auto results = sha256_many(inputs);
+    ASSERT_EQ(results.size(), inputs.size());
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        EXPECT_EQ(results[i], sha256(inputs[i]));
+    }
+}
+
+TEST(misc_sha256, sha256_block_many_matches_sha256_block)
+{
+    std::vector<std::array<uint32_t, 8>> states(13);
+    std::vector<std::array<uint32_t, 16>> blocks(13);
+    for (size_t i = 0; i < states.size(); ++i) {
+        for (size_t j = 0; j < 8; ++j) {
+            states[i][j] = static_cast<uint32_t>(i * 0x9e3779b9 + j * 0x85ebca6b);
+        }
+        for (size_t j = 0; j < 16; ++j) {
+            blocks[i][j] = static_cast<uint32_t>(i * 0xc2b2ae35 + j * 0x27d4eb2f);
+        }
+    }
+    std::vector<std::array<uint32_t, 8>> outputs(states.size());
+    sha256_block_many(states, blocks, outputs);
+    for (size_t i = 0; i < states.size(); ++i) {
+        EXPECT_EQ(outputs[i], sha256_block(states[i], blocks[i]));
+    }
+}
@@ -8,6 +8,7 @@
 
 #include "barretenberg/common/log.hpp"
 #include "barretenberg/common/op_count.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/dsl/acir_format/honk_recursion_constraint.hpp"
 #include "barretenberg/dsl/acir_format/ivc_recursion_constraint.hpp"
@@ -25,6 +26,8 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <optional>
+#include <unordered_map>
 
 namespace acir_format {
 
@@ -47,6 +50,187 @@ template <typename Builder> struct HonkRecursionConstraintsOutput {
     bool is_root_rollup = false;
 };
 
+namespace {
+
+// Number of opcodes of each hash type constructed together in one fragment when hash opcodes are constructed in
+// parallel. These are fixed so that the circuit does not depend on the number of threads.
+constexpr size_t SHA256_COMPRESSION_CHUNK_SIZE = 4;
+constexpr size_t BLAKE2S_CHUNK_SIZE = 2;
+constexpr size_t BLAKE3_CHUNK_SIZE = 2;
+constexpr size_t KECCAK_CHUNK_SIZE = 1;
+constexpr size_t POSEIDON2_CHUNK_SIZE = 64;
+
+// Apply fn to each witness index referenced by an opcode
+template <typename Fn> void for_each_witness(WitnessOrConstant<fr>& input, const Fn& fn)
+{
+    if (!input.is_constant) {
+        fn(input.index);
+    }
+}
+
+template <typename Fn> void for_each_witness(Sha256Compression& constraint, const Fn& fn)
+{
+    for (auto& input : constraint.inputs) {
+        for_each_witness(input, fn);
+    }
+    for (auto& hash_value : constraint.hash_values) {
+        for_each_witness(hash_value, fn);
+    }
+    for (auto& result : constraint.result) {
+        fn(result);
+    }
+}
+
+template <typename Fn> void for_each_witness(Blake2sConstraint& constraint, const Fn& fn)
+{
+    for (auto& input : constraint.inputs) {
+        for_each_witness(input.blackbox_input, fn);
+    }
+    for (auto& result : constraint.result) {
+        fn(result);
+    }
+}
+
+template <typename Fn> void for_each_witness(Blake3Constraint& constraint, const Fn& fn)
+{
+    for (auto& input : constraint.inputs) {
+        for_each_witness(input.blackbox_input, fn);
+    }
+    for (auto& result : constraint.result) {
+        fn(result);
+    }
+}
+
+template <typename Fn> void for_each_witness(Keccakf1600& constraint, const Fn& fn)
+{
+    for (auto& input : constraint.state) {
+        for_each_witness(input, fn);
+    }
+    for (auto& result : constraint.result) {
+        fn(result);
+    }
+}
+
+template <typename Fn> void for_each_witness(Poseidon2Constraint& constraint, const Fn& fn)
+{
+    for (auto& input : constraint.state) {
+        for_each_witness(input, fn);
+    }
+    for (auto& result : constraint.result) {
+        fn(result);
+    }
+}
+
+/**
+ * @brief Construct a list of independent opcodes in parallel, in fixed-size chunks
+ * @details Each chunk is constructed in a builder of its own in which the witnesses referenced by the chunk are
+ * relabeled 0, 1, ... in order of first use. The chunk builders are then appended to the main builder in chunk order,
+ * so the resulting circuit depends only on the program (and not on the witness, the number of threads or whether gates
+ * per opcode are collected). A chunk whose builder cannot be appended (see UltraCircuitBuilder::is_appendable_fragment)
+ * is constructed again directly in the main builder.
+ *
+ * When collecting gates per opcode, each opcode of an appended chunk is assigned the gates it added to the chunk
+ * builder. The gates the chunk adds to the main builder differ from their sum by the gates shared with the main
+ * circuit (lookup tables, range lists); as in the serial construction, where such gates count towards the first opcode
+ * that needs them, the difference goes to the first opcode of the chunk (which is not assigned less than zero gates).
+ *
+ * @note A program with at least two chunks of an opcode type yields a different (equally valid) circuit, and hence a
+ * different verification key, than constructing its opcodes one by one in the main builder. This is therefore only used
+ * when ProgramMetadata::parallel_hash_constraints is set.
+ *
+ * @return true if the opcodes have been constructed, false if the caller has to construct them (the case for Mega
+ * circuits and for fewer than two chunks)
+ */
+template <typename Builder, typename Constraint, typename CreateConstraint>
+bool create_constraints_in_parallel(Builder& builder,
+                                    const std::vector<Constraint>& constraints,
+                                    const std::vector<size_t>& opcode_indices,
+                                    const size_t chunk_size,
+                                    const bool collect_gates_per_opcode,
+                                    GateCounter<Builder>& gate_counter,
+                                    std::vector<size_t>& gates_per_opcode,
+                                    const CreateConstraint& create_constraint)
+{
+    if constexpr (!std::same_as<Builder, UltraCircuitBuilder>) {
+        return false;
+    } else {
+        const size_t num_chunks = (constraints.size() + chunk_size - 1) / chunk_size;
+        if (num_chunks < 2) {
+            return false;
+        }
+        const auto chunk_begin = [&](size_t chunk_idx) { return chunk_idx * chunk_size; };
+        const auto chunk_end = [&](size_t chunk_idx) {
+            return std::min((chunk_idx + 1) * chunk_size, constraints.size());
+        };
+
+        // Chunks are constructed in rounds to bound the number of builders waiting to be appended
+        const size_t round_size = get_num_cpus();
+        for (size_t round_start = 0; round_start < num_chunks; round_start += round_size) {
+            const size_t num_round_chunks = std::min(round_size, num_chunks - round_start);
+            std::vector<std::optional<UltraCircuitBuilder>> fragments(num_round_chunks);
+            std::vector<std::vector<uint32_t>> shared_witnesses(num_round_chunks);
+            std::vector<std::vector<size_t>> fragment_gates_per_opcode(num_round_chunks);
+            parallel_for(num_round_chunks, [&](size_t i) {
+                const auto first = constraints.begin() + static_cast<std::ptrdiff_t>(chunk_begin(round_start + i));
+                const auto last = constraints.begin() + static_cast<std::ptrdiff_t>(chunk_end(round_start + i));
+                std::vector<Constraint> chunk(first, last);
+                auto& shared = shared_witnesses[i];
+                std::unordered_map<uint32_t, uint32_t> local_indices;
+                for (auto& constraint : chunk) {
+                    for_each_witness(constraint, [&](uint32_t& index) {
+                        auto [it, inserted] = local_indices.try_emplace(index, static_cast<uint32_t>(shared.size()));
+                        if (inserted) {
+                            shared.emplace_back(index);
+                        }
+                        index = it->second;
+                    });
+                }
+                std::vector<fr> local_witness;
+                local_witness.reserve(shared.size());
+                for (const uint32_t index : shared) {
+                    local_witness.emplace_back(builder.get_variable(index));
+                }
+                auto& fragment = fragments[i].emplace(
+                    0, local_witness, std::vector<uint32_t>{}, shared.size(), builder.is_recursive_circuit);
+                fragment.has_dummy_witnesses = builder.has_dummy_witnesses;
+                GateCounter<UltraCircuitBuilder> fragment_gate_counter{ &fragment, collect_gates_per_opcode };
+                fragment_gate_counter.compute_diff();
+                for (const auto& constraint : chunk) {
+                    create_constraint(fragment, constraint);
+                    fragment_gates_per_opcode[i].emplace_back(fragment_gate_counter.compute_diff());
+                }
+            });
+            for (size_t i = 0; i < num_round_chunks; ++i) {
+                const size_t begin = chunk_begin(round_start + i);
+                const size_t end = chunk_end(round_start + i);
+                if (fragments[i]->is_appendable_fragment()) {
+                    builder.append_fragment(*fragments[i], shared_witnesses[i]);
+                    if (collect_gates_per_opcode) {
+                        const auto chunk_gates = static_cast<int64_t>(gate_counter.compute_diff());
+                        int64_t fragment_gates = 0;
+                        for (size_t j = begin; j < end; ++j) {
+                            gates_per_opcode[opcode_indices[j]] = fragment_gates_per_opcode[i][j - begin];
+                            fragment_gates += static_cast<int64_t>(gates_per_opcode[opcode_indices[j]]);
+                        }
+                        auto& first_opcode_gates = gates_per_opcode[opcode_indices[begin]];
+                        first_opcode_gates = static_cast<size_t>(std::max<int64_t>(
+                            static_cast<int64_t>(first_opcode_gates) + chunk_gates - fragment_gates, 0));
+                    }
+                } else {
+                    for (size_t j = begin; j < end; ++j) {
+                        create_constraint(builder, constraints[j]);
+                        gate_counter.track_diff(gates_per_opcode, opcode_indices[j]);
+                    }
+                }
+                fragments[i].reset();
+            }
+        }
+        return true;
+    }
+}
+
+} // namespace
+
 template <typename Builder>
 void build_constraints(Builder& builder, AcirProgram& program, const ProgramMetadata& metadata)
 {
@@ -61,6 +245,15 @@ void build_constraints(Builder& builder, AcirProgram& program, const ProgramMeta
 
     GateCounter gate_counter{ &builder, collect_gates_per_opcode };
 
+    // Each arithmetic opcode becomes one arithmetic gate (one per mul_quad for big quads), so the arithmetic block can
+    // be sized up front rather than grown gate by gate
+    size_t num_arithmetic_gates =
+        constraint_system.poly_triple_constraints.size() + constraint_system.quad_constraints.size();
+    for (const auto& big_constraint : constraint_system.big_quad_constraints) {
+        num_arithmetic_gates += big_constraint.size();
+    }
+    builder.blocks.arithmetic.reserve(builder.blocks.arithmetic.size() + num_arithmetic_gates);
+
     // Add arithmetic gates
     for (size_t i = 0; i < constraint_system.poly_triple_constraints.size(); ++i) {
         const auto& constraint = constraint_system.poly_triple_constraints.at(i);
@@ -133,11 +326,23 @@ void build_constraints(Builder& builder, AcirProgram& program, const ProgramMeta
     }
 
     // Add sha256 constraints
-    for (size_t i = 0; i < constraint_system.sha256_compression.size(); ++i) {
-        const auto& constraint = constraint_system.sha256_compression[i];
-        create_sha256_compression_constraints(builder, constraint);
-        gate_counter.track_diff(constraint_system.gates_per_opcode,
-                                constraint_system.original_opcode_indices.sha256_compression[i]);
+    if (!metadata.parallel_hash_constraints ||
+        !create_constraints_in_parallel(builder,
+                                        constraint_system.sha256_compression,
+                                        constraint_system.original_opcode_indices.sha256_compression,
+                                        SHA256_COMPRESSION_CHUNK_SIZE,
+                                        collect_gates_per_opcode,
+                                        gate_counter,
+                                        constraint_system.gates_per_opcode,
+                                        [](auto& circuit, const auto& constraint) {
+                                            create_sha256_compression_constraints(circuit, constraint);
+                                        })) {
+        for (size_t i = 0; i < constraint_system.sha256_compression.size(); ++i) {
+            const auto& constraint = constraint_system.sha256_compression[i];
+            create_sha256_compression_constraints(builder, constraint);
+            gate_counter.track_diff(constraint_system.gates_per_opcode,
+                                    constraint_system.original_opcode_indices.sha256_compression[i]);
+        }
     }
 
     // Add ECDSA k1 constraints
@@ -157,34 +362,82 @@ void build_constraints(Builder& builder, AcirProgram& program, const ProgramMeta
     }
 
     // Add blake2s constraints
-    for (size_t i = 0; i < constraint_system.blake2s_constraints.size(); ++i) {
-        const auto& constraint = constraint_system.blake2s_constraints.at(i);
-        create_blake2s_constraints(builder, constraint);
-        gate_counter.track_diff(constraint_system.gates_per_opcode,
-                                constraint_system.original_opcode_indices.blake2s_constraints.at(i));
+    if (!metadata.parallel_hash_constraints ||
+        !create_constraints_in_parallel(builder,
+                                        constraint_system.blake2s_constraints,
+                                        constraint_system.original_opcode_indices.blake2s_constraints,
+                                        BLAKE2S_CHUNK_SIZE,
+                                        collect_gates_per_opcode,
+                                        gate_counter,
+                                        constraint_system.gates_per_opcode,
+                                        [](auto& circuit, const auto& constraint) {
+                                            create_blake2s_constraints(circuit, constraint);
+                                        })) {
+        for (size_t i = 0; i < constraint_system.blake2s_constraints.size(); ++i) {
+            const auto& constraint = constraint_system.blake2s_constraints.at(i);
+            create_blake2s_constraints(builder, constraint);
+            gate_counter.track_diff(constraint_system.gates_per_opcode,
+                                    constraint_system.original_opcode_indices.blake2s_constraints.at(i));
+        }
     }
 
     // Add blake3 constraints
-    for (size_t i = 0; i < constraint_system.blake3_constraints.size(); ++i) {
-        const auto& constraint = constraint_system.blake3_constraints.at(i);
-        create_blake3_constraints(builder, constraint);
-        gate_counter.track_diff(constraint_system.gates_per_opcode,
-                                constraint_system.original_opcode_indices.blake3_constraints.at(i));
+    if (!metadata.parallel_hash_constraints ||
+        !create_constraints_in_parallel(builder,
+                                        constraint_system.blake3_constraints,
+                                        constraint_system.original_opcode_indices.blake3_constraints,
+                                        BLAKE3_CHUNK_SIZE,
+                                        collect_gates_per_opcode,
+                                        gate_counter,
+                                        constraint_system.gates_per_opcode,
+                                        [](auto& circuit, const auto& constraint) {
+                                            create_blake3_constraints(circuit, constraint);
+                                        })) {
+        for (size_t i = 0; i < constraint_system.blake3_constraints.size(); ++i) {
+            const auto& constraint = constraint_system.blake3_constraints.at(i);
+            create_blake3_constraints(builder, constraint);
+            gate_counter.track_diff(constraint_system.gates_per_opcode,
+                                    constraint_system.original_opcode_indices.blake3_constraints.at(i));
+        }
     }
 
     // Add keccak permutations
-    for (size_t i = 0; i < constraint_system.keccak_permutations.size(); ++i) {
-        const auto& constraint = constraint_system.keccak_permutations[i];
-        create_keccak_permutations(builder, constraint);
-        gate_counter.track_diff(constraint_system.gates_per_opcode,
-                                constraint_system.original_opcode_indices.keccak_permutations[i]);
+    if (!metadata.parallel_hash_constraints ||
+        !create_constraints_in_parallel(builder,
+                                        constraint_system.keccak_permutations,
+                                        constraint_system.original_opcode_indices.keccak_permutations,
+                                        KECCAK_CHUNK_SIZE,
+                                        collect_gates_per_opcode,
+                                        gate_counter,
+                                        constraint_system.gates_per_opcode,
+                                        [](auto& circuit, const auto& constraint) {
+                                            create_keccak_permutations(circuit, constraint);
+                                        })) {
+        for (size_t i = 0; i < constraint_system.keccak_permutations.size(); ++i) {
+            const auto& constraint = constraint_system.keccak_permutations[i];
+            create_keccak_permutations(builder, constraint);
+            gate_counter.track_diff(constraint_system.gates_per_opcode,
+                                    constraint_system.original_opcode_indices.keccak_permutations[i]);
+        }
     }
 
-    for (size_t i = 0; i < constraint_system.poseidon2_constraints.size(); ++i) {
-        const auto& constraint = constraint_system.poseidon2_constraints.at(i);
-        create_poseidon2_permutations(builder, constraint);
-        gate_counter.track_diff(constraint_system.gates_per_opcode,
-                                constraint_system.original_opcode_indices.poseidon2_constraints.at(i));
+    if (!metadata.parallel_hash_constraints ||
+        !create_constraints_in_parallel(builder,
+                                        constraint_system.poseidon2_constraints,
+                                        constraint_system.original_opcode_indices.poseidon2_constraints,
+                                        POSEIDON2_CHUNK_SIZE,
+                                        collect_gates_per_opcode,
+                                        gate_counter,
+                                        constraint_system.gates_per_opcode,
+                                        [](auto& circuit, const auto& constraint) {
+                                            create_poseidon2_permutations(circuit, constraint);
+                                        })) {
+        for (size_t i = 0; i < constraint_system.poseidon2_constraints.size(); ++i) {
+            const auto& constraint = constraint_system.poseidon2_constraints.at(i);
+            create_poseidon2_permutations(builder, constraint);
+            gate_counter.track_diff(constraint_system.gates_per_opcode,
+                                    constraint_system.original_opcode_indices.poseidon2_constraints.at(i));
+        }
     }
 
     // Add multi scalar mul constraints
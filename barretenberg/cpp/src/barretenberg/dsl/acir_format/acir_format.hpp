@@ -217,6 +217,11 @@ struct ProgramMetadata {
                                  // 2 means we are using the UltraRollupHonk flavor
     bool collect_gates_per_opcode = false;
     size_t size_hint = 0;
+    // Construct the sha256 compression, blake2s, blake3, keccakf1600 and poseidon2 opcodes of an Ultra circuit in
+    // parallel chunks which are then appended to the builder. The circuit is equally valid but laid out differently
+    // than when the opcodes are constructed one by one, so its verification key differs; opt in only if the
+    // verification key is generated with the same setting.
+    bool parallel_hash_constraints = false;
 };
 
 // TODO(https://github.com/AztecProtocol/barretenberg/issues/1161) Refactor this function
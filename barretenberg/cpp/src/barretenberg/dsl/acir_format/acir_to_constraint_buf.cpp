@@ -60,7 +60,10 @@ T deserialize_any_format(std::vector<uint8_t>&& buf,
             size_t size = buf.size() - 1;
             msgpack::null_visitor probe;
             if (msgpack::parse(buffer, size, probe)) {
-                auto oh = msgpack::unpack(buffer, size);
+                // Strings and binary fields reference `buf`, which outlives the decoding, rather than being
+                // copied into the msgpack zone.
+                auto oh =
+                    msgpack::unpack(buffer, size, [](msgpack::type::object_type, size_t, void*) { return true; });
                 // This has to be on a separate line, see
                 // https://github.com/msgpack/msgpack-c/issues/695#issuecomment-393035172
                 auto o = oh.get();
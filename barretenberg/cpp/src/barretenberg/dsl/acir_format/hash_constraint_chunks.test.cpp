@@ -0,0 +1,314 @@
+#include "acir_format.hpp"
+#include "acir_format_mocks.hpp"
+#include "barretenberg/crypto/blake2s/blake2s.hpp"
+#include "barretenberg/crypto/blake3s/blake3s.hpp"
+#include "barretenberg/crypto/keccak/keccak.hpp"
+#include "barretenberg/crypto/sha256/sha256.hpp"
+#include "barretenberg/ultra_honk/decider_proving_key.hpp"
+
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace acir_format::tests {
+
+using namespace bb;
+
+/**
+ * @brief Tests of programs with enough hash opcodes of one type to be constructed in several chunks in parallel and
+ * appended to the main builder when ProgramMetadata::parallel_hash_constraints is set (see
+ * create_constraints_in_parallel in acir_format.cpp)
+ * @details The opcodes share witnesses with each other (across chunks) and use constant inputs, so that the appended
+ * chunks exercise shared variables, constants, lookup tables and range lists.
+ */
+class HashConstraintChunksTests : public ::testing::Test {
+  protected:
+    static void SetUpTestSuite() { bb::srs::init_file_crs_factory(bb::srs::bb_crs_path()); }
+
+    static uint32_t add_witness(WitnessVector& witness, const fr& value)
+    {
+        witness.emplace_back(value);
+        return static_cast<uint32_t>(witness.size() - 1);
+    }
+
+    static WitnessOrConstant<fr> constant(const fr& value)
+    {
+        return WitnessOrConstant<fr>{ .index = 0, .value = value, .is_constant = true };
+    }
+
+    static AcirFormat create_constraint_system(const WitnessVector& witness,
+                                               const std::vector<Sha256Compression>& sha256_compression,
+                                               const std::vector<Blake2sConstraint>& blake2s_constraints,
+                                               const std::vector<Blake3Constraint>& blake3_constraints,
+                                               const std::vector<Keccakf1600>& keccak_permutations)
+    {
+        AcirFormat constraint_system{
+            .varnum = static_cast<uint32_t>(witness.size()),
+            .num_acir_opcodes = static_cast<uint32_t>(sha256_compression.size() + blake2s_constraints.size() +
+                                                      blake3_constraints.size() + keccak_permutations.size()),
+            .public_inputs = {},
+            .logic_constraints = {},
+            .range_constraints = {},
+            .aes128_constraints = {},
+            .sha256_compression = sha256_compression,
+
+            .ecdsa_k1_constraints = {},
+            .ecdsa_r1_constraints = {},
+            .blake2s_constraints = blake2s_constraints,
+            .blake3_constraints = blake3_constraints,
+            .keccak_permutations = keccak_permutations,
+            .poseidon2_constraints = {},
+            .multi_scalar_mul_constraints = {},
+            .ec_add_constraints = {},
+            .recursion_constraints = {},
+            .honk_recursion_constraints = {},
+            .avm_recursion_constraints = {},
+            .ivc_recursion_constraints = {},
+            .bigint_from_le_bytes_constraints = {},
+            .bigint_to_le_bytes_constraints = {},
+            .bigint_operations = {},
+            .assert_equalities = {},
+            .poly_triple_constraints = {},
+            .quad_constraints = {},
+            .big_quad_constraints = {},
+            .block_constraints = {},
+            .original_opcode_indices = create_empty_original_opcode_indices(),
+        };
+        mock_opcode_indices(constraint_system);
+        return constraint_system;
+    }
+
+    // Compression of a chain of blocks, with the first word of every block a constant and the second one a witness
+    // shared by all blocks
+    static std::vector<Sha256Compression> create_sha256_compressions(WitnessVector& witness, const size_t num_blocks)
+    {
+        const uint32_t shared_word_value = 0xdeadbeef;
+        const uint32_t shared_word = add_witness(witness, shared_word_value);
+        std::array<uint32_t, 8> state{ 0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+                                       0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19 };
+        std::array<WitnessOrConstant<fr>, 8> hash_values;
+        for (size_t i = 0; i < 8; ++i) {
+            hash_values[i] = WitnessOrConstant<fr>::from_index(add_witness(witness, state[i]));
+        }
+        std::vector<Sha256Compression> constraints;
+        for (size_t block_idx = 0; block_idx < num_blocks; ++block_idx) {
+            Sha256Compression constraint{ .inputs = {}, .hash_values = hash_values, .result = {} };
+            std::array<uint32_t, 16> block;
+            for (size_t i = 0; i < 16; ++i) {
+                block[i] = static_cast<uint32_t>(block_idx * 16 + i + 1);
+                constraint.inputs[i] = WitnessOrConstant<fr>::from_index(add_witness(witness, block[i]));
+            }
+            constraint.inputs[0] = constant(fr(block[0]));
+            block[1] = shared_word_value;
+            constraint.inputs[1] = WitnessOrConstant<fr>::from_index(shared_word);
+            state = crypto::sha256_block(state, block);
+            for (size_t i = 0; i < 8; ++i) {
+                constraint.result[i] = add_witness(witness, state[i]);
+                hash_values[i] = WitnessOrConstant<fr>::from_index(constraint.result[i]);
+            }
+            constraints.emplace_back(constraint);
+        }
+        return constraints;
+    }
+
+    // Hashes of messages whose first byte is a constant and whose second byte is a witness shared by all messages
+    template <typename Constraint, typename NativeHash>
+    static std::vector<Constraint> create_byte_hashes(WitnessVector& witness,
+                                                      const size_t num_messages,
+                                                      const NativeHash& native_hash)
+    {
+        const size_t message_length = 12;
+        const uint8_t shared_byte_value = 0xab;
+        const uint32_t shared_byte = add_witness(witness, shared_byte_value);
+        std::vector<Constraint> constraints;
+        for (size_t message_idx = 0; message_idx < num_messages; ++message_idx) {
+            Constraint constraint{ .inputs = {}, .result = {} };
+            std::vector<uint8_t> message;
+            for (size_t i = 0; i < message_length; ++i) {
+                message.emplace_back(static_cast<uint8_t>(message_idx * message_length + i));
+                const auto input = i == 0   ? constant(fr(message.back()))
+                                   : i == 1 ? WitnessOrConstant<fr>::from_index(shared_byte)
+                                            : WitnessOrConstant<fr>::from_index(add_witness(witness, message.back()));
+                constraint.inputs.push_back({ .blackbox_input = input, .num_bits = 8 });
+            }
+            message[1] = shared_byte_value;
+            const auto hash = native_hash(message);
+            for (size_t i = 0; i < 32; ++i) {
+                constraint.result[i] = add_witness(witness, hash[i]);
+            }
+            constraints.emplace_back(constraint);
+        }
+        return constraints;
+    }
+
+    static std::vector<Blake2sConstraint> create_blake2s_hashes(WitnessVector& witness, const size_t num_messages)
+    {
+        return create_byte_hashes<Blake2sConstraint>(
+            witness, num_messages, [](const std::vector<uint8_t>& message) { return crypto::blake2s(message); });
+    }
+
+    static std::vector<Blake3Constraint> create_blake3_hashes(WitnessVector& witness, const size_t num_messages)
+    {
+        return create_byte_hashes<Blake3Constraint>(
+            witness, num_messages, [](const std::vector<uint8_t>& message) { return blake3::blake3s(message); });
+    }
+
+    // A chain of permutations, with the first lane of every input state replaced by a constant
+    static std::vector<Keccakf1600> create_keccak_permutations(WitnessVector& witness, const size_t num_permutations)
+    {
+        std::array<uint64_t, 25> state;
+        std::array<WitnessOrConstant<fr>, 25> lanes;
+        for (size_t i = 0; i < 25; ++i) {
+            state[i] = 0x0123456789abcdefULL * (i + 1);
+            lanes[i] = WitnessOrConstant<fr>::from_index(add_witness(witness, state[i]));
+        }
+        std::vector<Keccakf1600> constraints;
+        for (size_t permutation_idx = 0; permutation_idx < num_permutations; ++permutation_idx) {
+            state[0] = permutation_idx + 1;
+            lanes[0] = constant(fr(state[0]));
+            Keccakf1600 constraint{ .state = lanes, .result = {} };
+            ethash_keccakf1600(state.data());
+            for (size_t i = 0; i < 25; ++i) {
+                constraint.result[i] = add_witness(witness, state[i]);
+                lanes[i] = WitnessOrConstant<fr>::from_index(constraint.result[i]);
+            }
+            constraints.emplace_back(constraint);
+        }
+        return constraints;
+    }
+
+    static inline const ProgramMetadata PARALLEL{ .parallel_hash_constraints = true };
+
+    // Check that the circuit constructed in parallel is satisfied, and that it is not once the last output of the
+    // program is incorrect
+    static void check_circuit(const AcirFormat& constraint_system, WitnessVector witness)
+    {
+        {
+            AcirProgram program{ constraint_system, witness };
+            auto builder = create_circuit(program, PARALLEL);
+            EXPECT_FALSE(builder.failed());
+            EXPECT_TRUE(CircuitChecker::check(builder));
+        }
+        witness.back() += 1;
+        AcirProgram program{ constraint_system, witness };
+        auto builder = create_circuit(program, PARALLEL);
+        EXPECT_FALSE(CircuitChecker::check(builder));
+    }
+
+    static std::shared_ptr<UltraFlavor::VerificationKey> compute_vk(UltraCircuitBuilder& builder)
+    {
+        auto proving_key = std::make_shared<DeciderProvingKey_<UltraFlavor>>(builder);
+        return std::make_shared<UltraFlavor::VerificationKey>(proving_key->proving_key);
+    }
+};
+
+TEST_F(HashConstraintChunksTests, Sha256CompressionChunks)
+{
+    WitnessVector witness;
+    auto sha256_compression = create_sha256_compressions(witness, /*num_blocks=*/9);
+    auto constraint_system = create_constraint_system(witness, sha256_compression, {}, {}, {});
+    check_circuit(constraint_system, witness);
+}
+
+TEST_F(HashConstraintChunksTests, Blake2sChunks)
+{
+    WitnessVector witness;
+    auto blake2s_constraints = create_blake2s_hashes(witness, /*num_messages=*/5);
+    auto constraint_system = create_constraint_system(witness, {}, blake2s_constraints, {}, {});
+    check_circuit(constraint_system, witness);
+}
+
+TEST_F(HashConstraintChunksTests, Blake3Chunks)
+{
+    WitnessVector witness;
+    auto blake3_constraints = create_blake3_hashes(witness, /*num_messages=*/5);
+    auto constraint_system = create_constraint_system(witness, {}, {}, blake3_constraints, {});
+    check_circuit(constraint_system, witness);
+}
+
+TEST_F(HashConstraintChunksTests, Keccakf1600Chunks)
+{
+    WitnessVector witness;
+    auto keccak_permutations = create_keccak_permutations(witness, /*num_permutations=*/3);
+    auto constraint_system = create_constraint_system(witness, {}, {}, {}, keccak_permutations);
+    check_circuit(constraint_system, witness);
+}
+
+/**
+ * @brief The circuit, and hence the verification key, does not depend on the witness (an empty witness is used by
+ * write_vk) nor on whether gates per opcode are collected (as by bb gates)
+ *
+ */
+TEST_F(HashConstraintChunksTests, CircuitIndependentOfWitnessAndGateCollection)
+{
+    WitnessVector witness;
+    auto sha256_compression = create_sha256_compressions(witness, /*num_blocks=*/5);
+    auto blake2s_constraints = create_blake2s_hashes(witness, /*num_messages=*/3);
+    auto blake3_constraints = create_blake3_hashes(witness, /*num_messages=*/3);
+    auto keccak_permutations = create_keccak_permutations(witness, /*num_permutations=*/2);
+    const auto constraint_system = create_constraint_system(
+        witness, sha256_compression, blake2s_constraints, blake3_constraints, keccak_permutations);
+
+    AcirProgram program{ constraint_system, witness };
+    auto builder = create_circuit(program, PARALLEL);
+    EXPECT_TRUE(CircuitChecker::check(builder));
+    const size_t num_gates = builder.get_estimated_num_finalized_gates();
+    const auto vk = compute_vk(builder);
+
+    AcirProgram program_without_witness{ constraint_system, {} };
+    auto builder_without_witness = create_circuit(program_without_witness, PARALLEL);
+    EXPECT_EQ(builder_without_witness.get_estimated_num_finalized_gates(), num_gates);
+    EXPECT_EQ(builder_without_witness.get_num_variables(), builder.get_num_variables());
+    EXPECT_EQ(*compute_vk(builder_without_witness), *vk);
+
+    AcirProgram program_with_gate_collection{ constraint_system, witness };
+    auto builder_with_gate_collection = create_circuit(
+        program_with_gate_collection,
+        ProgramMetadata{ .collect_gates_per_opcode = true, .parallel_hash_constraints = true });
+    EXPECT_EQ(builder_with_gate_collection.get_estimated_num_finalized_gates(), num_gates);
+    EXPECT_EQ(*compute_vk(builder_with_gate_collection), *vk);
+    const auto& gates_per_opcode = program_with_gate_collection.constraints.gates_per_opcode;
+    EXPECT_EQ(gates_per_opcode.size(), constraint_system.num_acir_opcodes);
+    for (const size_t num_opcode_gates : gates_per_opcode) {
+        EXPECT_GT(num_opcode_gates, 0U);
+    }
+}
+
+/**
+ * @brief Without opting in to parallel construction, the circuit is the one obtained by constructing the opcodes one by
+ * one in the main builder, so existing verification keys stay valid
+ *
+ */
+TEST_F(HashConstraintChunksTests, SerialConstructionByDefault)
+{
+    WitnessVector witness;
+    auto sha256_compression = create_sha256_compressions(witness, /*num_blocks=*/5);
+    auto blake2s_constraints = create_blake2s_hashes(witness, /*num_messages=*/3);
+    auto blake3_constraints = create_blake3_hashes(witness, /*num_messages=*/3);
+    auto keccak_permutations = create_keccak_permutations(witness, /*num_permutations=*/2);
+    const auto constraint_system = create_constraint_system(
+        witness, sha256_compression, blake2s_constraints, blake3_constraints, keccak_permutations);
+
+    UltraCircuitBuilder serial_builder{ /*size_hint=*/0, witness, {}, constraint_system.varnum };
+    for (const auto& constraint : sha256_compression) {
+        create_sha256_compression_constraints(serial_builder, constraint);
+    }
+    for (const auto& constraint : blake2s_constraints) {
+        create_blake2s_constraints(serial_builder, constraint);
+    }
+    for (const auto& constraint : blake3_constraints) {
+        create_blake3_constraints(serial_builder, constraint);
+    }
+    for (const auto& constraint : keccak_permutations) {
+        acir_format::create_keccak_permutations(serial_builder, constraint);
+    }
+
+    AcirProgram program{ constraint_system, witness };
+    auto builder = create_circuit(program);
+    EXPECT_TRUE(CircuitChecker::check(builder));
+    EXPECT_EQ(builder.get_num_variables(), serial_builder.get_num_variables());
+    EXPECT_EQ(builder.get_estimated_num_finalized_gates(), serial_builder.get_estimated_num_finalized_gates());
+    EXPECT_EQ(*compute_vk(builder), *compute_vk(serial_builder));
+}
+
+} // namespace acir_format::tests
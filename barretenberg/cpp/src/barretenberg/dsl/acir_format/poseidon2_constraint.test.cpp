@@ -1,6 +1,8 @@
 #include "poseidon2_constraint.hpp"
 #include "acir_format.hpp"
 #include "acir_format_mocks.hpp"
+#include "barretenberg/crypto/poseidon2/poseidon2_params.hpp"
+#include "barretenberg/crypto/poseidon2/poseidon2_permutation.hpp"
 #include "barretenberg/numeric/uint256/uint256.hpp"
 
 #include <cstdint>
@@ -86,4 +88,80 @@ TEST_F(Poseidon2Tests, TestPoseidon2Permutation)
     EXPECT_TRUE(CircuitChecker::check(builder));
 }
 
+/**
+ * @brief Create a circuit with enough chained permutations for them to be constructed in parallel chunks, when opted in
+ *
+ */
+TEST_F(Poseidon2Tests, TestManyPoseidon2Permutations)
+{
+    using NativePermutation = crypto::Poseidon2Permutation<crypto::Poseidon2Bn254ScalarFieldParams>;
+    const size_t num_permutations = 200;
+
+    // Each permutation is applied to the output of the previous one, with the second input replaced by the first
+    // witness in every fifth permutation, so that chunks share witnesses with each other
+    WitnessVector witness{ 1, 2, 3, 4 };
+    std::vector<Poseidon2Constraint> poseidon2_constraints;
+    NativePermutation::State state{ witness[0], witness[1], witness[2], witness[3] };
+    for (size_t i = 0; i < num_permutations; ++i) {
+        Poseidon2Constraint constraint{ .state = {}, .result = {}, .len = 4 };
+        for (uint32_t j = 0; j < 4; ++j) {
+            const uint32_t input_index = (i % 5 == 3 && j == 1) ? 0 : static_cast<uint32_t>(4 * i + j);
+            constraint.state.emplace_back(WitnessOrConstant<bb::fr>::from_index(input_index));
+            state[j] = witness[input_index];
+        }
+        state = NativePermutation::permutation(state);
+        for (const auto& value : state) {
+            constraint.result.emplace_back(static_cast<uint32_t>(witness.size()));
+            witness.emplace_back(value);
+        }
+        poseidon2_constraints.emplace_back(constraint);
+    }
+
+    AcirFormat constraint_system{
+        .varnum = static_cast<uint32_t>(witness.size()),
+        .num_acir_opcodes = static_cast<uint32_t>(num_permutations),
+        .public_inputs = {},
+        .logic_constraints = {},
+        .range_constraints = {},
+        .aes128_constraints = {},
+        .sha256_compression = {},
+
+        .ecdsa_k1_constraints = {},
+        .ecdsa_r1_constraints = {},
+        .blake2s_constraints = {},
+        .blake3_constraints = {},
+        .keccak_permutations = {},
+        .poseidon2_constraints = poseidon2_constraints,
+        .multi_scalar_mul_constraints = {},
+        .ec_add_constraints = {},
+        .recursion_constraints = {},
+        .honk_recursion_constraints = {},
+        .avm_recursion_constraints = {},
+        .ivc_recursion_constraints = {},
+        .bigint_from_le_bytes_constraints = {},
+        .bigint_to_le_bytes_constraints = {},
+        .bigint_operations = {},
+        .assert_equalities = {},
+        .poly_triple_constraints = {},
+        .quad_constraints = {},
+        .big_quad_constraints = {},
+        .block_constraints = {},
+        .original_opcode_indices = create_empty_original_opcode_indices(),
+    };
+    mock_opcode_indices(constraint_system);
+
+    const ProgramMetadata metadata{ .parallel_hash_constraints = true };
+    {
+        AcirProgram program{ constraint_system, witness };
+        auto builder = create_circuit(program, metadata);
+        EXPECT_TRUE(CircuitChecker::check(builder));
+    }
+
+    // An incorrect output of the last permutation is caught
+    witness.back() += 1;
+    AcirProgram program{ constraint_system, witness };
+    auto builder = create_circuit(program, metadata);
+    EXPECT_FALSE(CircuitChecker::check(builder));
+}
+
 } // namespace acir_format::tests
@@ -3,7 +3,9 @@
 #include "barretenberg/honk/composer/composer_lib.hpp"
 #include "barretenberg/honk/types/circuit_type.hpp"
 #include "barretenberg/srs/global_crs.hpp"
+#include <algorithm>
 #include <array>
+#include <stdexcept>
 #include <gtest/gtest.h>
 
 using namespace bb;
@@ -81,3 +83,113 @@ TEST_F(PermutationHelperTests, ComputeHonkStyleSigmaLagrangePolynomialsFromMappi
     compute_honk_style_permutation_lagrange_polynomials_from_mapping<Flavor>(
         proving_key->polynomials.get_sigmas(), mapping.sigmas, proving_key.get());
 }
+
+namespace {
+using GeneralizedMapping = PermutationMapping<UltraFlavor::NUM_WIRES, /*generalized=*/true>;
+
+// The generalized mapping as compute_permutation_mapping computed it before tau was flattened: serially, querying the
+// std::map for every cycle.
+GeneralizedMapping compute_map_based_mapping(const UltraFlavor::CircuitBuilder& circuit_constructor,
+                                             UltraFlavor::ProvingKey* proving_key,
+                                             const CopyCycles& wire_copy_cycles)
+{
+    GeneralizedMapping mapping(proving_key->circuit_size);
+    for (size_t cycle_idx = 0; cycle_idx < wire_copy_cycles.size(); ++cycle_idx) {
+        const CyclicPermutation cycle = wire_copy_cycles[cycle_idx];
+        for (size_t node_idx = 0; node_idx < cycle.size(); ++node_idx) {
+            const cycle_node& current_node = cycle[node_idx];
+            const auto current_row = static_cast<ptrdiff_t>(current_node.gate_idx);
+            const auto current_column = current_node.wire_idx;
+            size_t next_node_idx = (node_idx == cycle.size() - 1 ? 0 : node_idx + 1);
+            const cycle_node& next_node = cycle[next_node_idx];
+
+            mapping.sigmas[current_column].row_idx[current_row] = next_node.gate_idx;
+            mapping.sigmas[current_column].col_idx[current_row] = static_cast<uint8_t>(next_node.wire_idx);
+            if (node_idx == 0) {
+                mapping.ids[current_column].is_tag[current_row] = true;
+                mapping.ids[current_column].row_idx[current_row] = circuit_constructor.real_variable_tags[cycle_idx];
+            }
+            if (next_node_idx == 0) {
+                mapping.sigmas[current_column].is_tag[current_row] = true;
+                mapping.sigmas[current_column].row_idx[current_row] =
+                    circuit_constructor.tau.at(circuit_constructor.real_variable_tags[cycle_idx]);
+            }
+        }
+    }
+    for (size_t i = 0; i < circuit_constructor.public_inputs.size(); ++i) {
+        const auto idx = static_cast<ptrdiff_t>(i + proving_key->pub_inputs_offset);
+        mapping.sigmas[0].row_idx[idx] = static_cast<uint32_t>(idx);
+        mapping.sigmas[0].col_idx[idx] = 0;
+        mapping.sigmas[0].is_public_input[idx] = true;
+    }
+    return mapping;
+}
+
+// One cycle per real variable, over all the wires of the row of the same index. Every third cycle is empty.
+CopyCycles make_copy_cycles(const UltraFlavor::CircuitBuilder& circuit_constructor, size_t circuit_size)
+{
+    CopyCycles cycles;
+    const size_t num_cycles = std::min(circuit_constructor.real_variable_tags.size(), circuit_size);
+    cycles.offsets.push_back(0);
+    for (uint32_t row = 0; row < num_cycles; ++row) {
+        if (row % 3 != 2) {
+            for (uint32_t wire = 0; wire < UltraFlavor::NUM_WIRES; ++wire) {
+                cycles.nodes.push_back({ .wire_idx = wire, .gate_idx = row });
+            }
+        }
+        cycles.offsets.push_back(cycles.nodes.size());
+    }
+    return cycles;
+}
+
+void expect_same_mapping(const Mapping& actual, const Mapping& expected, size_t size)
+{
+    for (size_t i = 0; i < size; ++i) {
+        const auto idx = static_cast<ptrdiff_t>(i);
+        EXPECT_EQ(actual.row_idx[idx], expected.row_idx[idx]) << "row " << i;
+        EXPECT_EQ(actual.col_idx[idx], expected.col_idx[idx]) << "row " << i;
+        EXPECT_EQ(actual.is_public_input[idx], expected.is_public_input[idx]) << "row " << i;
+        EXPECT_EQ(actual.is_tag[idx], expected.is_tag[idx]) << "row " << i;
+    }
+}
+} // namespace
+
+TEST_F(PermutationHelperTests, GeneralizedMappingMatchesMapBasedTau)
+{
+    // Two tags that are each other's tau, with a tag between them that has no entry in tau
+    const uint32_t tag_a = circuit_constructor.get_new_tag();
+    circuit_constructor.get_new_tag();
+    const uint32_t tag_b = circuit_constructor.get_new_tag();
+    circuit_constructor.create_tag(tag_a, tag_b);
+    circuit_constructor.create_tag(tag_b, tag_a);
+    for (uint32_t variable = 0; variable < circuit_constructor.get_num_variables(); variable += 2) {
+        circuit_constructor.assign_tag(variable, variable % 4 == 0 ? tag_a : tag_b);
+    }
+    const CopyCycles cycles = make_copy_cycles(circuit_constructor, proving_key->circuit_size);
+
+    auto mapping =
+        compute_permutation_mapping<Flavor, /*generalized=*/true>(circuit_constructor, proving_key.get(), cycles);
+    auto expected = compute_map_based_mapping(circuit_constructor, proving_key.get(), cycles);
+
+    for (size_t wire = 0; wire < Flavor::NUM_WIRES; ++wire) {
+        expect_same_mapping(mapping.sigmas[wire], expected.sigmas[wire], proving_key->circuit_size);
+        expect_same_mapping(mapping.ids[wire], expected.ids[wire], proving_key->circuit_size);
+    }
+}
+
+TEST_F(PermutationHelperTests, GeneralizedMappingRejectsTagWithoutTau)
+{
+    // A tag inside the range of tau that has no entry of its own
+    const uint32_t tag_a = circuit_constructor.get_new_tag();
+    const uint32_t missing_tag = circuit_constructor.get_new_tag();
+    const uint32_t tag_b = circuit_constructor.get_new_tag();
+    circuit_constructor.create_tag(tag_a, tag_b);
+    circuit_constructor.create_tag(tag_b, tag_a);
+    circuit_constructor.assign_tag(/*variable_index=*/0, missing_tag);
+    const CopyCycles cycles = make_copy_cycles(circuit_constructor, proving_key->circuit_size);
+
+    auto compute_mapping = [&] {
+        return compute_permutation_mapping<Flavor, /*generalized=*/true>(circuit_constructor, proving_key.get(), cycles);
+    };
+    EXPECT_THROW(compute_mapping(), std::runtime_error);
+}
@@ -70,7 +70,7 @@ void construct_lookup_read_counts(typename Flavor::Polynomial& read_counts,
             auto table_entry = gate_data.to_table_components(table.use_twin_keys);
 
             // find the index of the entry in the table
-            auto index_in_table = table.index_map[table_entry];
+            auto index_in_table = table.get_index(table_entry);
 
             // increment the read count at the corresponding index in the full polynomial
             size_t index_in_poly = table_offset + index_in_table;
@@ -80,3 +80,27 @@ TEST_F(ComposerLibTests, LookupReadCounts)
         idx++;
     }
 }
+
+/**
+ * @brief Check that every entry of a basic table is mapped to a row of the table containing that entry, both for tables
+ * whose keys are indexed directly and for tables whose entries are hashed
+ *
+ */
+TEST_F(ComposerLibTests, LookupTableIndexMap)
+{
+    using namespace plookup;
+    for (const auto id : { BasicTableId::UINT_XOR_SLICE_6_ROTATE_0,
+                           BasicTableId::BN254_XLO_BASIC,
+                           BasicTableId::AES_SBOX_MAP,
+                           BasicTableId::KECCAK_CHI }) {
+        BasicTable table = create_basic_table(id, 0);
+        table.initialize_index_map();
+        for (size_t i = 0; i < table.size(); ++i) {
+            const size_t index = table.get_index({ table.column_1[i], table.column_2[i], table.column_3[i] });
+            ASSERT_LT(index, table.size());
+            EXPECT_EQ(table.column_1[index], table.column_1[i]);
+            EXPECT_EQ(table.column_2[index], table.column_2[i]);
+            EXPECT_EQ(table.column_3[index], table.column_3[i]);
+        }
+    }
+}
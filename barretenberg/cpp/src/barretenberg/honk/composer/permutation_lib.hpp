@@ -13,8 +13,10 @@
  */
 #pragma once
 
+#include "barretenberg/common/assert.hpp"
 #include "barretenberg/common/ref_span.hpp"
 #include "barretenberg/common/ref_vector.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/flavor/flavor.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
@@ -25,6 +27,9 @@
 #include <cstddef>
 #include <cstdint>
 #include <initializer_list>
+#include <limits>
+#include <map>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
@@ -124,9 +129,46 @@ template <size_t NUM_WIRES, bool generalized> struct PermutationMapping {
     }
 };
 
-using CyclicPermutation = std::vector<cycle_node>;
+using CyclicPermutation = std::span<const cycle_node>;
+
+/**
+ * @brief The copy cycles of a circuit, stored flat (CSR layout)
+ *
+ * @details Cycle i holds the addresses of all the wires whose variable has real variable index i. Its nodes are
+ * nodes[offsets[i]], ..., nodes[offsets[i + 1] - 1], ordered by (gate_idx, wire_idx). Storing the cycles in two flat
+ * arrays avoids allocating one vector per variable.
+ */
+struct CopyCycles {
+    std::vector<size_t> offsets;
+    std::vector<cycle_node> nodes;
+
+    size_t size() const { return offsets.empty() ? 0 : offsets.size() - 1; }
+    CyclicPermutation operator[](size_t cycle_idx) const
+    {
+        return CyclicPermutation(nodes).subspan(offsets[cycle_idx], offsets[cycle_idx + 1] - offsets[cycle_idx]);
+    }
+};
 
 namespace {
+// Marks the tags that have no entry in tau once it is flattened
+constexpr uint32_t NO_TAU = std::numeric_limits<uint32_t>::max();
+
+/**
+ * @brief Flatten tau into a vector indexed by tag, since std::maps are expensive to query
+ * @details Tags without an entry in tau map to NO_TAU rather than 0, so that a lookup of a missing tag can be caught.
+ */
+inline std::vector<uint32_t> flatten_tau(const std::map<uint32_t, uint32_t>& tau)
+{
+    std::vector<uint32_t> flat_tau;
+    if (!tau.empty()) {
+        flat_tau.resize(static_cast<size_t>(tau.rbegin()->first) + 1, NO_TAU);
+        for (const auto& [tag, tau_of_tag] : tau) {
+            flat_tau[tag] = tau_of_tag;
+        }
+    }
+    return flat_tau;
+}
+
 /**
  * @brief Compute the traditional or generalized permutation mapping
  *
@@ -143,7 +185,7 @@ template <typename Flavor, bool generalized>
 PermutationMapping<Flavor::NUM_WIRES, generalized> compute_permutation_mapping(
     const typename Flavor::CircuitBuilder& circuit_constructor,
     typename Flavor::ProvingKey* proving_key,
-    const std::vector<CyclicPermutation>& wire_copy_cycles)
+    const CopyCycles& wire_copy_cycles)
 {
 
     // Initialize the table of permutations so that every element points to itself
@@ -152,43 +194,57 @@ PermutationMapping<Flavor::NUM_WIRES, generalized> compute_permutation_mapping(
     // Represents the idx of a variable in circuit_constructor.variables (needed only for generalized)
     std::span<const uint32_t> real_variable_tags = circuit_constructor.real_variable_tags;
 
-    // Go through each cycle
-    for (size_t cycle_idx = 0; cycle_idx < wire_copy_cycles.size(); ++cycle_idx) {
-        const CyclicPermutation& cycle = wire_copy_cycles[cycle_idx];
-        for (size_t node_idx = 0; node_idx < cycle.size(); ++node_idx) {
-            // Get the indices (column, row) of the current node in the cycle
-            const cycle_node& current_node = cycle[node_idx];
-            const auto current_row = static_cast<ptrdiff_t>(current_node.gate_idx);
-            const auto current_column = current_node.wire_idx;
-
-            // Get indices of next node; If the current node is last in the cycle, then the next is the first one
-            size_t next_node_idx = (node_idx == cycle.size() - 1 ? 0 : node_idx + 1);
-            const cycle_node& next_node = cycle[next_node_idx];
-            const auto next_row = next_node.gate_idx;
-            const auto next_column = static_cast<uint8_t>(next_node.wire_idx);
-
-            // Point current node to the next node
-            mapping.sigmas[current_column].row_idx[current_row] = next_row;
-            mapping.sigmas[current_column].col_idx[current_row] = next_column;
-
-            if constexpr (generalized) {
-                const bool first_node = (node_idx == 0);
-                const bool last_node = (next_node_idx == 0);
-
-                if (first_node) {
-                    mapping.ids[current_column].is_tag[current_row] = true;
-                    mapping.ids[current_column].row_idx[current_row] = real_variable_tags[cycle_idx];
-                }
-                if (last_node) {
-                    mapping.sigmas[current_column].is_tag[current_row] = true;
+    std::vector<uint32_t> tau;
+    if constexpr (generalized) {
+        tau = flatten_tau(circuit_constructor.tau);
+        // Every non-empty cycle needs the tau of its tag. Check them here rather than in the parallel loop below, so
+        // that a missing entry throws like std::map::at did.
+        for (size_t cycle_idx = 0; cycle_idx < wire_copy_cycles.size(); ++cycle_idx) {
+            const uint32_t tag = real_variable_tags[cycle_idx];
+            if (!wire_copy_cycles[cycle_idx].empty() && (tag >= tau.size() || tau[tag] == NO_TAU)) {
+                throw_or_abort("compute_permutation_mapping: no tau for tag " + std::to_string(tag));
+            }
+        }
+    }
 
-                    // TODO(Zac): yikes, std::maps (tau) are expensive. Can we find a way to get rid of this?
-                    mapping.sigmas[current_column].row_idx[current_row] =
-                        circuit_constructor.tau.at(real_variable_tags[cycle_idx]);
+    // Go through each cycle. Cycles are disjoint, so each one writes to a different set of mapping entries.
+    parallel_for_range(wire_copy_cycles.size(), [&](size_t start, size_t end) {
+        for (size_t cycle_idx = start; cycle_idx < end; ++cycle_idx) {
+            const CyclicPermutation cycle = wire_copy_cycles[cycle_idx];
+            for (size_t node_idx = 0; node_idx < cycle.size(); ++node_idx) {
+                // Get the indices (column, row) of the current node in the cycle
+                const cycle_node& current_node = cycle[node_idx];
+                const auto current_row = static_cast<ptrdiff_t>(current_node.gate_idx);
+                const auto current_column = current_node.wire_idx;
+
+                // Get indices of next node; If the current node is last in the cycle, then the next is the first one
+                size_t next_node_idx = (node_idx == cycle.size() - 1 ? 0 : node_idx + 1);
+                const cycle_node& next_node = cycle[next_node_idx];
+                const auto next_row = next_node.gate_idx;
+                const auto next_column = static_cast<uint8_t>(next_node.wire_idx);
+
+                // Point current node to the next node
+                mapping.sigmas[current_column].row_idx[current_row] = next_row;
+                mapping.sigmas[current_column].col_idx[current_row] = next_column;
+
+                if constexpr (generalized) {
+                    const bool first_node = (node_idx == 0);
+                    const bool last_node = (next_node_idx == 0);
+
+                    if (first_node) {
+                        mapping.ids[current_column].is_tag[current_row] = true;
+                        mapping.ids[current_column].row_idx[current_row] = real_variable_tags[cycle_idx];
+                    }
+                    if (last_node) {
+                        const uint32_t tau_of_tag = tau[real_variable_tags[cycle_idx]];
+                        ASSERT(tau_of_tag != NO_TAU);
+                        mapping.sigmas[current_column].is_tag[current_row] = true;
+                        mapping.sigmas[current_column].row_idx[current_row] = tau_of_tag;
+                    }
                 }
             }
         }
-    }
+    });
 
     // Add information about public inputs so that the cycles can be altered later; See the construction of the
     // permutation polynomials for details.
@@ -233,11 +289,12 @@ void compute_honk_style_permutation_lagrange_polynomials_from_mapping(
 
     const MultithreadData thread_data = calculate_thread_data(domain_size);
 
-    size_t wire_idx = 0;
-    for (auto& current_permutation_poly : permutation_polynomials) {
-        parallel_for(thread_data.num_threads, [&](size_t j) {
-            const size_t start = thread_data.start[j];
-            const size_t end = thread_data.end[j];
+    // Fill all the polynomials in a single parallel pass over the active rows
+    parallel_for(thread_data.num_threads, [&](size_t j) {
+        const size_t start = thread_data.start[j];
+        const size_t end = thread_data.end[j];
+        size_t wire_idx = 0;
+        for (auto& current_permutation_poly : permutation_polynomials) {
             for (size_t i = start; i < end; ++i) {
                 const size_t poly_idx = proving_key->active_region_data.get_idx(i);
                 const auto idx = static_cast<ptrdiff_t>(poly_idx);
@@ -265,9 +322,9 @@ void compute_honk_style_permutation_lagrange_polynomials_from_mapping(
                     current_permutation_poly.at(poly_idx) = FF(current_row_idx + num_gates * current_col_idx);
                 }
             }
-        });
-        wire_idx++;
-    }
+            wire_idx++;
+        }
+    });
 }
 } // namespace
 
@@ -282,7 +339,7 @@ void compute_honk_style_permutation_lagrange_polynomials_from_mapping(
 template <typename Flavor>
 void compute_permutation_argument_polynomials(const typename Flavor::CircuitBuilder& circuit,
                                               typename Flavor::ProvingKey* key,
-                                              const std::vector<CyclicPermutation>& copy_cycles)
+                                              const CopyCycles& copy_cycles)
 {
     constexpr bool generalized = IsUltraOrMegaHonk<Flavor>;
     auto mapping = compute_permutation_mapping<Flavor, generalized>(circuit, key, copy_cycles);
@@ -9,6 +9,7 @@
 #include "barretenberg/common/ref_array.hpp"
 #include "barretenberg/common/slab_allocator.hpp"
 #include <cstddef>
+#include <span>
 
 #ifdef CHECK_CIRCUIT_STACKTRACES
 #include <backward.hpp>
@@ -90,6 +91,39 @@ template <typename FF, size_t NUM_WIRES_, size_t NUM_SELECTORS_> class Execution
 #endif
     }
 
+    /**
+     * @brief Append a batch of gates to the block in one go
+     * @details The wire columns are filled from gate_wires and every selector column is extended with zeros, so each
+     * column grows once per batch rather than once per gate. The caller then sets the non-zero selectors of the new
+     * rows, which start at the returned row index.
+     *
+     * @param gate_wires Wire indices of the gates, NUM_WIRES consecutive entries per gate
+     * @return size_t Row index of the first appended gate
+     */
+    size_t append_gates(std::span<const uint32_t> gate_wires)
+    {
+        ASSERT(gate_wires.size() % NUM_WIRES == 0);
+        const size_t first_row = size();
+        const size_t num_gates = gate_wires.size() / NUM_WIRES;
+        for (size_t wire_idx = 0; wire_idx < NUM_WIRES; ++wire_idx) {
+            auto& wire = wires[wire_idx];
+            wire.resize(first_row + num_gates);
+            for (size_t i = 0; i < num_gates; ++i) {
+                wire[first_row + i] = gate_wires[i * NUM_WIRES + wire_idx];
+            }
+        }
+        for (auto& selector : selectors) {
+            selector.resize(first_row + num_gates, FF(0));
+        }
+        for (size_t i = 0; i < num_gates; ++i) {
+#ifdef CHECK_CIRCUIT_STACKTRACES
+            stack_traces.populate();
+#endif
+            tracy_gate();
+        }
+        return first_row;
+    }
+
     uint32_t get_fixed_size(bool is_structured = true) const
     {
         return is_structured ? fixed_size : static_cast<uint32_t>(size());
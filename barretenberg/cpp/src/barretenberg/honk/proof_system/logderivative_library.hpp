@@ -13,26 +13,14 @@
 namespace bb {
 
 /**
- * @brief Compute the inverse polynomial I(X) required for logderivative lookups
- * *
- * details
- * Inverse may be defined in terms of its values  on X_i = 0,1,...,n-1 as Z_perm[0] = 1 and for i = 1:n-1
- *                           1                              1
- * Inverse[i] = ∏ -------------------------- * ∏' --------------------------
- *                  relation::read_term(j)         relation::write_term(j)
- *
- * where ∏ := ∏_{j=0:relation::NUM_READ_TERMS-1} and ∏' := ∏'_{j=0:relation::NUM_WRITE_TERMS-1}
- *
- * If row [i] does not contain a lookup read gate or a write gate, Inverse[i] = 0
- * N.B. by "write gate" we mean; do the lookup table polynomials contain nonzero values at this row?
- * (in the ECCVM, the lookup table is not precomputed, so we have a concept of a "write gate", unlike when precomputed
- * lookup tables are used)
- *
- * The specific algebraic relations that define read terms and write terms are defined in Flavor::LookupRelation
- *
+ * @brief Fill the inverse polynomial I(X) with the products of the read and write terms, before inverting them
+ * @details This is the first half of compute_logderivative_inverse. It is exposed separately so that provers with
+ * many lookup relations can invert all of the inverse polynomials together.
  */
 template <typename FF, typename Relation, typename Polynomials>
-void compute_logderivative_inverse(Polynomials& polynomials, auto& relation_parameters, const size_t circuit_size)
+void compute_logderivative_inverse_denominators(Polynomials& polynomials,
+                                                auto& relation_parameters,
+                                                const size_t circuit_size)
 {
     using Accumulator = typename Relation::ValueAccumulator0;
     constexpr size_t READ_TERMS = Relation::READ_TERMS;
@@ -59,9 +47,35 @@ void compute_logderivative_inverse(Polynomials& polynomials, auto& relation_para
         });
         inverse_polynomial.at(i) = denominator;
     };
+}
+
+/**
+ * @brief Compute the inverse polynomial I(X) required for logderivative lookups
+ * *
+ * details
+ * Inverse may be defined in terms of its values  on X_i = 0,1,...,n-1 as Z_perm[0] = 1 and for i = 1:n-1
+ *                           1                              1
+ * Inverse[i] = ∏ -------------------------- * ∏' --------------------------
+ *                  relation::read_term(j)         relation::write_term(j)
+ *
+ * where ∏ := ∏_{j=0:relation::NUM_READ_TERMS-1} and ∏' := ∏'_{j=0:relation::NUM_WRITE_TERMS-1}
+ *
+ * If row [i] does not contain a lookup read gate or a write gate, Inverse[i] = 0
+ * N.B. by "write gate" we mean; do the lookup table polynomials contain nonzero values at this row?
+ * (in the ECCVM, the lookup table is not precomputed, so we have a concept of a "write gate", unlike when precomputed
+ * lookup tables are used)
+ *
+ * The specific algebraic relations that define read terms and write terms are defined in Flavor::LookupRelation
+ *
+ */
+template <typename FF, typename Relation, typename Polynomials>
+void compute_logderivative_inverse(Polynomials& polynomials, auto& relation_parameters, const size_t circuit_size)
+{
+    compute_logderivative_inverse_denominators<FF, Relation>(polynomials, relation_parameters, circuit_size);
 
     // Compute inverse polynomial I in place by inverting the product at each row
     // Note: zeroes are ignored as they are not used anyway
+    auto& inverse_polynomial = Relation::template get_inverse_polynomial(polynomials);
     FF::batch_invert(inverse_polynomial.coeffs());
 }
 
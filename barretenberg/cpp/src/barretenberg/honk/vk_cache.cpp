@@ -0,0 +1,281 @@
+#include "barretenberg/honk/vk_cache.hpp"
+
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/common/thread.hpp"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <random>
+#include <sstream>
+#include <string_view>
+#include <system_error>
+
+namespace bb {
+
+namespace {
+
+// Bumped whenever the format of the cached entries changes, so that stale entries are never read.
+constexpr uint64_t CACHE_FORMAT_VERSION = 2;
+
+// Inputs are hashed in chunks of this size, in parallel.
+constexpr size_t HASH_CHUNK_SIZE = static_cast<size_t>(1) << 20;
+
+// Every entry starts with a header: magic, format version, payload length and SHA-256 of the payload. Entries are
+// shared across processes, so a truncated or corrupt one is detected on load rather than deserialized.
+constexpr std::array<uint8_t, 4> ENTRY_MAGIC{ 'B', 'B', 'V', 'K' };
+constexpr size_t ENTRY_HEADER_SIZE = ENTRY_MAGIC.size() + 2 * sizeof(uint64_t) + sizeof(crypto::Sha256Hash);
+
+// Marks the temporary files of entries being written (possibly by another process)
+constexpr std::string_view TMP_SUFFIX = ".tmp";
+
+void write_u64(std::vector<uint8_t>& out, uint64_t value)
+{
+    for (size_t i = 0; i < sizeof(value); i++) {
+        out.push_back(static_cast<uint8_t>(value >> (8 * i)));
+    }
+}
+
+uint64_t read_u64(const uint8_t* in)
+{
+    uint64_t value = 0;
+    for (size_t i = 0; i < sizeof(value); i++) {
+        value |= static_cast<uint64_t>(in[i]) << (8 * i);
+    }
+    return value;
+}
+
+std::vector<uint8_t> entry_header(const std::vector<uint8_t>& payload)
+{
+    std::vector<uint8_t> header(ENTRY_MAGIC.begin(), ENTRY_MAGIC.end());
+    write_u64(header, CACHE_FORMAT_VERSION);
+    write_u64(header, payload.size());
+    const auto hash = crypto::sha256(payload);
+    header.insert(header.end(), hash.begin(), hash.end());
+    return header;
+}
+
+// Returns the payload of an entry, or nullopt if the entry is not one written by store() with this format
+std::optional<std::vector<uint8_t>> entry_payload(const std::vector<uint8_t>& entry)
+{
+    if (entry.size() < ENTRY_HEADER_SIZE || !std::equal(ENTRY_MAGIC.begin(), ENTRY_MAGIC.end(), entry.begin())) {
+        return std::nullopt;
+    }
+    const uint8_t* header = entry.data() + ENTRY_MAGIC.size();
+    const uint64_t version = read_u64(header);
+    const uint64_t payload_size = read_u64(header + sizeof(uint64_t));
+    if (version != CACHE_FORMAT_VERSION || payload_size != entry.size() - ENTRY_HEADER_SIZE) {
+        return std::nullopt;
+    }
+    std::vector<uint8_t> payload(entry.begin() + static_cast<std::ptrdiff_t>(ENTRY_HEADER_SIZE), entry.end());
+    if (entry_header(payload) != std::vector<uint8_t>(entry.begin(), entry.begin() + ENTRY_HEADER_SIZE)) {
+        return std::nullopt;
+    }
+    return payload;
+}
+
+} // namespace
+
+VerificationKeyCache::VerificationKeyCache()
+{
+    const char* dir = std::getenv("BB_VK_CACHE_DIR");
+    if (dir == nullptr || std::string(dir).empty()) {
+        return;
+    }
+    size_t max_size = DEFAULT_MAX_SIZE_BYTES;
+    if (const char* max_mb = std::getenv("BB_VK_CACHE_MAX_MB"); max_mb != nullptr) {
+        // This runs during static initialization, so a malformed value falls back to the default instead of throwing
+        const std::string_view value(max_mb);
+        size_t parsed = 0;
+        const auto [end, ec] = std::from_chars(value.data(), value.data() + value.size(), parsed);
+        if (ec == std::errc{} && end == value.data() + value.size() && parsed <= (SIZE_MAX >> 20)) {
+            max_size = parsed << 20;
+        } else {
+            info("WARNING: ignoring invalid BB_VK_CACHE_MAX_MB value '", value, "'");
+        }
+    }
+    set_directory(dir, max_size);
+}
+
+VerificationKeyCache& VerificationKeyCache::get()
+{
+    static VerificationKeyCache cache;
+    return cache;
+}
+
+void VerificationKeyCache::set_directory(const std::filesystem::path& new_directory, size_t new_max_size_bytes)
+{
+    std::lock_guard lock(mutex);
+    std::error_code ec;
+    std::filesystem::create_directories(new_directory, ec);
+    if (ec) {
+        info("WARNING: could not create verification key cache directory ", new_directory, ": ", ec.message());
+        directory.clear();
+        return;
+    }
+    directory = new_directory;
+    max_size_bytes = new_max_size_bytes;
+}
+
+void VerificationKeyCache::disable()
+{
+    std::lock_guard lock(mutex);
+    directory.clear();
+}
+
+bool VerificationKeyCache::enabled() const
+{
+    std::lock_guard lock(mutex);
+    return !directory.empty();
+}
+
+std::optional<std::vector<uint8_t>> VerificationKeyCache::load(const std::string& key)
+{
+    std::lock_guard lock(mutex);
+    // The cache may have been disabled since the caller checked enabled(). A removed directory is a miss below.
+    if (directory.empty()) {
+        stats.misses++;
+        return std::nullopt;
+    }
+    const auto path = directory / key;
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    const auto entry_size = file.tellg();
+    if (!file || entry_size < 0) {
+        stats.misses++;
+        vinfo("verification key cache miss: ", key);
+        return std::nullopt;
+    }
+    std::vector<uint8_t> entry(static_cast<size_t>(entry_size));
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(entry.data()), static_cast<std::streamsize>(entry.size()));
+    auto buffer = file ? entry_payload(entry) : std::nullopt;
+    file.close();
+    std::error_code ec;
+    if (!buffer) {
+        info("WARNING: discarding invalid verification key cache entry ", path);
+        std::filesystem::remove(path, ec);
+        stats.misses++;
+        return std::nullopt;
+    }
+    // Mark the entry as recently used
+    std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now(), ec);
+    stats.hits++;
+    vinfo("verification key cache hit: ", key);
+    return buffer;
+}
+
+void VerificationKeyCache::store(const std::string& key, const std::vector<uint8_t>& buffer)
+{
+    std::lock_guard lock(mutex);
+    if (directory.empty()) {
+        return;
+    }
+    // Write to a temporary file and rename it, so that concurrent processes never read a partial entry
+    const auto path = directory / key;
+    const auto tmp_path = directory / (key + std::string(TMP_SUFFIX) + std::to_string(std::random_device{}()));
+    {
+        const auto header = entry_header(buffer);
+        std::ofstream file(tmp_path, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(header.data()), static_cast<std::streamsize>(header.size()));
+        file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+        if (!file) {
+            info("WARNING: could not write verification key cache entry ", path);
+            return;
+        }
+    }
+    std::error_code ec;
+    std::filesystem::rename(tmp_path, path, ec);
+    if (ec) {
+        std::filesystem::remove(tmp_path, ec);
+        return;
+    }
+    evict_to_fit();
+}
+
+void VerificationKeyCache::evict_to_fit()
+{
+    struct Entry {
+        std::filesystem::path path;
+        std::filesystem::file_time_type last_used;
+        size_t size;
+    };
+    std::vector<Entry> entries;
+    size_t total_size = 0;
+    std::error_code ec;
+    for (const auto& dir_entry : std::filesystem::directory_iterator(directory, ec)) {
+        // Skip entries still being written, by this or another process
+        if (!dir_entry.is_regular_file(ec) ||
+            dir_entry.path().filename().string().find(TMP_SUFFIX) != std::string::npos) {
+            continue;
+        }
+        Entry entry{ dir_entry.path(), dir_entry.last_write_time(ec), static_cast<size_t>(dir_entry.file_size(ec)) };
+        total_size += entry.size;
+        entries.push_back(std::move(entry));
+    }
+    if (total_size <= max_size_bytes) {
+        return;
+    }
+    std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) { return a.last_used < b.last_used; });
+    for (const auto& entry : entries) {
+        if (total_size <= max_size_bytes) {
+            break;
+        }
+        if (std::filesystem::remove(entry.path, ec)) {
+            total_size -= entry.size;
+            stats.evictions++;
+        }
+    }
+}
+
+VerificationKeyCache::Stats VerificationKeyCache::get_stats() const
+{
+    std::lock_guard lock(mutex);
+    return stats;
+}
+
+void CircuitStructureHasher::add(std::span<const uint8_t> bytes)
+{
+    const size_t num_chunks = (bytes.size() + HASH_CHUNK_SIZE - 1) / HASH_CHUNK_SIZE;
+    std::vector<crypto::Sha256Hash> chunk_digests(num_chunks);
+    parallel_for(num_chunks, [&](size_t i) {
+        auto chunk = bytes.subspan(i * HASH_CHUNK_SIZE, std::min(HASH_CHUNK_SIZE, bytes.size() - i * HASH_CHUNK_SIZE));
+        chunk_digests[i] = crypto::sha256(std::vector<uint8_t>(chunk.begin(), chunk.end()));
+    });
+    for (const auto& chunk_digest : chunk_digests) {
+        digests.insert(digests.end(), chunk_digest.begin(), chunk_digest.end());
+    }
+}
+
+void CircuitStructureHasher::add(uint64_t value)
+{
+    // Values are few and small, so they are appended as they are rather than hashed
+    for (size_t i = 0; i < sizeof(value); i++) {
+        digests.push_back(static_cast<uint8_t>(value >> (8 * i)));
+    }
+}
+
+void CircuitStructureHasher::add(const std::string& value)
+{
+    add(static_cast<uint64_t>(value.size()));
+    add(std::span<const uint8_t>(reinterpret_cast<const uint8_t*>(value.data()), value.size()));
+}
+
+std::string CircuitStructureHasher::digest() const
+{
+    std::vector<uint8_t> input = digests;
+    for (size_t i = 0; i < sizeof(CACHE_FORMAT_VERSION); i++) {
+        input.push_back(static_cast<uint8_t>(CACHE_FORMAT_VERSION >> (8 * i)));
+    }
+    const auto hash = crypto::sha256(input);
+    std::ostringstream os;
+    for (uint8_t byte : hash) {
+        os << std::hex << std::setw(2) << std::setfill('0') << static_cast<int>(byte);
+    }
+    return os.str();
+}
+
+} // namespace bb
@@ -0,0 +1,141 @@
+// === AUDIT STATUS ===
+// internal:    { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_1:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_2:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// =====================
+
+#pragma once
+
+#include "barretenberg/common/serialize.hpp"
+#include "barretenberg/crypto/sha256/sha256.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+namespace bb {
+
+/**
+ * @brief A persistent, on-disk cache of serialized verification keys
+ * @details Computing a verification key requires committing to every precomputed polynomial (selectors, sigmas, ids,
+ * tables...), but the same circuits are proven over and over. Entries are stored one per file, named by a hash of
+ * everything that the verification key is computed from (see compute_verification_key_cached). Each entry carries a
+ * header with a format version, its length and a checksum; an entry that does not match its header is treated as a miss
+ * and deleted.
+ *
+ * The cache is disabled unless the BB_VK_CACHE_DIR environment variable is set or set_directory() is called. The total
+ * size of the entries is limited to BB_VK_CACHE_MAX_MB megabytes (1024 by default), evicting the least recently used
+ * entries first.
+ */
+class VerificationKeyCache {
+  public:
+    struct Stats {
+        size_t hits = 0;
+        size_t misses = 0;
+        size_t evictions = 0;
+    };
+
+    static constexpr size_t DEFAULT_MAX_SIZE_BYTES = static_cast<size_t>(1024) << 20;
+
+    static VerificationKeyCache& get();
+
+    void set_directory(const std::filesystem::path& directory, size_t max_size_bytes = DEFAULT_MAX_SIZE_BYTES);
+    void disable();
+    bool enabled() const;
+
+    std::optional<std::vector<uint8_t>> load(const std::string& key);
+    void store(const std::string& key, const std::vector<uint8_t>& buffer);
+
+    Stats get_stats() const;
+
+  private:
+    VerificationKeyCache();
+
+    void evict_to_fit();
+
+    mutable std::mutex mutex;
+    std::filesystem::path directory;
+    size_t max_size_bytes = DEFAULT_MAX_SIZE_BYTES;
+    Stats stats;
+};
+
+/**
+ * @brief Hashes the structure of a circuit, i.e., the data that a verification key is computed from
+ * @details Large inputs are split in fixed-size chunks that are hashed in parallel, and the final digest is the SHA-256
+ * of the concatenation of the chunk digests. The chunking does not depend on the number of threads.
+ */
+class CircuitStructureHasher {
+  public:
+    void add(std::span<const uint8_t> bytes);
+    void add(uint64_t value);
+    void add(const std::string& value);
+
+    template <typename Polynomial> void add_polynomial(const Polynomial& polynomial)
+    {
+        add(static_cast<uint64_t>(polynomial.start_index()));
+        add(static_cast<uint64_t>(polynomial.size()));
+        add(static_cast<uint64_t>(polynomial.virtual_size()));
+        const auto coeffs = polynomial.coeffs();
+        add(std::span<const uint8_t>(reinterpret_cast<const uint8_t*>(coeffs.data()), coeffs.size_bytes()));
+    }
+
+    // Hex-encoded digest of everything added so far
+    std::string digest() const;
+
+  private:
+    std::vector<uint8_t> digests;
+};
+
+/**
+ * @brief Construct the verification key for a proving key, reusing a cached one when the circuit structure matches
+ * @details The cache key covers the flavor, the proving key metadata that ends up in the verification key and the
+ * contents of all the precomputed polynomials. When the cache is disabled, this is just the VerificationKey
+ * constructor.
+ */
+template <typename Flavor>
+std::shared_ptr<typename Flavor::VerificationKey> compute_verification_key_cached(
+    typename Flavor::ProvingKey& proving_key)
+{
+    using VerificationKey = typename Flavor::VerificationKey;
+
+    auto& cache = VerificationKeyCache::get();
+    if (!cache.enabled()) {
+        return std::make_shared<VerificationKey>(proving_key);
+    }
+
+    CircuitStructureHasher hasher;
+    hasher.add(std::string(typeid(Flavor).name()));
+    hasher.add(static_cast<uint64_t>(proving_key.circuit_size));
+    hasher.add(static_cast<uint64_t>(proving_key.num_public_inputs));
+    hasher.add(static_cast<uint64_t>(proving_key.pub_inputs_offset));
+    hasher.add(static_cast<uint64_t>(proving_key.pairing_inputs_public_input_key.start_idx));
+    if constexpr (requires { proving_key.ipa_claim_public_input_key; }) {
+        hasher.add(static_cast<uint64_t>(proving_key.ipa_claim_public_input_key.start_idx));
+    }
+    if constexpr (requires { proving_key.databus_propagation_data; }) {
+        const auto& databus_data = proving_key.databus_propagation_data;
+        hasher.add(static_cast<uint64_t>(databus_data.kernel_return_data_commitment_pub_input_key.start_idx));
+        hasher.add(static_cast<uint64_t>(databus_data.app_return_data_commitment_pub_input_key.start_idx));
+        hasher.add(static_cast<uint64_t>(databus_data.is_kernel));
+    }
+    for (const auto& polynomial : proving_key.polynomials.get_precomputed()) {
+        hasher.add_polynomial(polynomial);
+    }
+    const std::string key = hasher.digest();
+
+    if (auto buffer = cache.load(key)) {
+        return std::make_shared<VerificationKey>(from_buffer<VerificationKey>(*buffer));
+    }
+    auto verification_key = std::make_shared<VerificationKey>(proving_key);
+    cache.store(key, to_buffer(*verification_key));
+    return verification_key;
+}
+
+} // namespace bb
@@ -241,6 +241,73 @@ void fft_bench_serial(State& state) noexcept
 }
 BENCHMARK(fft_bench_serial)->RangeMultiplier(2)->Range(START * 4, MAX_GATES * 4)->Unit(benchmark::kMicrosecond);
 
+// The FFTs below run on their own data and domains, of sizes 2^12 to 2^24
+std::vector<fr> random_coefficients(const size_t n)
+{
+    std::vector<fr> coeffs(n);
+    fr T0 = fr::random_element();
+    fr acc = T0;
+    for (auto& coeff : coeffs) {
+        acc *= T0;
+        coeff = acc;
+    }
+    return coeffs;
+}
+
+void fft_bench(State& state) noexcept
+{
+    const size_t n = 1UL << static_cast<size_t>(state.range(0));
+    bb::evaluation_domain domain(n);
+    domain.compute_lookup_table();
+    std::vector<fr> coeffs = random_coefficients(n);
+    for (auto _ : state) {
+        bb::polynomial_arithmetic::fft(coeffs.data(), domain);
+    }
+}
+BENCHMARK(fft_bench)->DenseRange(12, 24)->Unit(benchmark::kMicrosecond);
+
+void radix_2_serial_fft_bench(State& state) noexcept
+{
+    const size_t n = 1UL << static_cast<size_t>(state.range(0));
+    bb::evaluation_domain domain(n);
+    domain.compute_lookup_table();
+    std::vector<fr> coeffs = random_coefficients(n);
+    for (auto _ : state) {
+        bb::polynomial_arithmetic::fft_inner_serial({ coeffs.data() }, n, domain.get_round_roots());
+    }
+}
+BENCHMARK(radix_2_serial_fft_bench)->DenseRange(12, 24)->Unit(benchmark::kMicrosecond);
+
+void coset_fft_bench(State& state) noexcept
+{
+    const size_t n = 1UL << static_cast<size_t>(state.range(0));
+    bb::evaluation_domain domain(n);
+    domain.compute_lookup_table();
+    std::vector<fr> coeffs = random_coefficients(n);
+    for (auto _ : state) {
+        bb::polynomial_arithmetic::coset_fft(coeffs.data(), domain);
+    }
+}
+BENCHMARK(coset_fft_bench)->DenseRange(12, 24)->Unit(benchmark::kMicrosecond);
+
+void batch_fft_bench(State& state) noexcept
+{
+    constexpr size_t NUM_POLYS = 8;
+    const size_t n = 1UL << static_cast<size_t>(state.range(0));
+    bb::evaluation_domain domain(n);
+    domain.compute_lookup_table();
+    std::vector<std::vector<fr>> polys;
+    std::vector<fr*> poly_ptrs;
+    for (size_t i = 0; i < NUM_POLYS; ++i) {
+        polys.emplace_back(random_coefficients(n));
+        poly_ptrs.emplace_back(polys.back().data());
+    }
+    for (auto _ : state) {
+        bb::polynomial_arithmetic::batch_fft(poly_ptrs, domain);
+    }
+}
+BENCHMARK(batch_fft_bench)->DenseRange(12, 20)->Unit(benchmark::kMicrosecond);
+
 void pairing_bench(State& state) noexcept
 {
     uint64_t count = 0;
@@ -174,6 +174,231 @@ void compute_multiplicative_subgroup(const size_t log2_subgroup_size,
     }
 }
 
+namespace {
+
+// The first rounds of the FFT only combine elements that are close to each other. They are run block by block, so that
+// a block stays in cache for all of them instead of the whole polynomial being streamed through memory once per round.
+// 2^10 bn254 scalars are 32KiB.
+constexpr size_t FFT_LOG2_BLOCK_SIZE = 10;
+
+// Polynomials of up to this size are transformed one per thread by the batch_* functions
+constexpr size_t FFT_LOG2_MAX_BATCHED_PER_THREAD_SIZE = 16;
+
+template <typename Func> void fft_for_each_thread(const size_t num_threads, const Func& func)
+{
+    if (num_threads == 1) {
+        func(0);
+    } else {
+        parallel_for(num_threads, func);
+    }
+}
+
+/**
+ * @brief Two consecutive radix-2 rounds, of half sizes m and 2m, fused into a radix-4 butterfly
+ * @details (x0, x1, x2, x3) are the elements j, j + m, j + 2m, j + 3m of a group of 4m elements. `root` is the root of
+ * the first round for j, `root_lo` and `root_hi` those of the second round for j and j + m.
+ */
+template <typename Fr>
+inline void radix_4_butterfly(Fr& x0, Fr& x1, Fr& x2, Fr& x3, const Fr& root, const Fr& root_lo, const Fr& root_hi)
+{
+    Fr temp = root * x1;
+    x1 = x0 - temp;
+    x0 += temp;
+    temp = root * x3;
+    x3 = x2 - temp;
+    x2 += temp;
+    temp = root_lo * x2;
+    x2 = x0 - temp;
+    x0 += temp;
+    temp = root_hi * x3;
+    x3 = x1 - temp;
+    x1 += temp;
+}
+
+/**
+ * @brief Apply the rounds of half sizes 2^log2_m and 2^(log2_m + 1) to the radix-4 butterflies [start, end) of `work`
+ * @details As in the radix-2 rounds, butterfly i is element (i & (m - 1)) of group (i >> log2_m), so that consecutive
+ * butterflies read consecutive roots and consecutive elements. The results are written back to `work`, or to `dest`
+ * if one is given.
+ */
+template <typename Fr, typename Dest = std::nullptr_t>
+void fft_radix_4_round(Fr* work,
+                       const size_t log2_m,
+                       const size_t start,
+                       const size_t end,
+                       const std::vector<Fr*>& root_table,
+                       const Dest& dest = nullptr)
+{
+    const size_t m = 1UL << log2_m;
+    const size_t block_mask = m - 1;
+    const Fr* round_roots = root_table[log2_m - 1];
+    const Fr* next_round_roots = root_table[log2_m];
+    for (size_t i = start; i < end; ++i) {
+        const size_t j = i & block_mask;
+        const size_t k = ((i & ~block_mask) << 2) + j;
+        radix_4_butterfly(work[k],
+                          work[k + m],
+                          work[k + 2 * m],
+                          work[k + 3 * m],
+                          round_roots[j],
+                          next_round_roots[j],
+                          next_round_roots[j + m]);
+        if constexpr (!std::is_same_v<Dest, std::nullptr_t>) {
+            dest(k) = work[k];
+            dest(k + m) = work[k + m];
+            dest(k + 2 * m) = work[k + 2 * m];
+            dest(k + 3 * m) = work[k + 3 * m];
+        }
+    }
+}
+
+// Radix-2 version of fft_radix_4_round, used for the last round when the number of rounds is odd
+template <typename Fr, typename Dest = std::nullptr_t>
+void fft_radix_2_round(Fr* work,
+                       const size_t log2_m,
+                       const size_t start,
+                       const size_t end,
+                       const std::vector<Fr*>& root_table,
+                       const Dest& dest = nullptr)
+{
+    const size_t m = 1UL << log2_m;
+    const size_t block_mask = m - 1;
+    const Fr* round_roots = root_table[log2_m - 1];
+    for (size_t i = start; i < end; ++i) {
+        const size_t j = i & block_mask;
+        const size_t k = ((i & ~block_mask) << 1) + j;
+        const Fr temp = round_roots[j] * work[k + m];
+        if constexpr (std::is_same_v<Dest, std::nullptr_t>) {
+            work[k + m] = work[k] - temp;
+            work[k] += temp;
+        } else {
+            dest(k + m) = work[k] - temp;
+            dest(k) = work[k] + temp;
+        }
+    }
+}
+
+/**
+ * @brief Blocked radix-4 FFT of size 2^log2_size, reading the input with `source(i)` and writing the output with
+ * `dest(i)`, using `work` (of the same size) as scratch space
+ * @details The bit-reversal permutation is fused with the first two rounds: every group of 4 outputs reads the 4 inputs
+ * at bit-reversed positions r, r + n/2, r + n/4 and r + 3n/4. Then, each thread takes blocks of 2^FFT_LOG2_BLOCK_SIZE
+ * elements through all the rounds that stay within a block, before the remaining rounds are run over the whole domain,
+ * two at a time. The last round writes to `dest`.
+ *
+ * `dest` may refer to `work`, `source` may not.
+ */
+template <typename Fr, typename Source, typename Dest>
+void fft_inner_blocked(const Source& source,
+                       Fr* work,
+                       const Dest& dest,
+                       const size_t log2_size,
+                       const std::vector<Fr*>& root_table,
+                       const size_t num_threads)
+{
+    const size_t size = 1UL << log2_size;
+    if (log2_size < 2) {
+        if (size == 1) {
+            dest(0) = source(0);
+        } else {
+            const Fr x0 = source(0);
+            const Fr x1 = source(1);
+            dest(0) = x0 + x1;
+            dest(1) = x0 - x1;
+        }
+        return;
+    }
+
+    const size_t log2_block_size = std::min(log2_size, FFT_LOG2_BLOCK_SIZE);
+    const size_t block_size = 1UL << log2_block_size;
+    const size_t num_blocks = size >> log2_block_size;
+    const size_t num_block_threads = std::min(num_threads, num_blocks);
+    const size_t blocks_per_thread = num_blocks / num_block_threads;
+    const Fr& fourth_root = root_table[0][1];
+
+    fft_for_each_thread(num_block_threads, [&](size_t thread_idx) {
+        for (size_t block = thread_idx * blocks_per_thread; block < (thread_idx + 1) * blocks_per_thread; ++block) {
+            const size_t block_start = block << log2_block_size;
+            for (size_t i = block_start; i < block_start + block_size; i += 4) {
+                const size_t r = reverse_bits(static_cast<uint32_t>(i), static_cast<uint32_t>(log2_size));
+                const Fr& x0 = source(r);
+                const Fr& x1 = source(r + (size >> 1));
+                const Fr& x2 = source(r + (size >> 2));
+                const Fr& x3 = source(r + 3 * (size >> 2));
+                // The roots of the first round are all 1, those of the second round 1 and the 4th root of unity
+                const Fr y0 = x0 + x1;
+                const Fr y1 = x0 - x1;
+                const Fr y2 = x2 + x3;
+                const Fr temp = fourth_root * (x2 - x3);
+                work[i] = y0 + y2;
+                work[i + 2] = y0 - y2;
+                work[i + 1] = y1 + temp;
+                work[i + 3] = y1 - temp;
+            }
+            size_t log2_m = 2;
+            while (log2_m < log2_block_size) {
+                if (log2_m + 1 < log2_block_size) {
+                    fft_radix_4_round(work, log2_m, block_start >> 2, (block_start + block_size) >> 2, root_table);
+                    log2_m += 2;
+                } else {
+                    fft_radix_2_round(work, log2_m, block_start >> 1, (block_start + block_size) >> 1, root_table);
+                    log2_m += 1;
+                }
+            }
+        }
+    });
+
+    const bool dest_is_work = &dest(0) == work;
+    size_t log2_m = log2_block_size;
+    while (log2_m < log2_size) {
+        const bool use_radix_4 = log2_m + 1 < log2_size;
+        const bool is_last_round = log2_m + (use_radix_4 ? 2 : 1) == log2_size;
+        const size_t num_butterflies = size >> (use_radix_4 ? 2 : 1);
+        const size_t num_round_threads = std::min(num_threads, num_butterflies);
+        const size_t butterflies_per_thread = num_butterflies / num_round_threads;
+        fft_for_each_thread(num_round_threads, [&](size_t thread_idx) {
+            const size_t start = thread_idx * butterflies_per_thread;
+            const size_t end = start + butterflies_per_thread;
+            if (is_last_round && !dest_is_work) {
+                if (use_radix_4) {
+                    fft_radix_4_round(work, log2_m, start, end, root_table, dest);
+                } else {
+                    fft_radix_2_round(work, log2_m, start, end, root_table, dest);
+                }
+            } else if (use_radix_4) {
+                fft_radix_4_round(work, log2_m, start, end, root_table);
+            } else {
+                fft_radix_2_round(work, log2_m, start, end, root_table);
+            }
+        });
+        log2_m += use_radix_4 ? 2 : 1;
+    }
+
+    // Every round stayed within the block, the result is still in `work`
+    if (log2_block_size == log2_size && !dest_is_work) {
+        fft_for_each_thread(num_block_threads, [&](size_t thread_idx) {
+            const size_t start = thread_idx * (size / num_block_threads);
+            const size_t end = start + (size / num_block_threads);
+            for (size_t i = start; i < end; ++i) {
+                dest(i) = work[i];
+            }
+        });
+    }
+}
+
+// Multiply the coefficients by start * shift^i
+template <typename Fr>
+void scale_by_powers_serial(Fr* coeffs, const size_t size, const Fr& start, const Fr& shift)
+{
+    Fr work_shift = start;
+    for (size_t i = 0; i < size; ++i) {
+        coeffs[i] *= work_shift;
+        work_shift *= shift;
+    }
+}
+
+} // namespace
+
 template <typename Fr>
     requires SupportsFFT<Fr>
 void fft_inner_parallel(std::vector<Fr*> coeffs,
@@ -191,115 +416,9 @@ void fft_inner_parallel(std::vector<Fr*> coeffs,
     const size_t poly_mask = poly_size - 1;
     const size_t log2_poly_size = (size_t)numeric::get_msb(poly_size);
 
-    parallel_for(domain.num_threads, [&](size_t j) {
-        Fr temp_1;
-        Fr temp_2;
-        for (size_t i = (j * domain.thread_size); i < ((j + 1) * domain.thread_size); i += 2) {
-            uint32_t next_index_1 = (uint32_t)reverse_bits((uint32_t)i + 2, (uint32_t)domain.log2_size);
-            uint32_t next_index_2 = (uint32_t)reverse_bits((uint32_t)i + 3, (uint32_t)domain.log2_size);
-            __builtin_prefetch(&coeffs[next_index_1]);
-            __builtin_prefetch(&coeffs[next_index_2]);
-
-            uint32_t swap_index_1 = (uint32_t)reverse_bits((uint32_t)i, (uint32_t)domain.log2_size);
-            uint32_t swap_index_2 = (uint32_t)reverse_bits((uint32_t)i + 1, (uint32_t)domain.log2_size);
-
-            size_t poly_idx_1 = swap_index_1 >> log2_poly_size;
-            size_t elem_idx_1 = swap_index_1 & poly_mask;
-            size_t poly_idx_2 = swap_index_2 >> log2_poly_size;
-            size_t elem_idx_2 = swap_index_2 & poly_mask;
-
-            Fr::__copy(coeffs[poly_idx_1][elem_idx_1], temp_1);
-            Fr::__copy(coeffs[poly_idx_2][elem_idx_2], temp_2);
-            scratch_space[i + 1] = temp_1 - temp_2;
-            scratch_space[i] = temp_1 + temp_2;
-        }
-    });
-
-    // hard code exception for when the domain size is tiny - we won't execute the next loop, so need to manually
-    // reduce + copy
-    if (domain.size <= 2) {
-        coeffs[0][0] = scratch_space[0];
-        coeffs[0][1] = scratch_space[1];
-    }
-
-    // outer FFT loop
-    for (size_t m = 2; m < (domain.size); m <<= 1) {
-        parallel_for(domain.num_threads, [&](size_t j) {
-            Fr temp;
-
-            // Ok! So, what's going on here? This is the inner loop of the FFT algorithm, and we want to break it
-            // out into multiple independent threads. For `num_threads`, each thread will evaluation `domain.size /
-            // num_threads` of the polynomial. The actual iteration length will be half of this, because we leverage
-            // the fact that \omega^{n/2} = -\omega (where \omega is a root of unity)
-
-            // Here, `start` and `end` are used as our iterator limits, so that we can use our iterator `i` to
-            // directly access the roots of unity lookup table
-            const size_t start = j * (domain.thread_size >> 1);
-            const size_t end = (j + 1) * (domain.thread_size >> 1);
-
-            // For all but the last round of our FFT, the roots of unity that we need, will be a subset of our
-            // lookup table. e.g. for a size 2^n FFT, the 2^n'th roots create a multiplicative subgroup of order 2^n
-            //      the 1st round will use the roots from the multiplicative subgroup of order 2 : the 2'th roots of
-            //      unity the 2nd round will use the roots from the multiplicative subgroup of order 4 : the 4'th
-            //      roots of unity
-            // i.e. each successive FFT round will double the set of roots that we need to index.
-            // We have already laid out the `root_table` container so that each FFT round's roots are linearly
-            // ordered in memory. For all FFT rounds, the number of elements we're iterating over is greater than
-            // the size of our lookup table. We need to access this table in a cyclical fasion - i.e. for a subgroup
-            // of size x, the first x iterations will index the subgroup elements in order, then for the next x
-            // iterations, we loop back to the start.
-
-            // We could implement the algorithm by having 2 nested loops (where the inner loop iterates over the
-            // root table), but we want to flatten this out - as for the first few rounds, the inner loop will be
-            // tiny and we'll have quite a bit of unneccesary branch checks For each iteration of our flattened
-            // loop, indexed by `i`, the element of the root table we need to access will be `i % (current round
-            // subgroup size)` Given that each round subgroup size is `m`, which is a power of 2, we can index the
-            // root table with a very cheap `i & (m - 1)` Which is why we have this odd `block_mask` variable
-            const size_t block_mask = m - 1;
-
-            // The next problem to tackle, is we now need to efficiently index the polynomial element in
-            // `scratch_space` in our flattened loop If we used nested loops, the outer loop (e.g. `y`) iterates
-            // from 0 to 'domain size', in steps of 2 * m, with the inner loop (e.g. `z`) iterating from 0 to m. We
-            // have our inner loop indexer with `i & (m - 1)`. We need to add to this our outer loop indexer, which
-            // is equivalent to taking our indexer `i`, masking out the bits used in the 'inner loop', and doubling
-            // the result. i.e. polynomial indexer = (i & (m - 1)) + ((i & ~(m - 1)) >> 1) To simplify this, we
-            // cache index_mask = ~block_mask, meaning that our indexer is just `((i & index_mask) << 1 + (i &
-            // block_mask)`
-            const size_t index_mask = ~block_mask;
-
-            // `round_roots` fetches the pointer to this round's lookup table. We use `numeric::get_msb(m) - 1` as
-            // our indexer, because we don't store the precomputed root values for the 1st round (because they're
-            // all 1).
-            const Fr* round_roots = root_table[static_cast<size_t>(numeric::get_msb(m)) - 1];
-
-            // Finally, we want to treat the final round differently from the others,
-            // so that we can reduce out of our 'coarse' reduction and store the output in `coeffs` instead of
-            // `scratch_space`
-            if (m != (domain.size >> 1)) {
-                for (size_t i = start; i < end; ++i) {
-                    size_t k1 = (i & index_mask) << 1;
-                    size_t j1 = i & block_mask;
-                    temp = round_roots[j1] * scratch_space[k1 + j1 + m];
-                    scratch_space[k1 + j1 + m] = scratch_space[k1 + j1] - temp;
-                    scratch_space[k1 + j1] += temp;
-                }
-            } else {
-                for (size_t i = start; i < end; ++i) {
-                    size_t k1 = (i & index_mask) << 1;
-                    size_t j1 = i & block_mask;
-
-                    size_t poly_idx_1 = (k1 + j1) >> log2_poly_size;
-                    size_t elem_idx_1 = (k1 + j1) & poly_mask;
-                    size_t poly_idx_2 = (k1 + j1 + m) >> log2_poly_size;
-                    size_t elem_idx_2 = (k1 + j1 + m) & poly_mask;
-
-                    temp = round_roots[j1] * scratch_space[k1 + j1 + m];
-                    coeffs[poly_idx_2][elem_idx_2] = scratch_space[k1 + j1] - temp;
-                    coeffs[poly_idx_1][elem_idx_1] = scratch_space[k1 + j1] + temp;
-                }
-            }
-        });
-    }
+    // The polynomials are the consecutive chunks of a single polynomial of size domain.size
+    const auto element = [&](size_t i) -> Fr& { return coeffs[i >> log2_poly_size][i & poly_mask]; };
+    fft_inner_blocked(element, scratch_space, element, domain.log2_size, root_table, domain.num_threads);
 }
 
 template <typename Fr>
@@ -307,93 +426,55 @@ template <typename Fr>
 void fft_inner_parallel(
     Fr* coeffs, Fr* target, const EvaluationDomain<Fr>& domain, const Fr&, const std::vector<Fr*>& root_table)
 {
-    parallel_for(domain.num_threads, [&](size_t j) {
-        Fr temp_1;
-        Fr temp_2;
-        for (size_t i = (j * domain.thread_size); i < ((j + 1) * domain.thread_size); i += 2) {
-            uint32_t next_index_1 = (uint32_t)reverse_bits((uint32_t)i + 2, (uint32_t)domain.log2_size);
-            uint32_t next_index_2 = (uint32_t)reverse_bits((uint32_t)i + 3, (uint32_t)domain.log2_size);
-            __builtin_prefetch(&coeffs[next_index_1]);
-            __builtin_prefetch(&coeffs[next_index_2]);
-
-            uint32_t swap_index_1 = (uint32_t)reverse_bits((uint32_t)i, (uint32_t)domain.log2_size);
-            uint32_t swap_index_2 = (uint32_t)reverse_bits((uint32_t)i + 1, (uint32_t)domain.log2_size);
-
-            Fr::__copy(coeffs[swap_index_1], temp_1);
-            Fr::__copy(coeffs[swap_index_2], temp_2);
-            target[i + 1] = temp_1 - temp_2;
-            target[i] = temp_1 + temp_2;
-        }
-    });
+    const auto source = [coeffs](size_t i) -> Fr& { return coeffs[i]; };
+    const auto dest = [target](size_t i) -> Fr& { return target[i]; };
+    fft_inner_blocked(source, target, dest, domain.log2_size, root_table, domain.num_threads);
+}
 
-    // hard code exception for when the domain size is tiny - we won't execute the next loop, so need to manually
-    // reduce + copy
-    if (domain.size <= 2) {
-        coeffs[0] = target[0];
-        coeffs[1] = target[1];
-    }
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void batch_fft_inner(const std::vector<Fr*>& polys,
+                     const EvaluationDomain<Fr>& domain,
+                     const std::vector<Fr*>& root_table,
+                     const bool is_coset,
+                     const bool is_inverse)
+{
+    // Forward coset FFTs scale the coefficients by g^i beforehand, inverse FFTs scale the result by n^{-1} (g^{-i})
+    const auto transform = [&](Fr* poly, Fr* work, size_t num_threads) {
+        if (is_coset && !is_inverse) {
+            if (num_threads == 1) {
+                scale_by_powers_serial(poly, domain.size, Fr::one(), domain.generator);
+            } else {
+                scale_by_generator(poly, poly, domain, Fr::one(), domain.generator, domain.size);
+            }
+        }
+        const auto element = [poly](size_t i) -> Fr& { return poly[i]; };
+        fft_inner_blocked(element, work, element, domain.log2_size, root_table, num_threads);
+        if (is_inverse) {
+            const Fr shift = is_coset ? domain.generator_inverse : Fr::one();
+            if (num_threads == 1) {
+                scale_by_powers_serial(poly, domain.size, domain.domain_inverse, shift);
+            } else {
+                scale_by_generator(poly, poly, domain, domain.domain_inverse, shift, domain.size);
+            }
+        }
+    };
 
-    // outer FFT loop
-    for (size_t m = 2; m < (domain.size); m <<= 1) {
-        parallel_for(domain.num_threads, [&](size_t j) {
-            Fr temp;
-
-            // Ok! So, what's going on here? This is the inner loop of the FFT algorithm, and we want to break it
-            // out into multiple independent threads. For `num_threads`, each thread will evaluation `domain.size /
-            // num_threads` of the polynomial. The actual iteration length will be half of this, because we leverage
-            // the fact that \omega^{n/2} = -\omega (where \omega is a root of unity)
-
-            // Here, `start` and `end` are used as our iterator limits, so that we can use our iterator `i` to
-            // directly access the roots of unity lookup table
-            const size_t start = j * (domain.thread_size >> 1);
-            const size_t end = (j + 1) * (domain.thread_size >> 1);
-
-            // For all but the last round of our FFT, the roots of unity that we need, will be a subset of our
-            // lookup table. e.g. for a size 2^n FFT, the 2^n'th roots create a multiplicative subgroup of order 2^n
-            //      the 1st round will use the roots from the multiplicative subgroup of order 2 : the 2'th roots of
-            //      unity the 2nd round will use the roots from the multiplicative subgroup of order 4 : the 4'th
-            //      roots of unity
-            // i.e. each successive FFT round will double the set of roots that we need to index.
-            // We have already laid out the `root_table` container so that each FFT round's roots are linearly
-            // ordered in memory. For all FFT rounds, the number of elements we're iterating over is greater than
-            // the size of our lookup table. We need to access this table in a cyclical fasion - i.e. for a subgroup
-            // of size x, the first x iterations will index the subgroup elements in order, then for the next x
-            // iterations, we loop back to the start.
-
-            // We could implement the algorithm by having 2 nested loops (where the inner loop iterates over the
-            // root table), but we want to flatten this out - as for the first few rounds, the inner loop will be
-            // tiny and we'll have quite a bit of unneccesary branch checks For each iteration of our flattened
-            // loop, indexed by `i`, the element of the root table we need to access will be `i % (current round
-            // subgroup size)` Given that each round subgroup size is `m`, which is a power of 2, we can index the
-            // root table with a very cheap `i & (m - 1)` Which is why we have this odd `block_mask` variable
-            const size_t block_mask = m - 1;
-
-            // The next problem to tackle, is we now need to efficiently index the polynomial element in
-            // `scratch_space` in our flattened loop If we used nested loops, the outer loop (e.g. `y`) iterates
-            // from 0 to 'domain size', in steps of 2 * m, with the inner loop (e.g. `z`) iterating from 0 to m. We
-            // have our inner loop indexer with `i & (m - 1)`. We need to add to this our outer loop indexer, which
-            // is equivalent to taking our indexer `i`, masking out the bits used in the 'inner loop', and doubling
-            // the result. i.e. polynomial indexer = (i & (m - 1)) + ((i & ~(m - 1)) >> 1) To simplify this, we
-            // cache index_mask = ~block_mask, meaning that our indexer is just `((i & index_mask) << 1 + (i &
-            // block_mask)`
-            const size_t index_mask = ~block_mask;
-
-            // `round_roots` fetches the pointer to this round's lookup table. We use `numeric::get_msb(m) - 1` as
-            // our indexer, because we don't store the precomputed root values for the 1st round (because they're
-            // all 1).
-            const Fr* round_roots = root_table[static_cast<size_t>(numeric::get_msb(m)) - 1];
-
-            // Finally, we want to treat the final round differently from the others,
-            // so that we can reduce out of our 'coarse' reduction and store the output in `coeffs` instead of
-            // `scratch_space`
-            for (size_t i = start; i < end; ++i) {
-                size_t k1 = (i & index_mask) << 1;
-                size_t j1 = i & block_mask;
-                temp = round_roots[j1] * target[k1 + j1 + m];
-                target[k1 + j1 + m] = target[k1 + j1] - temp;
-                target[k1 + j1] += temp;
+    const size_t num_polys = polys.size();
+    if (num_polys > 1 && domain.log2_size <= FFT_LOG2_MAX_BATCHED_PER_THREAD_SIZE) {
+        // One polynomial per thread, each thread with its own scratch space
+        const size_t num_threads = std::min(num_polys, get_num_cpus());
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            std::vector<Fr> work(domain.size);
+            for (size_t i = thread_idx; i < num_polys; i += num_threads) {
+                transform(polys[i], work.data(), 1);
             }
         });
+    } else {
+        auto scratch_space_ptr = get_scratch_space<Fr>(domain.size);
+        for (Fr* poly : polys) {
+            transform(poly, scratch_space_ptr.get(), domain.num_threads);
+        }
     }
 }
 
@@ -544,7 +625,7 @@ template <typename Fr>
     requires SupportsFFT<Fr>
 void fft(std::vector<Fr*> coeffs, const EvaluationDomain<Fr>& domain)
 {
-    fft_inner_parallel<Fr>(coeffs, domain.size, domain.root, domain.get_round_roots());
+    fft_inner_parallel<Fr>(coeffs, domain, domain.root, domain.get_round_roots());
 }
 
 template <typename Fr>
@@ -608,7 +689,7 @@ template <typename Fr>
 void coset_fft(Fr* coeffs, Fr* target, const EvaluationDomain<Fr>& domain)
 {
     scale_by_generator(coeffs, target, domain, Fr::one(), domain.generator, domain.generator_size);
-    fft(coeffs, target, domain);
+    fft(target, domain);
 }
 
 template <typename Fr>
@@ -743,6 +824,34 @@ void coset_ifft(std::vector<Fr*> coeffs, const EvaluationDomain<Fr>& domain)
     }
 }
 
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void batch_fft(const std::vector<Fr*>& polys, const EvaluationDomain<Fr>& domain)
+{
+    batch_fft_inner(polys, domain, domain.get_round_roots(), /*is_coset=*/false, /*is_inverse=*/false);
+}
+
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void batch_ifft(const std::vector<Fr*>& polys, const EvaluationDomain<Fr>& domain)
+{
+    batch_fft_inner(polys, domain, domain.get_inverse_round_roots(), /*is_coset=*/false, /*is_inverse=*/true);
+}
+
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void batch_coset_fft(const std::vector<Fr*>& polys, const EvaluationDomain<Fr>& domain)
+{
+    batch_fft_inner(polys, domain, domain.get_round_roots(), /*is_coset=*/true, /*is_inverse=*/false);
+}
+
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void batch_coset_ifft(const std::vector<Fr*>& polys, const EvaluationDomain<Fr>& domain)
+{
+    batch_fft_inner(polys, domain, domain.get_inverse_round_roots(), /*is_coset=*/true, /*is_inverse=*/true);
+}
+
 template <typename Fr>
 void add(const Fr* a_coeffs, const Fr* b_coeffs, Fr* r_coeffs, const EvaluationDomain<Fr>& domain)
 {
@@ -1454,6 +1563,10 @@ template void ifft<fr>(std::vector<fr*>, const EvaluationDomain<fr>&);
 template void ifft_with_constant<fr>(fr*, const EvaluationDomain<fr>&, const fr&);
 template void coset_ifft<fr>(fr*, const EvaluationDomain<fr>&);
 template void coset_ifft<fr>(std::vector<fr*>, const EvaluationDomain<fr>&);
+template void batch_fft<fr>(const std::vector<fr*>&, const EvaluationDomain<fr>&);
+template void batch_ifft<fr>(const std::vector<fr*>&, const EvaluationDomain<fr>&);
+template void batch_coset_fft<fr>(const std::vector<fr*>&, const EvaluationDomain<fr>&);
+template void batch_coset_ifft<fr>(const std::vector<fr*>&, const EvaluationDomain<fr>&);
 template void partial_fft_serial_inner<fr>(fr*, fr*, const EvaluationDomain<fr>&, const std::vector<fr*>&);
 template void partial_fft_parellel_inner<fr>(fr*, const EvaluationDomain<fr>&, const std::vector<fr*>&, fr, bool);
 template void partial_fft_serial<fr>(fr*, fr*, const EvaluationDomain<fr>&);
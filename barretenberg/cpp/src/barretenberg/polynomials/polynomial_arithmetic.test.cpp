@@ -241,6 +241,84 @@ TEST(polynomials, split_polynomial_fft_coset_ifft_consistency)
     }
 }
 
+/**
+ * @brief The blocked radix-4 FFT matches the radix-2 serial FFT, for odd and even numbers of rounds and for domains
+ * smaller and larger than a block
+ */
+TEST(polynomials, fft_matches_serial_fft)
+{
+    for (size_t log2_n = 1; log2_n <= 13; ++log2_n) {
+        const size_t n = 1UL << log2_n;
+        auto domain = evaluation_domain(n);
+        domain.compute_lookup_table();
+
+        std::vector<fr> coeffs(n);
+        for (auto& coeff : coeffs) {
+            coeff = fr::random_element();
+        }
+        std::vector<fr> expected = coeffs;
+        polynomial_arithmetic::fft_inner_serial({ expected.data() }, n, domain.get_round_roots());
+
+        std::vector<fr> in_place = coeffs;
+        polynomial_arithmetic::fft(in_place.data(), domain);
+        EXPECT_EQ(in_place, expected);
+
+        std::vector<fr> target(n);
+        polynomial_arithmetic::fft(coeffs.data(), target.data(), domain);
+        EXPECT_EQ(target, expected);
+
+        if (n >= 4) {
+            std::vector<fr> split = coeffs;
+            const size_t chunk = n / 4;
+            polynomial_arithmetic::fft({ &split[0], &split[chunk], &split[2 * chunk], &split[3 * chunk] }, domain);
+            EXPECT_EQ(split, expected);
+        }
+    }
+}
+
+TEST(polynomials, batch_fft_consistency)
+{
+    constexpr size_t n = 256;
+    constexpr size_t num_polys = 5;
+    auto domain = evaluation_domain(n);
+    domain.compute_lookup_table();
+
+    std::vector<std::vector<fr>> polys(num_polys, std::vector<fr>(n));
+    for (auto& poly : polys) {
+        for (auto& coeff : poly) {
+            coeff = fr::random_element();
+        }
+    }
+    const auto original = polys;
+    std::vector<fr*> poly_ptrs;
+    for (auto& poly : polys) {
+        poly_ptrs.push_back(poly.data());
+    }
+
+    polynomial_arithmetic::batch_fft(poly_ptrs, domain);
+    for (size_t i = 0; i < num_polys; ++i) {
+        std::vector<fr> expected = original[i];
+        polynomial_arithmetic::fft(expected.data(), domain);
+        EXPECT_EQ(polys[i], expected);
+    }
+    polynomial_arithmetic::batch_ifft(poly_ptrs, domain);
+    EXPECT_EQ(polys, original);
+
+    polynomial_arithmetic::batch_coset_fft(poly_ptrs, domain);
+    for (size_t i = 0; i < num_polys; ++i) {
+        std::vector<fr> expected = original[i];
+        polynomial_arithmetic::coset_fft(expected.data(), domain);
+        EXPECT_EQ(polys[i], expected);
+
+        std::vector<fr> coeffs = original[i];
+        std::vector<fr> target(n);
+        polynomial_arithmetic::coset_fft(coeffs.data(), target.data(), domain);
+        EXPECT_EQ(target, expected);
+    }
+    polynomial_arithmetic::batch_coset_ifft(poly_ptrs, domain);
+    EXPECT_EQ(polys, original);
+}
+
 TEST(polynomials, fft_coset_ifft_cross_consistency)
 {
     constexpr size_t n = 2;
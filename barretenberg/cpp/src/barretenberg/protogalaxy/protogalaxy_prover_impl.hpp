@@ -161,6 +161,16 @@ void ProtogalaxyProver_<Flavor, NUM_KEYS>::update_target_sum_and_fold(
         acc_poly.add_scaled(key_poly, lagranges[1]);
     }
 
+    // The folded polynomials are nontrivial wherever either of the keys is active
+    if (accumulator->active_ranges.empty() || incoming->active_ranges.empty()) {
+        accumulator->active_ranges.clear();
+    } else {
+        accumulator->active_ranges.insert(
+            accumulator->active_ranges.end(), incoming->active_ranges.begin(), incoming->active_ranges.end());
+        accumulator->active_ranges =
+            ExecutionTraceUsageTracker::construct_union_of_ranges(accumulator->active_ranges);
+    }
+
     // Evaluate the combined batching  α_i univariate at challenge to obtain next α_i and send it to the
     // verifier, where i ∈ {0,...,NUM_SUBRELATIONS - 1}
     for (auto [folded_alpha, key_alpha] : zip_view(accumulator->alphas, alphas)) {
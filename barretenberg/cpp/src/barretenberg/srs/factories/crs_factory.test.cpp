@@ -100,3 +100,26 @@ TEST(CrsFactory, grumpkin)
     ASSERT_ANY_THROW(check_grumpkin_consistency(temp_crs_path, 1, /*allow_download=*/false));
     check_grumpkin_consistency(temp_crs_path, 1, /*allow_download=*/true);
 }
+
+TEST(CrsFactory, MappedFileMatchesReadFile)
+{
+    const fs::path path = "barretenberg_srs_test_mapped_file";
+    std::vector<uint8_t> contents(10000);
+    for (size_t i = 0; i < contents.size(); ++i) {
+        contents[i] = static_cast<uint8_t>(i * 7);
+    }
+    write_file(path, contents);
+
+    MappedFile whole(path);
+    EXPECT_EQ(std::vector<uint8_t>(whole.span().begin(), whole.span().end()), read_file(path));
+
+    // Only the requested prefix is viewed
+    MappedFile prefix(path, 100);
+    EXPECT_EQ(std::vector<uint8_t>(prefix.span().begin(), prefix.span().end()), read_file(path, 100));
+
+    // Moving keeps the view valid
+    MappedFile moved(std::move(whole));
+    EXPECT_EQ(std::vector<uint8_t>(moved.span().begin(), moved.span().end()), contents);
+
+    fs::remove(path);
+}
@@ -1,6 +1,7 @@
 #include "get_bn254_crs.hpp"
 #include "barretenberg/api/exec_pipe.hpp"
 #include "barretenberg/api/file_io.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/ecc/curves/bn254/g1.hpp"
 
 namespace {
@@ -45,11 +46,14 @@ std::vector<g1::affine_element> get_bn254_g1_data(const std::filesystem::path& p
 
     if (g1_downloaded_points >= num_points) {
         vinfo("using cached bn254 crs with num points ", std::to_string(g1_downloaded_points), " at ", g1_path);
-        auto data = read_file(g1_path, num_points * sizeof(g1::affine_element));
+        // The file is mapped rather than read, so the points are converted straight from the page cache.
+        MappedFile data(g1_path, num_points * sizeof(g1::affine_element));
         auto points = std::vector<g1::affine_element>(num_points);
-        for (size_t i = 0; i < num_points; ++i) {
-            points[i] = from_buffer<g1::affine_element>(data, i * sizeof(g1::affine_element));
-        }
+        parallel_for_range(num_points, [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i) {
+                points[i] = from_buffer<g1::affine_element>(data, i * sizeof(g1::affine_element));
+            }
+        });
         return points;
     }
 
@@ -1,6 +1,7 @@
 #include "get_grumpkin_crs.hpp"
 #include "barretenberg/api/exec_pipe.hpp"
 #include "barretenberg/api/file_io.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/common/try_catch_shim.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
@@ -35,11 +36,14 @@ std::vector<curve::Grumpkin::AffineElement> get_grumpkin_g1_data(const std::file
     size_t g1_downloaded_points = get_file_size(g1_path) / sizeof(curve::Grumpkin::AffineElement);
     if (g1_downloaded_points >= num_points) {
         vinfo("using cached grumpkin crs with num points ", g1_downloaded_points, " at: ", g1_path);
-        auto data = read_file(g1_path, num_points * sizeof(curve::Grumpkin::AffineElement));
+        MappedFile data(g1_path, num_points * sizeof(curve::Grumpkin::AffineElement));
         std::vector<curve::Grumpkin::AffineElement> points(num_points);
-        for (uint32_t i = 0; i < num_points; ++i) {
-            points[i] = from_buffer<curve::Grumpkin::AffineElement>(data, i * sizeof(curve::Grumpkin::AffineElement));
-        }
+        parallel_for_range(num_points, [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i) {
+                points[i] =
+                    from_buffer<curve::Grumpkin::AffineElement>(data, i * sizeof(curve::Grumpkin::AffineElement));
+            }
+        });
         if (points[0].on_curve()) {
             return points;
         }
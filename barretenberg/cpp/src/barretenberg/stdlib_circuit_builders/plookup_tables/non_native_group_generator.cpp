@@ -18,9 +18,12 @@ namespace bb::plookup::ecc_generator_tables {
  **/
 template <typename G1> void ecc_generator_table<G1>::init_generator_tables()
 {
-    if (init) {
-        return;
-    }
+    // Multitables are constructed lazily, so tables for the same curve may be requested from several threads
+    std::call_once(init_flag, compute_generator_tables);
+}
+
+template <typename G1> void ecc_generator_table<G1>::compute_generator_tables()
+{
     element base_point = G1::one;
 
     auto d2 = base_point.dbl();
@@ -76,7 +79,6 @@ template <typename G1> void ecc_generator_table<G1>::init_generator_tables()
         ecc_generator_table<G1>::generator_endo_xyprime_table[i] = std::make_pair<bb::fr, bb::fr>(
             bb::fr(uint256_t(point_table[i].x * beta)), bb::fr(uint256_t(point_table[i].y)));
     }
-    init = true;
 }
 
 // map 0 to 255 into 0 to 510 in steps of two
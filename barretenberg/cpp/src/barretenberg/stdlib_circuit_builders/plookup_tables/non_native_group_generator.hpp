@@ -11,6 +11,7 @@
 #include "barretenberg/ecc/curves/bn254/g1.hpp"
 #include "barretenberg/ecc/curves/secp256k1/secp256k1.hpp"
 #include <array>
+#include <mutex>
 
 namespace bb::plookup::ecc_generator_tables {
 
@@ -29,9 +30,10 @@ template <typename G1> class ecc_generator_table {
     inline static std::array<std::pair<fr, fr>, 256> generator_yhi_table;
     inline static std::array<std::pair<fr, fr>, 256> generator_xyprime_table;
     inline static std::array<std::pair<fr, fr>, 256> generator_endo_xyprime_table;
-    inline static bool init = false;
+    inline static std::once_flag init_flag;
 
     static void init_generator_tables();
+    static void compute_generator_tables();
 
     static size_t convert_position_to_shifted_naf(const size_t position);
     static size_t convert_shifted_naf_to_position(const size_t shifted_naf);
@@ -25,125 +25,122 @@ namespace bb::plookup {
 using namespace bb;
 
 namespace {
-// TODO(@zac-williamson) convert these into static const members of a struct
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 std::array<MultiTable, MultiTableId::NUM_MULTI_TABLES> MULTI_TABLES;
+// Each multitable is constructed the first time it is requested, by exactly one thread
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
-bool initialised = false;
-#ifndef NO_MULTITHREADING
+std::array<std::once_flag, MultiTableId::NUM_MULTI_TABLES> MULTI_TABLE_FLAGS;
 
-// The multitables initialisation procedure is not thread-safe, so we need to make sure only 1 thread gets to initialize
-// them.
-std::mutex multi_table_mutex;
-#endif
-void init_multi_tables()
+MultiTable create_multitable(const MultiTableId id)
 {
-#ifndef NO_MULTITHREADING
-    std::unique_lock<std::mutex> lock(multi_table_mutex);
-#endif
-    if (initialised) {
-        return;
-    }
-    MULTI_TABLES[MultiTableId::SHA256_CH_INPUT] = sha256_tables::get_choose_input_table(MultiTableId::SHA256_CH_INPUT);
-    MULTI_TABLES[MultiTableId::SHA256_MAJ_INPUT] =
-        sha256_tables::get_majority_input_table(MultiTableId::SHA256_MAJ_INPUT);
-    MULTI_TABLES[MultiTableId::SHA256_WITNESS_INPUT] =
-        sha256_tables::get_witness_extension_input_table(MultiTableId::SHA256_WITNESS_INPUT);
-    MULTI_TABLES[MultiTableId::SHA256_CH_OUTPUT] =
-        sha256_tables::get_choose_output_table(MultiTableId::SHA256_CH_OUTPUT);
-    MULTI_TABLES[MultiTableId::SHA256_MAJ_OUTPUT] =
-        sha256_tables::get_majority_output_table(MultiTableId::SHA256_MAJ_OUTPUT);
-    MULTI_TABLES[MultiTableId::SHA256_WITNESS_OUTPUT] =
-        sha256_tables::get_witness_extension_output_table(MultiTableId::SHA256_WITNESS_OUTPUT);
-    MULTI_TABLES[MultiTableId::AES_NORMALIZE] = aes128_tables::get_aes_normalization_table(MultiTableId::AES_NORMALIZE);
-    MULTI_TABLES[MultiTableId::AES_INPUT] = aes128_tables::get_aes_input_table(MultiTableId::AES_INPUT);
-    MULTI_TABLES[MultiTableId::AES_SBOX] = aes128_tables::get_aes_sbox_table(MultiTableId::AES_SBOX);
-    MULTI_TABLES[MultiTableId::UINT32_XOR] = uint_tables::get_uint32_xor_table(MultiTableId::UINT32_XOR);
-    MULTI_TABLES[MultiTableId::UINT32_AND] = uint_tables::get_uint32_and_table(MultiTableId::UINT32_AND);
-    MULTI_TABLES[MultiTableId::BN254_XLO] = ecc_generator_tables::ecc_generator_table<bb::g1>::get_xlo_table(
-        MultiTableId::BN254_XLO, BasicTableId::BN254_XLO_BASIC);
-    MULTI_TABLES[MultiTableId::BN254_XHI] = ecc_generator_tables::ecc_generator_table<bb::g1>::get_xhi_table(
-        MultiTableId::BN254_XHI, BasicTableId::BN254_XHI_BASIC);
-    MULTI_TABLES[MultiTableId::BN254_YLO] = ecc_generator_tables::ecc_generator_table<bb::g1>::get_ylo_table(
-        MultiTableId::BN254_YLO, BasicTableId::BN254_YLO_BASIC);
-    MULTI_TABLES[MultiTableId::BN254_YHI] = ecc_generator_tables::ecc_generator_table<bb::g1>::get_yhi_table(
-        MultiTableId::BN254_YHI, BasicTableId::BN254_YHI_BASIC);
-    MULTI_TABLES[MultiTableId::BN254_XYPRIME] = ecc_generator_tables::ecc_generator_table<bb::g1>::get_xyprime_table(
-        MultiTableId::BN254_XYPRIME, BasicTableId::BN254_XYPRIME_BASIC);
-    MULTI_TABLES[MultiTableId::BN254_XLO_ENDO] = ecc_generator_tables::ecc_generator_table<bb::g1>::get_xlo_endo_table(
-        MultiTableId::BN254_XLO_ENDO, BasicTableId::BN254_XLO_ENDO_BASIC);
-    MULTI_TABLES[MultiTableId::BN254_XHI_ENDO] = ecc_generator_tables::ecc_generator_table<bb::g1>::get_xhi_endo_table(
-        MultiTableId::BN254_XHI_ENDO, BasicTableId::BN254_XHI_ENDO_BASIC);
-    MULTI_TABLES[MultiTableId::BN254_XYPRIME_ENDO] =
-        ecc_generator_tables::ecc_generator_table<bb::g1>::get_xyprime_endo_table(
-            MultiTableId::BN254_XYPRIME_ENDO, BasicTableId::BN254_XYPRIME_ENDO_BASIC);
-    MULTI_TABLES[MultiTableId::SECP256K1_XLO] = ecc_generator_tables::ecc_generator_table<secp256k1::g1>::get_xlo_table(
-        MultiTableId::SECP256K1_XLO, BasicTableId::SECP256K1_XLO_BASIC);
-    MULTI_TABLES[MultiTableId::SECP256K1_XHI] = ecc_generator_tables::ecc_generator_table<secp256k1::g1>::get_xhi_table(
-        MultiTableId::SECP256K1_XHI, BasicTableId::SECP256K1_XHI_BASIC);
-    MULTI_TABLES[MultiTableId::SECP256K1_YLO] = ecc_generator_tables::ecc_generator_table<secp256k1::g1>::get_ylo_table(
-        MultiTableId::SECP256K1_YLO, BasicTableId::SECP256K1_YLO_BASIC);
-    MULTI_TABLES[MultiTableId::SECP256K1_YHI] = ecc_generator_tables::ecc_generator_table<secp256k1::g1>::get_yhi_table(
-        MultiTableId::SECP256K1_YHI, BasicTableId::SECP256K1_YHI_BASIC);
-    MULTI_TABLES[MultiTableId::SECP256K1_XYPRIME] =
-        ecc_generator_tables::ecc_generator_table<secp256k1::g1>::get_xyprime_table(
-            MultiTableId::SECP256K1_XYPRIME, BasicTableId::SECP256K1_XYPRIME_BASIC);
-    MULTI_TABLES[MultiTableId::SECP256K1_XLO_ENDO] =
-        ecc_generator_tables::ecc_generator_table<secp256k1::g1>::get_xlo_endo_table(
-            MultiTableId::SECP256K1_XLO_ENDO, BasicTableId::SECP256K1_XLO_ENDO_BASIC);
-    MULTI_TABLES[MultiTableId::SECP256K1_XHI_ENDO] =
-        ecc_generator_tables::ecc_generator_table<secp256k1::g1>::get_xhi_endo_table(
-            MultiTableId::SECP256K1_XHI_ENDO, BasicTableId::SECP256K1_XHI_ENDO_BASIC);
-    MULTI_TABLES[MultiTableId::SECP256K1_XYPRIME_ENDO] =
-        ecc_generator_tables::ecc_generator_table<secp256k1::g1>::get_xyprime_endo_table(
-            MultiTableId::SECP256K1_XYPRIME_ENDO, BasicTableId::SECP256K1_XYPRIME_ENDO_BASIC);
-    MULTI_TABLES[MultiTableId::BLAKE_XOR] = blake2s_tables::get_blake2s_xor_table(MultiTableId::BLAKE_XOR);
-    MULTI_TABLES[MultiTableId::BLAKE_XOR_ROTATE_16] =
-        blake2s_tables::get_blake2s_xor_rotate_16_table(MultiTableId::BLAKE_XOR_ROTATE_16);
-    MULTI_TABLES[MultiTableId::BLAKE_XOR_ROTATE_8] =
-        blake2s_tables::get_blake2s_xor_rotate_8_table(MultiTableId::BLAKE_XOR_ROTATE_8);
-    MULTI_TABLES[MultiTableId::BLAKE_XOR_ROTATE_7] =
-        blake2s_tables::get_blake2s_xor_rotate_7_table(MultiTableId::BLAKE_XOR_ROTATE_7);
-    MULTI_TABLES[MultiTableId::KECCAK_FORMAT_INPUT] =
-        keccak_tables::KeccakInput::get_keccak_input_table(MultiTableId::KECCAK_FORMAT_INPUT);
-    MULTI_TABLES[MultiTableId::KECCAK_THETA_OUTPUT] =
-        keccak_tables::Theta::get_theta_output_table(MultiTableId::KECCAK_THETA_OUTPUT);
-    MULTI_TABLES[MultiTableId::KECCAK_CHI_OUTPUT] =
-        keccak_tables::Chi::get_chi_output_table(MultiTableId::KECCAK_CHI_OUTPUT);
-    MULTI_TABLES[MultiTableId::KECCAK_FORMAT_OUTPUT] =
-        keccak_tables::KeccakOutput::get_keccak_output_table(MultiTableId::KECCAK_FORMAT_OUTPUT);
-    MULTI_TABLES[MultiTableId::FIXED_BASE_LEFT_LO] =
-        fixed_base::table::get_fixed_base_table<0, 128>(MultiTableId::FIXED_BASE_LEFT_LO);
-    MULTI_TABLES[MultiTableId::FIXED_BASE_LEFT_HI] =
-        fixed_base::table::get_fixed_base_table<1, 126>(MultiTableId::FIXED_BASE_LEFT_HI);
-    MULTI_TABLES[MultiTableId::FIXED_BASE_RIGHT_LO] =
-        fixed_base::table::get_fixed_base_table<2, 128>(MultiTableId::FIXED_BASE_RIGHT_LO);
-    MULTI_TABLES[MultiTableId::FIXED_BASE_RIGHT_HI] =
-        fixed_base::table::get_fixed_base_table<3, 126>(MultiTableId::FIXED_BASE_RIGHT_HI);
-
+    using Bn254Generators = ecc_generator_tables::ecc_generator_table<bb::g1>;
+    using Secp256k1Generators = ecc_generator_tables::ecc_generator_table<secp256k1::g1>;
+    switch (id) {
+    case MultiTableId::SHA256_CH_INPUT:
+        return sha256_tables::get_choose_input_table(id);
+    case MultiTableId::SHA256_MAJ_INPUT:
+        return sha256_tables::get_majority_input_table(id);
+    case MultiTableId::SHA256_WITNESS_INPUT:
+        return sha256_tables::get_witness_extension_input_table(id);
+    case MultiTableId::SHA256_CH_OUTPUT:
+        return sha256_tables::get_choose_output_table(id);
+    case MultiTableId::SHA256_MAJ_OUTPUT:
+        return sha256_tables::get_majority_output_table(id);
+    case MultiTableId::SHA256_WITNESS_OUTPUT:
+        return sha256_tables::get_witness_extension_output_table(id);
+    case MultiTableId::AES_NORMALIZE:
+        return aes128_tables::get_aes_normalization_table(id);
+    case MultiTableId::AES_INPUT:
+        return aes128_tables::get_aes_input_table(id);
+    case MultiTableId::AES_SBOX:
+        return aes128_tables::get_aes_sbox_table(id);
+    case MultiTableId::UINT32_XOR:
+        return uint_tables::get_uint32_xor_table(id);
+    case MultiTableId::UINT32_AND:
+        return uint_tables::get_uint32_and_table(id);
+    case MultiTableId::BN254_XLO:
+        return Bn254Generators::get_xlo_table(id, BasicTableId::BN254_XLO_BASIC);
+    case MultiTableId::BN254_XHI:
+        return Bn254Generators::get_xhi_table(id, BasicTableId::BN254_XHI_BASIC);
+    case MultiTableId::BN254_YLO:
+        return Bn254Generators::get_ylo_table(id, BasicTableId::BN254_YLO_BASIC);
+    case MultiTableId::BN254_YHI:
+        return Bn254Generators::get_yhi_table(id, BasicTableId::BN254_YHI_BASIC);
+    case MultiTableId::BN254_XYPRIME:
+        return Bn254Generators::get_xyprime_table(id, BasicTableId::BN254_XYPRIME_BASIC);
+    case MultiTableId::BN254_XLO_ENDO:
+        return Bn254Generators::get_xlo_endo_table(id, BasicTableId::BN254_XLO_ENDO_BASIC);
+    case MultiTableId::BN254_XHI_ENDO:
+        return Bn254Generators::get_xhi_endo_table(id, BasicTableId::BN254_XHI_ENDO_BASIC);
+    case MultiTableId::BN254_XYPRIME_ENDO:
+        return Bn254Generators::get_xyprime_endo_table(id, BasicTableId::BN254_XYPRIME_ENDO_BASIC);
+    case MultiTableId::SECP256K1_XLO:
+        return Secp256k1Generators::get_xlo_table(id, BasicTableId::SECP256K1_XLO_BASIC);
+    case MultiTableId::SECP256K1_XHI:
+        return Secp256k1Generators::get_xhi_table(id, BasicTableId::SECP256K1_XHI_BASIC);
+    case MultiTableId::SECP256K1_YLO:
+        return Secp256k1Generators::get_ylo_table(id, BasicTableId::SECP256K1_YLO_BASIC);
+    case MultiTableId::SECP256K1_YHI:
+        return Secp256k1Generators::get_yhi_table(id, BasicTableId::SECP256K1_YHI_BASIC);
+    case MultiTableId::SECP256K1_XYPRIME:
+        return Secp256k1Generators::get_xyprime_table(id, BasicTableId::SECP256K1_XYPRIME_BASIC);
+    case MultiTableId::SECP256K1_XLO_ENDO:
+        return Secp256k1Generators::get_xlo_endo_table(id, BasicTableId::SECP256K1_XLO_ENDO_BASIC);
+    case MultiTableId::SECP256K1_XHI_ENDO:
+        return Secp256k1Generators::get_xhi_endo_table(id, BasicTableId::SECP256K1_XHI_ENDO_BASIC);
+    case MultiTableId::SECP256K1_XYPRIME_ENDO:
+        return Secp256k1Generators::get_xyprime_endo_table(id, BasicTableId::SECP256K1_XYPRIME_ENDO_BASIC);
+    case MultiTableId::BLAKE_XOR:
+        return blake2s_tables::get_blake2s_xor_table(id);
+    case MultiTableId::BLAKE_XOR_ROTATE_16:
+        return blake2s_tables::get_blake2s_xor_rotate_16_table(id);
+    case MultiTableId::BLAKE_XOR_ROTATE_8:
+        return blake2s_tables::get_blake2s_xor_rotate_8_table(id);
+    case MultiTableId::BLAKE_XOR_ROTATE_7:
+        return blake2s_tables::get_blake2s_xor_rotate_7_table(id);
+    case MultiTableId::KECCAK_FORMAT_INPUT:
+        return keccak_tables::KeccakInput::get_keccak_input_table(id);
+    case MultiTableId::KECCAK_THETA_OUTPUT:
+        return keccak_tables::Theta::get_theta_output_table(id);
+    case MultiTableId::KECCAK_CHI_OUTPUT:
+        return keccak_tables::Chi::get_chi_output_table(id);
+    case MultiTableId::KECCAK_FORMAT_OUTPUT:
+        return keccak_tables::KeccakOutput::get_keccak_output_table(id);
+    case MultiTableId::FIXED_BASE_LEFT_LO:
+        return fixed_base::table::get_fixed_base_table<0, 128>(id);
+    case MultiTableId::FIXED_BASE_LEFT_HI:
+        return fixed_base::table::get_fixed_base_table<1, 126>(id);
+    case MultiTableId::FIXED_BASE_RIGHT_LO:
+        return fixed_base::table::get_fixed_base_table<2, 128>(id);
+    case MultiTableId::FIXED_BASE_RIGHT_HI:
+        return fixed_base::table::get_fixed_base_table<3, 126>(id);
+    case MultiTableId::HONK_DUMMY_MULTI:
+        return dummy_tables::get_honk_dummy_multitable();
+    default:
+        break;
+    }
+    // The remaining ids are the keccak rho tables, one per lane
+    MultiTable table;
     bb::constexpr_for<0, 25, 1>([&]<size_t i>() {
-        MULTI_TABLES[static_cast<size_t>(MultiTableId::KECCAK_NORMALIZE_AND_ROTATE) + i] =
-            keccak_tables::Rho<8, i>::get_rho_output_table(MultiTableId::KECCAK_NORMALIZE_AND_ROTATE);
+        if (static_cast<size_t>(id) == static_cast<size_t>(MultiTableId::KECCAK_NORMALIZE_AND_ROTATE) + i) {
+            table = keccak_tables::Rho<8, i>::get_rho_output_table(MultiTableId::KECCAK_NORMALIZE_AND_ROTATE);
+        }
     });
-    MULTI_TABLES[MultiTableId::HONK_DUMMY_MULTI] = dummy_tables::get_honk_dummy_multitable();
-    initialised = true;
+    return table;
 }
 } // namespace
 /**
- * @brief Return the multitable with the provided ID; construct all MultiTables if not constructed already
- * @details The multitables are relatively light objects (they do not themselves store raw table data) so the first time
- * we use one of them we simply construct all of them (regardless of which of them will actually be used) and store in
- * MULTI_TABLES array.
+ * @brief Return the multitable with the provided ID; construct it if not constructed already
+ * @details Multitables are constructed on first use, so a circuit only pays for the tables it uses. Construction is
+ * thread-safe, and a constructed multitable is never modified again, so references to it can be shared freely.
  *
  * @param id The index of a MultiTable in the MULTI_TABLES array
  * @return const MultiTable&
  */
 const MultiTable& get_multitable(const MultiTableId id)
 {
-    if (!initialised) {
-        init_multi_tables();
-        initialised = true;
-    }
+    ASSERT(static_cast<size_t>(id) < MultiTableId::NUM_MULTI_TABLES);
+    std::call_once(MULTI_TABLE_FLAGS[id], [id]() { MULTI_TABLES[id] = create_multitable(id); });
     return MULTI_TABLES[id];
 }
 
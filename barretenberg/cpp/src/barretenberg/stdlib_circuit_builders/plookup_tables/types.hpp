@@ -6,11 +6,13 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <vector>
 
 #include "./fixed_base/fixed_base_params.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include "barretenberg/numeric/bitop/get_msb.hpp"
 
 namespace bb::plookup {
 
@@ -282,8 +284,12 @@ struct MultiTable {
  * from each entry in a table) for the log-derivative lookup argument. A BasicTable essentially consists of 3 columns,
  * and 'lookups' are recorded as rows in this table. The index at which this data exists in the table is not explicitly
  * known at the time of lookup gate creation. This map can be used to construct read counts from the set of lookups that
- * have been performed via an operation like read_counts[index_map[lookup_data]]++
+ * have been performed via an operation like read_counts[index_map.find(lookup_data, ...)]++
  *
+ * Most tables enumerate their keys in order: column_1 = 0, 1, 2, ... or, for tables with two keys, (column_1, column_2)
+ * runs over a grid row by row. The index of an entry of such a table is computed directly from its keys. The rows of
+ * any other table are stored in an open-addressed hash table that holds only row indices. In both cases the entry is
+ * compared with the table row it resolves to, which is why the columns are passed to find().
  */
 struct LookupHashTable {
     using FF = bb::fr;
@@ -307,32 +313,102 @@ struct LookupHashTable {
         }
     };
 
-    std::unordered_map<Key, Value, HashFunction> index_map;
+    static constexpr uint32_t EMPTY_SLOT = UINT32_MAX;
+
+    // If non-zero, row i of the table has column_1 = i / grid_width and, if grid_width > 1, column_2 = i % grid_width
+    size_t grid_width = 0;
+    // Open-addressed hash table of row indices, used if the keys of the table do not form a grid
+    std::vector<uint32_t> slots;
 
     LookupHashTable() = default;
 
     // Initialize the entry-index map with the columns of a table
-    void initialize(std::vector<FF>& column_1, std::vector<FF>& column_2, std::vector<FF>& column_3)
+    void initialize(const std::vector<FF>& column_1, const std::vector<FF>& column_2, const std::vector<FF>& column_3)
     {
-        for (size_t i = 0; i < column_1.size(); ++i) {
-            index_map[{ column_1[i], column_2[i], column_3[i] }] = i;
+        const size_t num_rows = column_1.size();
+        grid_width = compute_grid_width(column_1, column_2);
+        slots.clear();
+        if (grid_width != 0) {
+            return;
+        }
+        ASSERT(num_rows < EMPTY_SLOT);
+        slots.resize(std::max(numeric::round_up_power_2(2 * num_rows), size_t(2)), EMPTY_SLOT);
+        const HashFunction hash;
+        const size_t mask = slots.size() - 1;
+        for (size_t i = 0; i < num_rows; ++i) {
+            const Key entry{ column_1[i], column_2[i], column_3[i] };
+            size_t slot = hash(entry) & mask;
+            // A repeated entry maps to its last row
+            while (slots[slot] != EMPTY_SLOT && !row_matches(entry, slots[slot], column_1, column_2, column_3)) {
+                slot = (slot + 1) & mask;
+            }
+            slots[slot] = static_cast<uint32_t>(i);
         }
     }
 
-    // Given an entry in the table, return its index in the table
-    Value operator[](const Key& key) const
+    // Given an entry in the table with the given columns, return its index in the table
+    Value find(const Key& key,
+               const std::vector<FF>& column_1,
+               const std::vector<FF>& column_2,
+               const std::vector<FF>& column_3) const
     {
-        auto it = index_map.find(key);
-        if (it != index_map.end()) {
-            return it->second;
-        } else {
-            info("LookupHashTable: Key not found!");
-            ASSERT(false);
-            return 0;
+        if (grid_width != 0) {
+            const uint256_t key_1(key[0]);
+            const uint256_t key_2(key[1]);
+            const size_t num_rows = column_1.size();
+            if (key_1 < num_rows / grid_width && (grid_width == 1 || key_2 < grid_width)) {
+                const size_t index = static_cast<size_t>(key_1.data[0]) * grid_width +
+                                     (grid_width == 1 ? 0 : static_cast<size_t>(key_2.data[0]));
+                if (row_matches(key, index, column_1, column_2, column_3)) {
+                    return index;
+                }
+            }
+        } else if (!slots.empty()) {
+            const size_t mask = slots.size() - 1;
+            for (size_t slot = HashFunction()(key) & mask; slots[slot] != EMPTY_SLOT; slot = (slot + 1) & mask) {
+                if (row_matches(key, slots[slot], column_1, column_2, column_3)) {
+                    return slots[slot];
+                }
+            }
         }
+        info("LookupHashTable: Key not found!");
+        ASSERT(false);
+        return 0;
     }
 
     bool operator==(const LookupHashTable& other) const = default;
+
+  private:
+    static bool row_matches(const Key& key,
+                            const size_t row,
+                            const std::vector<FF>& column_1,
+                            const std::vector<FF>& column_2,
+                            const std::vector<FF>& column_3)
+    {
+        return column_1[row] == key[0] && column_2[row] == key[1] && column_3[row] == key[2];
+    }
+
+    // The width of the grid formed by the keys of a table, or 0 if they do not form one
+    static size_t compute_grid_width(const std::vector<FF>& column_1, const std::vector<FF>& column_2)
+    {
+        const size_t num_rows = column_1.size();
+        if (num_rows == 0 || column_1[0] != 0) {
+            return 0;
+        }
+        size_t width = 1;
+        while (width < num_rows && column_1[width] == 0) {
+            ++width;
+        }
+        if (num_rows % width != 0) {
+            return 0;
+        }
+        for (size_t i = 0; i < num_rows; ++i) {
+            if (column_1[i] != FF(i / width) || (width > 1 && column_2[i] != FF(i % width))) {
+                return 0;
+            }
+        }
+        return width;
+    }
 };
 
 /**
@@ -382,6 +458,10 @@ struct BasicTable {
     LookupHashTable index_map;
 
     void initialize_index_map() { index_map.initialize(column_1, column_2, column_3); }
+    size_t get_index(const LookupHashTable::Key& entry) const
+    {
+        return index_map.find(entry, column_1, column_2, column_3);
+    }
 
     std::array<bb::fr, 2> (*get_values_from_key)(const std::array<uint64_t, 2>);
 
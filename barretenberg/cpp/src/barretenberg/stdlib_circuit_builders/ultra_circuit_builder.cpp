@@ -68,6 +68,186 @@ void UltraCircuitBuilder_<ExecutionTrace>::finalize_circuit(const bool ensure_no
     }
 }
 
+template <typename ExecutionTrace> bool UltraCircuitBuilder_<ExecutionTrace>::is_appendable_fragment() const
+{
+    // Mega circuits carry op queue and databus state that cannot be relocated
+    if constexpr (!std::same_as<ExecutionTrace, UltraExecutionTraceBlocks>) {
+        return false;
+    }
+    // The only tags in use must be the dummy tag and the pairs created by range lists
+    const bool only_range_tags = this->tau.size() == 1 + 2 * range_lists.size();
+    return this->public_inputs.empty() && rom_arrays.empty() && ram_arrays.empty() && memory_read_records.empty() &&
+           memory_write_records.empty() && cached_partial_non_native_field_multiplications.empty() &&
+           !circuit_finalized && only_range_tags;
+}
+
+/**
+ * @details Variables are relocated as follows: the leading fragment variables map to shared_variables, fragment
+ * constants map to the constant variable of this circuit with the same value (if there is one), and the dummy
+ * variables created by the range lists of the fragment are dropped together with the dummy gates that hold them, since
+ * this circuit creates its own range lists as needed. The gates fixing fragment constants that map to an existing
+ * constant of this circuit (e.g. the zero of every fragment) are dropped as well. Copy constraints are re-imposed with
+ * assert_equal before the range constraints are replayed, so a tag picked up by any member of an equivalence class
+ * applies to the whole class, exactly as when the constraints are created directly in this circuit.
+ */
+template <typename ExecutionTrace>
+void UltraCircuitBuilder_<ExecutionTrace>::append_fragment(const UltraCircuitBuilder_& fragment,
+                                                           std::span<const uint32_t> shared_variables)
+{
+    ASSERT(fragment.is_appendable_fragment() && !circuit_finalized);
+    ASSERT(shared_variables.size() <= fragment.get_num_variables());
+    if (fragment.failed() && !this->failed()) {
+        this->failure(fragment.err());
+    }
+
+    static constexpr uint32_t DROPPED = UINT32_MAX;
+    const size_t num_fragment_variables = fragment.get_num_variables();
+    std::vector<uint32_t> relocated(num_fragment_variables, DROPPED);
+    std::copy(shared_variables.begin(), shared_variables.end(), relocated.begin());
+
+    // Visit range lists in order of target range so that the result does not depend on the hash map layout
+    std::vector<const RangeList*> fragment_range_lists;
+    fragment_range_lists.reserve(fragment.range_lists.size());
+    for (const auto& [target_range, list] : fragment.range_lists) {
+        fragment_range_lists.emplace_back(&list);
+    }
+    std::sort(fragment_range_lists.begin(), fragment_range_lists.end(), [](const auto* a, const auto* b) {
+        return a->target_range < b->target_range;
+    });
+    // The first entries of a range list are the dummy variables added by create_range_list
+    const auto num_range_list_dummies = [](const RangeList& list) {
+        return static_cast<size_t>(list.target_range / DEFAULT_PLOOKUP_RANGE_STEP_SIZE) + 2;
+    };
+    std::vector<bool> is_dummy(num_fragment_variables, false);
+    for (const auto* list : fragment_range_lists) {
+        for (size_t i = 0; i < num_range_list_dummies(*list); ++i) {
+            is_dummy[list->variable_indices[i]] = true;
+        }
+    }
+
+    // A fragment constant relocated onto a constant of this circuit is already fixed here
+    std::vector<bool> is_existing_constant(num_fragment_variables, false);
+    for (const auto& [value, fragment_index] : fragment.constant_variable_indices) {
+        // Constants are always created after the shared variables
+        ASSERT(fragment_index >= shared_variables.size());
+        auto it = constant_variable_indices.find(value);
+        if (it != constant_variable_indices.end()) {
+            relocated[fragment_index] = it->second;
+            is_existing_constant[fragment_index] = true;
+        }
+    }
+    // Whether an arithmetic gate of the fragment is one added by fix_witness for a constant that is already fixed here
+    const auto is_redundant_constant_gate = [&](const auto& fragment_block, const size_t row) {
+        const uint32_t constant_index = fragment_block.wires[0][row];
+        if (!is_existing_constant[constant_index]) {
+            return false;
+        }
+        for (size_t wire_idx = 1; wire_idx < NUM_WIRES; ++wire_idx) {
+            if (fragment_block.wires[wire_idx][row] != fragment.zero_idx) {
+                return false;
+            }
+        }
+        auto& arithmetic = blocks.arithmetic;
+        for (size_t selector_idx = 0; selector_idx < arithmetic.selectors.size(); ++selector_idx) {
+            const auto* selector = &arithmetic.selectors[selector_idx];
+            FF expected = 0;
+            if (selector == &arithmetic.q_1() || selector == &arithmetic.q_arith()) {
+                expected = 1;
+            } else if (selector == &arithmetic.q_c()) {
+                expected = -fragment.get_variable(constant_index);
+            }
+            if (fragment_block.selectors[selector_idx][row] != expected) {
+                return false;
+            }
+        }
+        return true;
+    };
+    for (size_t i = shared_variables.size(); i < num_fragment_variables; ++i) {
+        if (relocated[i] == DROPPED && !is_dummy[i]) {
+            relocated[i] = this->add_variable(fragment.get_variable(static_cast<uint32_t>(i)));
+        }
+    }
+    for (const auto& [value, fragment_index] : fragment.constant_variable_indices) {
+        constant_variable_indices.try_emplace(value, relocated[fragment_index]);
+    }
+
+    // Merge the lookup tables
+    std::vector<size_t> relocated_table_index(fragment.lookup_tables.size());
+    for (const auto& fragment_table : fragment.lookup_tables) {
+        auto& table = get_table(fragment_table.id);
+        table.lookup_gates.insert(
+            table.lookup_gates.end(), fragment_table.lookup_gates.begin(), fragment_table.lookup_gates.end());
+        relocated_table_index[fragment_table.table_index] = table.table_index;
+    }
+
+    // Copy constraints, then range constraints. A range list created here puts its dummy gates first.
+    for (size_t i = 0; i < num_fragment_variables; ++i) {
+        const uint32_t real_index = fragment.real_variable_index[i];
+        if (real_index != i) {
+            this->assert_equal(relocated[real_index], relocated[i]);
+        }
+    }
+    for (const auto* list : fragment_range_lists) {
+        for (size_t i = num_range_list_dummies(*list); i < list->variable_indices.size(); ++i) {
+            create_new_range_constraint(relocated[list->variable_indices[i]], list->target_range);
+        }
+    }
+
+    auto fragment_blocks = fragment.blocks.get();
+    auto this_blocks = blocks.get();
+    for (size_t block_idx = 0; block_idx < this_blocks.size(); ++block_idx) {
+        const auto& fragment_block = fragment_blocks[block_idx];
+        auto& block = this_blocks[block_idx];
+        const bool is_arithmetic_block = &block == &blocks.arithmetic;
+        std::vector<uint32_t> gate_wires;
+        std::vector<size_t> fragment_rows;
+        gate_wires.reserve(fragment_block.size() * NUM_WIRES);
+        fragment_rows.reserve(fragment_block.size());
+        for (size_t row = 0; row < fragment_block.size(); ++row) {
+            bool is_dummy_gate = false;
+            for (const auto& wire : fragment_block.wires) {
+                is_dummy_gate |= relocated[wire[row]] == DROPPED;
+            }
+            if (is_dummy_gate) {
+                for (const auto& selector : fragment_block.selectors) {
+                    ASSERT(selector[row] == 0);
+                }
+                continue;
+            }
+            if (is_arithmetic_block && is_redundant_constant_gate(fragment_block, row)) {
+                continue;
+            }
+            for (const auto& wire : fragment_block.wires) {
+                gate_wires.emplace_back(relocated[wire[row]]);
+            }
+            fragment_rows.emplace_back(row);
+        }
+        const size_t first_row = block.append_gates(gate_wires);
+        for (size_t selector_idx = 0; selector_idx < block.selectors.size(); ++selector_idx) {
+            const auto& fragment_selector = fragment_block.selectors[selector_idx];
+            auto& selector = block.selectors[selector_idx];
+            for (size_t i = 0; i < fragment_rows.size(); ++i) {
+                selector[first_row + i] = fragment_selector[fragment_rows[i]];
+            }
+        }
+        this->num_gates += fragment_rows.size();
+    }
+    // The table index of a lookup gate is stored in q_3
+    for (size_t row = blocks.lookup.size() - fragment.blocks.lookup.size(); row < blocks.lookup.size(); ++row) {
+        if (blocks.lookup.q_lookup_type()[row] != 0) {
+            const auto fragment_table_index = static_cast<size_t>(uint256_t(blocks.lookup.q_3()[row]).data[0]);
+            blocks.lookup.q_3()[row] = FF(relocated_table_index[fragment_table_index]);
+        }
+    }
+    check_selector_length_consistency();
+
+    for (const auto& index : fragment.used_witnesses) {
+        if (relocated[index] != DROPPED) {
+            used_witnesses.emplace_back(relocated[index]);
+        }
+    }
+}
+
 /**
  * @brief Ensure all polynomials have at least one non-zero coefficient to avoid commiting to the zero-polynomial
  *
@@ -727,14 +907,14 @@ void UltraCircuitBuilder_<ExecutionTrace>::fix_witness(const uint32_t witness_in
 template <typename ExecutionTrace>
 uint32_t UltraCircuitBuilder_<ExecutionTrace>::put_constant_variable(const FF& variable)
 {
-    if (constant_variable_indices.contains(variable)) {
-        return constant_variable_indices.at(variable);
-    } else {
-        uint32_t variable_index = this->add_variable(variable);
-        fix_witness(variable_index, variable);
-        constant_variable_indices.insert({ variable, variable_index });
-        return variable_index;
-    }
+    auto it = constant_variable_indices.find(variable);
+    if (it != constant_variable_indices.end()) {
+        return it->second;
+    }
+    uint32_t variable_index = this->add_variable(variable);
+    fix_witness(variable_index, variable);
+    constant_variable_indices.emplace(variable, variable_index);
+    return variable_index;
 }
 
 /**
@@ -772,6 +952,10 @@ plookup::ReadData<uint32_t> UltraCircuitBuilder_<ExecutionTrace>::create_gates_f
     const auto& multi_table = plookup::get_multitable(id);
     const size_t num_lookups = read_values[plookup::ColumnIdx::C1].size();
     plookup::ReadData<uint32_t> read_data;
+    std::vector<uint32_t> gate_wires;
+    gate_wires.reserve(num_lookups * NUM_WIRES);
+    std::vector<size_t> table_indices;
+    table_indices.reserve(num_lookups);
     for (size_t i = 0; i < num_lookups; ++i) {
         // get basic lookup table; construct and add to builder.lookup_tables if not already present
         auto& table = get_table(multi_table.basic_table_ids[i]);
@@ -789,26 +973,24 @@ plookup::ReadData<uint32_t> UltraCircuitBuilder_<ExecutionTrace>::create_gates_f
         read_data[plookup::ColumnIdx::C3].push_back(third_idx);
         this->assert_valid_variables({ first_idx, second_idx, third_idx });
 
-        blocks.lookup.q_lookup_type().emplace_back(FF(1));
-        blocks.lookup.q_3().emplace_back(FF(table.table_index));
-        blocks.lookup.populate_wires(first_idx, second_idx, third_idx, this->zero_idx);
-        blocks.lookup.q_1().emplace_back(0);
-        blocks.lookup.q_2().emplace_back((i == (num_lookups - 1) ? 0 : -multi_table.column_1_step_sizes[i + 1]));
-        blocks.lookup.q_m().emplace_back((i == (num_lookups - 1) ? 0 : -multi_table.column_2_step_sizes[i + 1]));
-        blocks.lookup.q_c().emplace_back((i == (num_lookups - 1) ? 0 : -multi_table.column_3_step_sizes[i + 1]));
-        blocks.lookup.q_arith().emplace_back(0);
-        blocks.lookup.q_4().emplace_back(0);
-        blocks.lookup.q_delta_range().emplace_back(0);
-        blocks.lookup.q_elliptic().emplace_back(0);
-        blocks.lookup.q_aux().emplace_back(0);
-        blocks.lookup.q_poseidon2_external().emplace_back(0);
-        blocks.lookup.q_poseidon2_internal().emplace_back(0);
-        if constexpr (HasAdditionalSelectors<ExecutionTrace>) {
-            blocks.lookup.pad_additional();
+        gate_wires.insert(gate_wires.end(), { first_idx, second_idx, third_idx, this->zero_idx });
+        table_indices.push_back(table.table_index);
+    }
+
+    // Append all the lookup gates at once, then set the selectors; the last gate has no step sizes
+    const size_t first_row = blocks.lookup.append_gates(gate_wires);
+    for (size_t i = 0; i < num_lookups; ++i) {
+        const size_t row = first_row + i;
+        blocks.lookup.q_lookup_type()[row] = FF(1);
+        blocks.lookup.q_3()[row] = FF(table_indices[i]);
+        if (i != num_lookups - 1) {
+            blocks.lookup.q_2()[row] = -multi_table.column_1_step_sizes[i + 1];
+            blocks.lookup.q_m()[row] = -multi_table.column_2_step_sizes[i + 1];
+            blocks.lookup.q_c()[row] = -multi_table.column_3_step_sizes[i + 1];
         }
-        check_selector_length_consistency();
-        ++this->num_gates;
     }
+    check_selector_length_consistency();
+    this->num_gates += num_lookups;
     return read_data;
 }
 
@@ -972,12 +1154,13 @@ void UltraCircuitBuilder_<ExecutionTrace>::create_new_range_constraint(const uin
             this->failure(msg);
         }
     }
-    if (range_lists.count(target_range) == 0) {
-        range_lists.insert({ target_range, create_range_list(target_range) });
+    auto list_it = range_lists.find(target_range);
+    if (list_it == range_lists.end()) {
+        list_it = range_lists.emplace(target_range, create_range_list(target_range)).first;
     }
 
     const auto existing_tag = this->real_variable_tags[this->real_variable_index[variable_index]];
-    auto& list = range_lists[target_range];
+    auto& list = list_it->second;
 
     // If the variable's tag matches the target range list's tag, do nothing.
     if (existing_tag != list.range_tag) {
@@ -1072,8 +1255,15 @@ template <typename ExecutionTrace> void UltraCircuitBuilder_<ExecutionTrace>::pr
 
 template <typename ExecutionTrace> void UltraCircuitBuilder_<ExecutionTrace>::process_range_lists()
 {
-    for (auto& i : range_lists) {
-        process_range_list(i.second);
+    // Process the lists in order of target range so that the resulting gates do not depend on the hash map layout
+    std::vector<uint64_t> target_ranges;
+    target_ranges.reserve(range_lists.size());
+    for (const auto& [target_range, list] : range_lists) {
+        target_ranges.push_back(target_range);
+    }
+    std::sort(target_ranges.begin(), target_ranges.end());
+    for (const auto target_range : target_ranges) {
+        process_range_list(range_lists.at(target_range));
     }
 }
 
@@ -1087,7 +1277,7 @@ template <typename ExecutionTrace> void UltraCircuitBuilder_<ExecutionTrace>::pr
   *
   * create range constraint parameters: variable index && range size
   *
-  * std::map<uint64_t, RangeList> range_lists;
+  * std::unordered_map<uint64_t, RangeList> range_lists;
 */
 // Check for a sequence of variables that neighboring differences are at most 3 (used for batched range checkj)
 template <typename ExecutionTrace>
@@ -1097,29 +1287,12 @@ void UltraCircuitBuilder_<ExecutionTrace>::create_sort_constraint(const std::vec
     ASSERT(variable_index.size() % gate_width == 0);
     this->assert_valid_variables(variable_index);
 
-    for (size_t i = 0; i < variable_index.size(); i += gate_width) {
-        blocks.delta_range.populate_wires(
-            variable_index[i], variable_index[i + 1], variable_index[i + 2], variable_index[i + 3]);
-
-        ++this->num_gates;
-        blocks.delta_range.q_m().emplace_back(0);
-        blocks.delta_range.q_1().emplace_back(0);
-        blocks.delta_range.q_2().emplace_back(0);
-        blocks.delta_range.q_3().emplace_back(0);
-        blocks.delta_range.q_c().emplace_back(0);
-        blocks.delta_range.q_arith().emplace_back(0);
-        blocks.delta_range.q_4().emplace_back(0);
-        blocks.delta_range.q_delta_range().emplace_back(1);
-        blocks.delta_range.q_elliptic().emplace_back(0);
-        blocks.delta_range.q_lookup_type().emplace_back(0);
-        blocks.delta_range.q_aux().emplace_back(0);
-        blocks.delta_range.q_poseidon2_external().emplace_back(0);
-        blocks.delta_range.q_poseidon2_internal().emplace_back(0);
-        if constexpr (HasAdditionalSelectors<ExecutionTrace>) {
-            blocks.delta_range.pad_additional();
-        }
-        check_selector_length_consistency();
-    }
+    // The variables are laid out gate by gate, so all the sort gates can be appended in one batch
+    const size_t first_row = blocks.delta_range.append_gates(variable_index);
+    auto& q_delta_range = blocks.delta_range.q_delta_range();
+    std::fill(q_delta_range.begin() + static_cast<std::ptrdiff_t>(first_row), q_delta_range.end(), FF(1));
+    this->num_gates += variable_index.size() / gate_width;
+    check_selector_length_consistency();
     // dummy gate needed because of sort widget's check of next row
     create_dummy_gate(
         blocks.delta_range, variable_index[variable_index.size() - 1], this->zero_idx, this->zero_idx, this->zero_idx);
@@ -1194,54 +1367,12 @@ void UltraCircuitBuilder_<ExecutionTrace>::create_sort_constraint_with_edges(
     // Add an arithmetic gate to ensure the first input is equal to the start value of the range being checked
     create_add_gate({ variable_index[0], this->zero_idx, this->zero_idx, 1, 0, 0, -start });
 
-    // enforce range check for all but the final row
-    for (size_t i = 0; i < variable_index.size() - gate_width; i += gate_width) {
-
-        block.populate_wires(variable_index[i], variable_index[i + 1], variable_index[i + 2], variable_index[i + 3]);
-        ++this->num_gates;
-        block.q_m().emplace_back(0);
-        block.q_1().emplace_back(0);
-        block.q_2().emplace_back(0);
-        block.q_3().emplace_back(0);
-        block.q_c().emplace_back(0);
-        block.q_arith().emplace_back(0);
-        block.q_4().emplace_back(0);
-        block.q_delta_range().emplace_back(1);
-        block.q_elliptic().emplace_back(0);
-        block.q_lookup_type().emplace_back(0);
-        block.q_aux().emplace_back(0);
-        block.q_poseidon2_external().emplace_back(0);
-        block.q_poseidon2_internal().emplace_back(0);
-        if constexpr (HasAdditionalSelectors<ExecutionTrace>) {
-            block.pad_additional();
-        }
-        check_selector_length_consistency();
-    }
-    // enforce range checks of last row and ending at end
-    if (variable_index.size() > gate_width) {
-        block.populate_wires(variable_index[variable_index.size() - 4],
-                             variable_index[variable_index.size() - 3],
-                             variable_index[variable_index.size() - 2],
-                             variable_index[variable_index.size() - 1]);
-        ++this->num_gates;
-        block.q_m().emplace_back(0);
-        block.q_1().emplace_back(0);
-        block.q_2().emplace_back(0);
-        block.q_3().emplace_back(0);
-        block.q_c().emplace_back(0);
-        block.q_arith().emplace_back(0);
-        block.q_4().emplace_back(0);
-        block.q_delta_range().emplace_back(1);
-        block.q_elliptic().emplace_back(0);
-        block.q_lookup_type().emplace_back(0);
-        block.q_aux().emplace_back(0);
-        block.q_poseidon2_external().emplace_back(0);
-        block.q_poseidon2_internal().emplace_back(0);
-        if constexpr (HasAdditionalSelectors<ExecutionTrace>) {
-            block.pad_additional();
-        }
-        check_selector_length_consistency();
-    }
+    // enforce range checks on every row, the last of which ends at end; the gates are appended in one batch
+    const size_t first_row = block.append_gates(variable_index);
+    auto& q_delta_range = block.q_delta_range();
+    std::fill(q_delta_range.begin() + static_cast<std::ptrdiff_t>(first_row), q_delta_range.end(), FF(1));
+    this->num_gates += variable_index.size() / gate_width;
+    check_selector_length_consistency();
 
     // dummy gate needed because of sort widget's check of next row
     // use this gate to check end condition
@@ -15,6 +15,8 @@
 // TODO(md): note that this has now been added
 #include "circuit_builder_base.hpp"
 #include <optional>
+#include <span>
+#include <unordered_map>
 #include <unordered_set>
 
 #include "barretenberg/serialize/msgpack.hpp"
@@ -296,12 +298,14 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename ExecutionTrace_:
 
     // These are variables that we have used a gate on, to enforce that they are
     // equal to a defined value.
-    std::map<FF, uint32_t> constant_variable_indices;
+    std::unordered_map<FF, uint32_t> constant_variable_indices;
 
     // The set of lookup tables used by the circuit, plus the gate data for the lookups from each table
     std::vector<plookup::BasicTable> lookup_tables;
 
-    std::map<uint64_t, RangeList> range_lists; // DOCTODO: explain this.
+    // Range lists keyed by target range. Iteration order is unspecified; anything that adds gates must visit the lists
+    // in order of target range (see process_range_lists) so that the circuit does not depend on the hash map layout.
+    std::unordered_map<uint64_t, RangeList> range_lists;
 
     /**
      * @brief Each entry in ram_arrays represents an independent RAM table.
@@ -440,6 +444,25 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename ExecutionTrace_:
 
     void add_gates_to_ensure_all_polys_are_non_zero();
 
+    /**
+     * @brief Whether this circuit can be spliced into another one with append_fragment
+     * @details A fragment may only use gates, copy constraints, lookups and range constraints. Public inputs, ROM/RAM
+     * arrays, deferred non-native multiplications and custom tags are tied to the builder that created them.
+     */
+    bool is_appendable_fragment() const;
+    /**
+     * @brief Append the gates and constraints of a circuit constructed independently of this one
+     * @details The first shared_variables.size() variables of the fragment are identified with the given variables of
+     * this circuit; all other fragment variables are added as new variables. The gates of each fragment block are
+     * appended after the gates of the corresponding block of this circuit, lookup tables are merged, and copy and range
+     * constraints are re-imposed through this builder. The result is independent of how and when the fragment was
+     * built, so fragments can be constructed in parallel and appended in a fixed order.
+     *
+     * @param fragment A builder satisfying is_appendable_fragment()
+     * @param shared_variables Variables of this circuit corresponding to the leading fragment variables
+     */
+    void append_fragment(const UltraCircuitBuilder_& fragment, std::span<const uint32_t> shared_variables);
+
     void create_add_gate(const add_triple_<FF>& in) override;
     void create_big_mul_add_gate(const mul_quad_<FF>& in, const bool use_next_gate_w_4 = false);
     void create_big_add_gate(const add_quad_<FF>& in, const bool use_next_gate_w_4 = false);
@@ -172,12 +172,16 @@ template <typename Flavor, const size_t virtual_log_n = CONST_PROOF_SIZE_LOG_N>
     * TODO(#224)(Cody): might want to just do C-style multidimensional array? for guaranteed adjacency?
     */
     PartiallyEvaluatedMultivariates partially_evaluated_polynomials;
-    // prover instantiates sumcheck with circuit size and a prover transcript
-    SumcheckProver(size_t multivariate_n, const std::shared_ptr<Transcript>& transcript)
+    // prover instantiates sumcheck with circuit size and a prover transcript. The optional active ranges are the rows
+    // outside of which the relations vanish identically (see SumcheckProverRound::active_ranges); the remaining rows
+    // are skipped when computing the round univariates.
+    SumcheckProver(size_t multivariate_n,
+                   const std::shared_ptr<Transcript>& transcript,
+                   std::vector<std::pair<size_t, size_t>> active_ranges = {})
         : multivariate_n(multivariate_n)
         , multivariate_d(numeric::get_msb(multivariate_n))
         , transcript(transcript)
-        , round(multivariate_n){};
+        , round(multivariate_n, std::move(active_ranges)){};
 
     /**
      * @brief Non-ZK version: Compute round univariate, place it in transcript, compute challenge, partially evaluate.
@@ -213,19 +217,31 @@ template <typename Flavor, const size_t virtual_log_n = CONST_PROOF_SIZE_LOG_N>
             transcript->send_to_verifier("Sumcheck:univariate_0", round_univariate);
             FF round_challenge = transcript->template get_challenge<FF>("Sumcheck:u_0");
             multivariate_challenge.emplace_back(round_challenge);
-            // Prepare sumcheck book-keeping table for the next round
-            partially_evaluate(full_polynomials, round_challenge);
             gate_separators.partially_evaluate(round_challenge);
             round.round_size = round.round_size >> 1; // TODO(#224)(Cody): Maybe partially_evaluate should do this and
             // release memory?        // All but final round
             // We operate on partially_evaluated_polynomials in place.
+            if (fuse_first_partial_evaluation()) {
+                // The book-keeping table is populated while computing the univariate of the second round
+                round_univariate = round.partially_evaluate_and_compute_univariate(full_polynomials,
+                                                                                   partially_evaluated_polynomials,
+                                                                                   round_challenge,
+                                                                                   relation_parameters,
+                                                                                   gate_separators,
+                                                                                   alpha);
+            } else {
+                // Prepare sumcheck book-keeping table for the next round
+                partially_evaluate(full_polynomials, round_challenge);
+            }
         }
         for (size_t round_idx = 1; round_idx < multivariate_d; round_idx++) {
             PROFILE_THIS_NAME("sumcheck loop");
 
             // Write the round univariate to the transcript
-            round_univariate =
-                round.compute_univariate(partially_evaluated_polynomials, relation_parameters, gate_separators, alpha);
+            if (round_idx > 1 || !fuse_first_partial_evaluation()) {
+                round_univariate = round.compute_univariate(
+                    partially_evaluated_polynomials, relation_parameters, gate_separators, alpha);
+            }
             // Place evaluations of Sumcheck Round Univariate in the transcript
             transcript->send_to_verifier("Sumcheck:univariate_" + std::to_string(round_idx), round_univariate);
             FF round_challenge = transcript->template get_challenge<FF>("Sumcheck:u_" + std::to_string(round_idx));
@@ -479,6 +495,15 @@ template <typename Flavor, const size_t virtual_log_n = CONST_PROOF_SIZE_LOG_N>
             pep_view[j].shrink_end_index(limit / 2 + limit % 2);
         });
     };
+    /**
+     * @brief Whether the partial evaluation of the full polynomials is fused with the univariate of the second round
+     * @details This removes a full pass over the book-keeping table in the most memory-bound round. The later
+     * partial evaluations are done in place, and fusing them as well would take a second book-keeping table (so that a
+     * thread never overwrites rows another thread has yet to read). The chunked univariate computation of the AVM is
+     * not fused.
+     */
+    bool fuse_first_partial_evaluation() const { return !specifiesUnivariateChunks<Flavor> && multivariate_d > 1; }
+
     /**
      * @brief Evaluate at the round challenge and prepare class for next round.
      * Specialization for array, see \ref bb::SumcheckProver<Flavor>::partially_evaluate "generic version".
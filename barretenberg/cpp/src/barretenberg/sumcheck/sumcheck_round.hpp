@@ -48,6 +48,7 @@ template <typename Flavor> class SumcheckProverRound {
     using Relations = typename Flavor::Relations;
     using SumcheckTupleOfTuplesOfUnivariates = typename Flavor::SumcheckTupleOfTuplesOfUnivariates;
     using RelationSeparator = typename Flavor::RelationSeparator;
+    using PartiallyEvaluatedMultivariates = typename Flavor::PartiallyEvaluatedMultivariates;
 
   public:
     using FF = typename Flavor::FF;
@@ -81,9 +82,20 @@ template <typename Flavor> class SumcheckProverRound {
     // The length of the polynomials used to mask the Sumcheck Round Univariates.
     static constexpr size_t LIBRA_UNIVARIATES_LENGTH = Flavor::Curve::LIBRA_UNIVARIATES_LENGTH;
 
+    /**
+     * @brief Sorted, disjoint row ranges [start, end) of the full hypercube outside of which every relation vanishes
+     * identically, e.g. the active regions of a structured trace. If empty, every row is treated as active.
+     */
+    std::vector<std::pair<size_t, size_t>> active_ranges;
+
+    // Number of rows of the next book-keeping table folded at once by partially_evaluate_and_compute_univariate
+    static constexpr size_t PARTIAL_EVALUATION_BLOCK_SIZE = 64;
+
     // Prover constructor
-    SumcheckProverRound(size_t initial_round_size)
+    SumcheckProverRound(size_t initial_round_size, std::vector<std::pair<size_t, size_t>> active_ranges = {})
         : round_size(initial_round_size)
+        , active_ranges(std::move(active_ranges))
+        , full_round_size(initial_round_size)
     {
 
         PROFILE_THIS_NAME("SumcheckProverRound constructor");
@@ -175,6 +187,31 @@ template <typename Flavor> class SumcheckProverRound {
         // on a specified minimum number of iterations per thread. This eventually leads to the use of a single thread.
         // For now we use a power of 2 number of threads simply to ensure the round size is evenly divided.
         size_t min_iterations_per_thread = 1 << 6; // min number of iterations for which we'll spin up a unique thread
+
+        // If the active regions of the trace are known, only the edges touching them are visited and the threads are
+        // given equal numbers of active edges rather than equal ranges of indices.
+        if (!active_ranges.empty()) {
+            const auto thread_edge_ranges = construct_active_thread_edge_ranges(min_iterations_per_thread);
+            std::vector<SumcheckTupleOfTuplesOfUnivariates> thread_univariate_accumulators(thread_edge_ranges.size());
+            parallel_for(thread_edge_ranges.size(), [&](size_t thread_idx) {
+                Utils::zero_univariates(thread_univariate_accumulators[thread_idx]);
+                ExtendedEdges extended_edges;
+                for (const auto& [start, end] : thread_edge_ranges[thread_idx]) {
+                    for (size_t edge_idx = start; edge_idx < end; edge_idx += 2) {
+                        extend_edges(extended_edges, polynomials, edge_idx);
+                        accumulate_relation_univariates(thread_univariate_accumulators[thread_idx],
+                                                        extended_edges,
+                                                        relation_parameters,
+                                                        gate_separators[(edge_idx >> 1) * gate_separators.periodicity]);
+                    }
+                }
+            });
+            for (auto& accumulators : thread_univariate_accumulators) {
+                Utils::add_nested_tuples(univariate_accumulators, accumulators);
+            }
+            return batch_over_relations<SumcheckRoundUnivariate>(univariate_accumulators, alpha, gate_separators);
+        }
+
         size_t num_threads = bb::calculate_num_threads_pow2(round_size, min_iterations_per_thread);
 
         // In the AVM, the trace is more dense at the top and therefore it is worth to split the work per thread
@@ -277,6 +314,105 @@ template <typename Flavor> class SumcheckProverRound {
         return batch_over_relations<SumcheckRoundUnivariate>(univariate_accumulators, alpha, gate_separators);
     }
 
+    /**
+     * @brief Partially evaluate the book-keeping table of the previous round at its challenge and compute the
+     * univariate of the current round from the folded edges in the same pass.
+     * @details Equivalent to SumcheckProver::partially_evaluate followed by \ref compute_univariate
+     * "compute_univariate" on its output, but the folded rows are consumed while they are still in cache instead of
+     * being written out and then streamed back in by a second pass over every column. #round_size must already be
+     * that of the current round. Edges outside of the #active_ranges are only folded.
+     *
+     * @param source The book-keeping table of the previous round
+     * @param destination Receives the partial evaluation of \p source at \p challenge
+     */
+    template <typename ProverPolynomialsOrPartiallyEvaluatedMultivariates>
+    SumcheckRoundUnivariate partially_evaluate_and_compute_univariate(
+        const ProverPolynomialsOrPartiallyEvaluatedMultivariates& source,
+        PartiallyEvaluatedMultivariates& destination,
+        const FF& challenge,
+        const bb::RelationParameters<FF>& relation_parameters,
+        const bb::GateSeparatorPolynomial<FF>& gate_separators,
+        const RelationSeparator alpha)
+    {
+        PROFILE_THIS_NAME("partially_evaluate_and_compute_univariate");
+
+        size_t min_iterations_per_thread = 1 << 6; // min number of iterations for which we'll spin up a unique thread
+
+        std::vector<std::vector<std::pair<size_t, size_t>>> thread_edge_ranges;
+        std::vector<std::pair<size_t, size_t>> inactive_edge_ranges;
+        if (active_ranges.empty()) {
+            const size_t num_threads = bb::calculate_num_threads_pow2(round_size, min_iterations_per_thread);
+            const size_t edges_per_thread = round_size / num_threads;
+            for (size_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
+                const size_t start = thread_idx * edges_per_thread;
+                thread_edge_ranges.push_back({ { start, start + edges_per_thread } });
+            }
+        } else {
+            thread_edge_ranges = construct_active_thread_edge_ranges(min_iterations_per_thread);
+            size_t previous_end = 0;
+            for (const auto& ranges : thread_edge_ranges) {
+                for (const auto& [start, end] : ranges) {
+                    if (start > previous_end) {
+                        inactive_edge_ranges.emplace_back(previous_end, start);
+                    }
+                    previous_end = end;
+                }
+            }
+            if (previous_end < round_size) {
+                inactive_edge_ranges.emplace_back(previous_end, round_size);
+            }
+        }
+
+        auto source_view = source.get_all();
+        auto destination_view = destination.get_all();
+        // Write the partial evaluation of the rows [start, end) of the next book-keeping table, column by column
+        const auto partially_evaluate_rows = [&](size_t start, size_t end) {
+            for (auto [destination_poly, poly] : zip_view(destination_view, source_view)) {
+                const size_t limit = std::min(end, poly.end_index() / 2 + poly.end_index() % 2);
+                for (size_t i = start; i < limit; ++i) {
+                    destination_poly.at(i) = poly[2 * i] + challenge * (poly[2 * i + 1] - poly[2 * i]);
+                }
+            }
+        };
+
+        // The rows are folded a block at a time, and the univariate contributions of the block's edges are computed
+        // while the folded rows are still in cache
+        std::vector<SumcheckTupleOfTuplesOfUnivariates> thread_univariate_accumulators(thread_edge_ranges.size());
+        parallel_for(thread_edge_ranges.size(), [&](size_t thread_idx) {
+            Utils::zero_univariates(thread_univariate_accumulators[thread_idx]);
+            ExtendedEdges extended_edges;
+            for (const auto& [start, end] : thread_edge_ranges[thread_idx]) {
+                for (size_t block_start = start; block_start < end; block_start += PARTIAL_EVALUATION_BLOCK_SIZE) {
+                    const size_t block_end = std::min(end, block_start + PARTIAL_EVALUATION_BLOCK_SIZE);
+                    partially_evaluate_rows(block_start, block_end);
+                    for (size_t edge_idx = block_start; edge_idx < block_end; edge_idx += 2) {
+                        extend_edges(extended_edges, destination, edge_idx);
+                        accumulate_relation_univariates(thread_univariate_accumulators[thread_idx],
+                                                        extended_edges,
+                                                        relation_parameters,
+                                                        gate_separators[(edge_idx >> 1) * gate_separators.periodicity]);
+                    }
+                }
+            }
+        });
+
+        // The skipped edges still have to be folded for the next rounds
+        if (!inactive_edge_ranges.empty()) {
+            parallel_for(inactive_edge_ranges.size(), [&](size_t range_idx) {
+                partially_evaluate_rows(inactive_edge_ranges[range_idx].first, inactive_edge_ranges[range_idx].second);
+            });
+        }
+        // As in SumcheckProver::partially_evaluate, the folded columns end at CEIL(limit/2)
+        for (auto [destination_poly, poly] : zip_view(destination_view, source_view)) {
+            destination_poly.shrink_end_index(poly.end_index() / 2 + poly.end_index() % 2);
+        }
+
+        for (auto& accumulators : thread_univariate_accumulators) {
+            Utils::add_nested_tuples(univariate_accumulators, accumulators);
+        }
+        return batch_over_relations<SumcheckRoundUnivariate>(univariate_accumulators, alpha, gate_separators);
+    }
+
     /**
      * @brief In the de-facto mode of of operation for ZK, we add a randomising contribution via the Libra technique to
      * hide the actual round univariate and also ensure the total contribution is amended to take into account
@@ -450,6 +586,65 @@ template <typename Flavor> class SumcheckProverRound {
     }
 
   private:
+    // The round size of the first round, i.e. the size of the hypercube on which #active_ranges are given
+    size_t full_round_size;
+
+    /**
+     * @brief Distribute the edges of the current round that touch the active ranges evenly across threads
+     * @details In Round \f$ i \f$ the row with index \f$ k \f$ of the book-keeping table is a linear combination of the
+     * rows \f$ [k \cdot 2^i, (k+1) \cdot 2^i) \f$ of the full trace, so an edge whose rows are all inactive contributes
+     * nothing to the round univariate and is skipped. The edges that remain are split into contiguous pieces with
+     * (up to rounding) the same number of edges per thread.
+     *
+     * @return For each thread, the ranges [start, end) of (even) edge indices it processes
+     */
+    std::vector<std::vector<std::pair<size_t, size_t>>> construct_active_thread_edge_ranges(
+        const size_t min_iterations_per_thread) const
+    {
+        const size_t log_scale = numeric::get_msb(full_round_size / round_size);
+        const size_t scale = static_cast<size_t>(1) << log_scale;
+
+        // Map the active rows of the full trace to the edges of the current round, merging the ranges that now overlap
+        std::vector<std::pair<size_t, size_t>> edge_ranges;
+        size_t num_active_edges = 0;
+        for (const auto& [row_start, row_end] : active_ranges) {
+            const size_t start = (row_start >> log_scale) & ~static_cast<size_t>(1);
+            size_t end = (row_end + scale - 1) >> log_scale;
+            end = std::min(end + (end & 1), round_size);
+            if (start >= end) {
+                continue;
+            }
+            if (!edge_ranges.empty() && start <= edge_ranges.back().second) {
+                num_active_edges -= edge_ranges.back().second - edge_ranges.back().first;
+                edge_ranges.back().second = std::max(end, edge_ranges.back().second);
+            } else {
+                edge_ranges.emplace_back(start, end);
+            }
+            num_active_edges += edge_ranges.back().second - edge_ranges.back().first;
+        }
+
+        const size_t num_threads = bb::calculate_num_threads(num_active_edges, min_iterations_per_thread);
+        size_t edges_per_thread = (num_active_edges + num_threads - 1) / num_threads;
+        edges_per_thread += edges_per_thread & 1;
+
+        std::vector<std::vector<std::pair<size_t, size_t>>> thread_ranges(num_threads);
+        size_t thread_idx = 0;
+        size_t thread_space_remaining = edges_per_thread;
+        for (auto [start, end] : edge_ranges) {
+            while (start < end) {
+                const size_t piece_end = std::min(end, start + thread_space_remaining);
+                thread_ranges[thread_idx].emplace_back(start, piece_end);
+                thread_space_remaining -= piece_end - start;
+                start = piece_end;
+                if (thread_space_remaining == 0 && thread_idx + 1 < num_threads) {
+                    ++thread_idx;
+                    thread_space_remaining = edges_per_thread;
+                }
+            }
+        }
+        return thread_ranges;
+    }
+
     /**
      * @brief In Round \f$ i \f$, for a given point \f$ \vec \ell \in \{0,1\}^{d-1 - i}\f$, calculate the contribution
      * of each sub-relation to \f$ T^i(X_i) \f$.
@@ -131,3 +131,74 @@ TEST(SumcheckRound, AddTuplesOfTuplesOfUnivariates)
     EXPECT_EQ(std::get<0>(std::get<1>(tuple_of_tuples_1)), expected_sum_2);
     EXPECT_EQ(std::get<1>(std::get<1>(tuple_of_tuples_1)), expected_sum_3);
 }
+
+/**
+ * @brief Check that the fused partial evaluation and univariate computation matches partially evaluating first and
+ * computing the univariate of the next round afterwards
+ *
+ */
+TEST(SumcheckRound, PartiallyEvaluateAndComputeUnivariate)
+{
+    using Flavor = UltraFlavor;
+    using FF = typename Flavor::FF;
+    using ProverPolynomials = typename Flavor::ProverPolynomials;
+    using PartiallyEvaluatedMultivariates = typename Flavor::PartiallyEvaluatedMultivariates;
+
+    const size_t log_n = 6;
+    const size_t n = 1 << log_n;
+
+    // Random polynomials, some of which end before the end of the hypercube
+    ProverPolynomials full_polynomials;
+    size_t poly_idx = 0;
+    for (auto& poly : full_polynomials.get_all()) {
+        const size_t size = (poly_idx % 3 == 0) ? n - 1 - (poly_idx % 11) : n;
+        ++poly_idx;
+        poly = Polynomial<FF>::random(size, n, /*start_index=*/0);
+    }
+
+    RelationParameters<FF> relation_parameters = RelationParameters<FF>::get_random();
+    typename Flavor::RelationSeparator alpha;
+    for (auto& alpha_i : alpha) {
+        alpha_i = FF::random_element();
+    }
+    std::vector<FF> gate_challenges(log_n);
+    for (auto& gate_challenge : gate_challenges) {
+        gate_challenge = FF::random_element();
+    }
+    const FF challenge = FF::random_element();
+    GateSeparatorPolynomial<FF> gate_separators(gate_challenges, log_n);
+    gate_separators.partially_evaluate(challenge);
+
+    // Partially evaluate, then compute the univariate of the next round
+    PartiallyEvaluatedMultivariates expected_polynomials(full_polynomials, n);
+    for (auto [expected_poly, poly] : zip_view(expected_polynomials.get_all(), full_polynomials.get_all())) {
+        for (size_t i = 0; i < poly.end_index(); i += 2) {
+            expected_poly.at(i >> 1) = poly[i] + challenge * (poly[i + 1] - poly[i]);
+        }
+    }
+    SumcheckProverRound<Flavor> expected_round(n / 2);
+    auto expected_univariate =
+        expected_round.compute_univariate(expected_polynomials, relation_parameters, gate_separators, alpha);
+
+    // Fused
+    PartiallyEvaluatedMultivariates partially_evaluated_polynomials(full_polynomials, n);
+    SumcheckProverRound<Flavor> round(n / 2);
+    auto univariate = round.partially_evaluate_and_compute_univariate(
+        full_polynomials, partially_evaluated_polynomials, challenge, relation_parameters, gate_separators, alpha);
+
+    EXPECT_EQ(univariate, expected_univariate);
+    for (auto [poly, expected_poly] :
+         zip_view(partially_evaluated_polynomials.get_all(), expected_polynomials.get_all())) {
+        EXPECT_EQ(poly.end_index(), expected_poly.end_index());
+        EXPECT_EQ(poly, expected_poly);
+    }
+
+    // With active ranges, the edges that are skipped by the univariate computation are still folded
+    PartiallyEvaluatedMultivariates folded_with_active_ranges(full_polynomials, n);
+    SumcheckProverRound<Flavor> round_with_active_ranges(n / 2, { { 4, 9 }, { 30, 41 } });
+    round_with_active_ranges.partially_evaluate_and_compute_univariate(
+        full_polynomials, folded_with_active_ranges, challenge, relation_parameters, gate_separators, alpha);
+    for (auto [poly, expected_poly] : zip_view(folded_with_active_ranges.get_all(), expected_polynomials.get_all())) {
+        EXPECT_EQ(poly, expected_poly);
+    }
+}
@@ -13,6 +13,11 @@
 #include "barretenberg/flavor/ultra_keccak_zk_flavor.hpp"
 #include "barretenberg/flavor/ultra_rollup_flavor.hpp"
 #include "barretenberg/flavor/ultra_zk_flavor.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <tuple>
+
 namespace bb {
 
 template <class Flavor>
@@ -82,7 +87,8 @@ typename TraceToPolynomials<Flavor>::TraceData TraceToPolynomials<Flavor>::const
     TraceData trace_data{ builder, proving_key };
 
     uint32_t offset = Flavor::has_zero_row ? 1 : 0; // Offset at which to place each block in the trace polynomials
-    // For each block in the trace, populate wire polys, copy cycles and selector polys
+    std::vector<uint32_t> block_offsets;
+    // For each block in the trace, populate wire polys and selector polys
 
     for (auto& block : builder.blocks.get()) {
         auto block_size = static_cast<uint32_t>(block.size());
@@ -95,24 +101,22 @@ typename TraceToPolynomials<Flavor>::TraceData TraceToPolynomials<Flavor>::const
             }
         }
 
-        // Update wire polynomials and copy cycles
-        // NB: The order of row/column loops is arbitrary but needs to be row/column to match old copy_cycle code
+        // Update wire polynomials. The copy cycles are constructed from the blocks once all the offsets are known.
         {
 
-            PROFILE_THIS_NAME("populating wires and copy_cycles");
-
-            for (uint32_t block_row_idx = 0; block_row_idx < block_size; ++block_row_idx) {
-                for (uint32_t wire_idx = 0; wire_idx < NUM_WIRES; ++wire_idx) {
-                    uint32_t var_idx = block.wires[wire_idx][block_row_idx]; // an index into the variables array
-                    uint32_t real_var_idx = builder.real_variable_index[var_idx];
-                    uint32_t trace_row_idx = block_row_idx + offset;
-                    // Insert the real witness values from this block into the wire polys at the correct offset
-                    trace_data.wires[wire_idx].at(trace_row_idx) = builder.get_variable(var_idx);
-                    // Add the address of the witness value to its corresponding copy cycle
-                    trace_data.copy_cycles[real_var_idx].emplace_back(cycle_node{ wire_idx, trace_row_idx });
+            PROFILE_THIS_NAME("populating wires");
+
+            parallel_for_range(block_size, [&](size_t start, size_t end) {
+                for (size_t block_row_idx = start; block_row_idx < end; ++block_row_idx) {
+                    for (uint32_t wire_idx = 0; wire_idx < NUM_WIRES; ++wire_idx) {
+                        uint32_t var_idx = block.wires[wire_idx][block_row_idx]; // an index into the variables array
+                        // Insert the real witness values from this block into the wire polys at the correct offset
+                        trace_data.wires[wire_idx].at(block_row_idx + offset) = builder.get_variable(var_idx);
+                    }
                 }
-            }
+            });
         }
+        block_offsets.push_back(offset);
 
         // Insert the selector values for this block into the selector polynomials at the correct offset
         // TODO(https://github.com/AztecProtocol/barretenberg/issues/398): implicit arithmetization/flavor consistency
@@ -138,9 +142,71 @@ typename TraceToPolynomials<Flavor>::TraceData TraceToPolynomials<Flavor>::const
         offset += block.get_fixed_size(is_structured);
     }
 
+    trace_data.copy_cycles = construct_copy_cycles(builder, block_offsets);
+
     return trace_data;
 }
 
+template <class Flavor>
+CopyCycles TraceToPolynomials<Flavor>::construct_copy_cycles(Builder& builder,
+                                                             const std::vector<uint32_t>& block_offsets)
+{
+
+    PROFILE_THIS_NAME("construct_copy_cycles");
+
+    // A counting sort of the wire addresses by real variable index.
+    const size_t num_cycles = builder.get_num_variables();
+    std::vector<std::atomic<uint32_t>> cycle_sizes(num_cycles);
+    auto for_each_wire = [&](const auto& func) {
+        size_t block_idx = 0;
+        for (auto& block : builder.blocks.get()) {
+            const uint32_t offset = block_offsets[block_idx++];
+            parallel_for_range(block.size(), [&](size_t start, size_t end) {
+                for (size_t block_row_idx = start; block_row_idx < end; ++block_row_idx) {
+                    for (uint32_t wire_idx = 0; wire_idx < NUM_WIRES; ++wire_idx) {
+                        uint32_t real_var_idx = builder.real_variable_index[block.wires[wire_idx][block_row_idx]];
+                        func(real_var_idx, cycle_node{ wire_idx, static_cast<uint32_t>(block_row_idx) + offset });
+                    }
+                }
+            });
+        }
+    };
+
+    // Count the nodes of each cycle
+    for_each_wire([&](uint32_t real_var_idx, const cycle_node&) {
+        cycle_sizes[real_var_idx].fetch_add(1, std::memory_order_relaxed);
+    });
+
+    CopyCycles copy_cycles;
+    copy_cycles.offsets.resize(num_cycles + 1);
+    copy_cycles.offsets[0] = 0;
+    for (size_t i = 0; i < num_cycles; ++i) {
+        copy_cycles.offsets[i + 1] = copy_cycles.offsets[i] + cycle_sizes[i].load(std::memory_order_relaxed);
+        cycle_sizes[i].store(0, std::memory_order_relaxed);
+    }
+    copy_cycles.nodes.resize(copy_cycles.offsets[num_cycles]);
+
+    // Place every node in its cycle (in no particular order)
+    for_each_wire([&](uint32_t real_var_idx, const cycle_node& node) {
+        const size_t position =
+            copy_cycles.offsets[real_var_idx] + cycle_sizes[real_var_idx].fetch_add(1, std::memory_order_relaxed);
+        copy_cycles.nodes[position] = node;
+    });
+
+    // Order the nodes of each cycle by row and then by column, which is the order in which they appear in the trace
+    parallel_for_range(num_cycles, [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; ++i) {
+            auto cycle_begin = copy_cycles.nodes.begin() + static_cast<ptrdiff_t>(copy_cycles.offsets[i]);
+            auto cycle_end = copy_cycles.nodes.begin() + static_cast<ptrdiff_t>(copy_cycles.offsets[i + 1]);
+            std::sort(cycle_begin, cycle_end, [](const cycle_node& a, const cycle_node& b) {
+                return std::tie(a.gate_idx, a.wire_idx) < std::tie(b.gate_idx, b.wire_idx);
+            });
+        }
+    });
+
+    return copy_cycles;
+}
+
 template <class Flavor>
 void TraceToPolynomials<Flavor>::add_ecc_op_wires_to_proving_key(Builder& builder,
                                                                  typename Flavor::ProvingKey& proving_key)
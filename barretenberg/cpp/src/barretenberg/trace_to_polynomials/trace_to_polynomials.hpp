@@ -28,8 +28,8 @@ template <class Flavor> class TraceToPolynomials {
     struct TraceData {
         std::array<Polynomial, NUM_WIRES> wires;
         std::array<Polynomial, NUM_SELECTORS> selectors;
-        // A vector of sets (vectors) of addresses into the wire polynomials whose values are copy constrained
-        std::vector<CyclicPermutation> copy_cycles;
+        // Sets of addresses into the wire polynomials whose values are copy constrained
+        CopyCycles copy_cycles;
         uint32_t ram_rom_offset = 0;    // offset of the RAM/ROM block in the execution trace
         uint32_t pub_inputs_offset = 0; // offset of the public inputs block in the execution trace
 
@@ -64,11 +64,6 @@ template <class Flavor> class TraceToPolynomials {
                     }
                 }
             }
-            {
-                PROFILE_THIS_NAME("copy cycle initialization");
-
-                copy_cycles.resize(builder.get_num_variables());
-            }
         }
     };
 
@@ -115,6 +110,17 @@ template <class Flavor> class TraceToPolynomials {
                                           typename Flavor::ProvingKey& proving_key,
                                           bool is_structured = false);
 
+    /**
+     * @brief Construct the copy cycles, i.e., for each real variable, the addresses of the wires that contain it
+     * @details Two parallel passes over the wires: one counts the size of each cycle and one places the addresses. The
+     * addresses of each cycle are then sorted so that the result does not depend on the thread scheduling.
+     *
+     * @param builder
+     * @param block_offsets the offset of each block in the trace
+     * @return CopyCycles
+     */
+    static CopyCycles construct_copy_cycles(Builder& builder, const std::vector<uint32_t>& block_offsets);
+
     /**
      * @brief Construct and add the goblin ecc op wires to the proving key
      * @details The ecc op wires vanish everywhere except on the ecc op block, where they contain a copy of the ecc op
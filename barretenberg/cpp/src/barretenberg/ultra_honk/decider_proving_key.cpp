@@ -6,6 +6,7 @@
 
 #include "decider_proving_key.hpp"
 #include "barretenberg/honk/composer/permutation_lib.hpp"
+#include "barretenberg/honk/execution_trace/execution_trace_usage_tracker.hpp"
 #include "barretenberg/honk/proof_system/logderivative_library.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_circuit_builder.hpp"
 
@@ -334,6 +335,32 @@ void DeciderProvingKey_<Flavor>::move_structured_trace_overflow_to_overflow_bloc
     }
 }
 
+/**
+ * @brief Determine the rows of a structured trace on which the relations can be nonzero
+ * @details These are the same regions as those tracked by the ExecutionTraceUsageTracker for folding: the rows of the
+ * populated blocks, the rows of the databus columns (which also covers the zero row and the ecc op block) and the rows
+ * of the lookup tables, which start at the lookup block but may extend past it. In the padding in between, the wires,
+ * selectors, sigmas and ids are zero and the grand product is constant, so every relation vanishes there.
+ *
+ * @param circuit
+ */
+template <IsUltraOrMegaHonk Flavor>
+void DeciderProvingKey_<Flavor>::construct_active_ranges(const Circuit& circuit)
+    requires IsMegaFlavor<Flavor>
+{
+    std::vector<std::pair<size_t, size_t>> ranges = proving_key.active_region_data.get_ranges();
+
+    const size_t databus_size = std::max(
+        { circuit.get_calldata().size(), circuit.get_secondary_calldata().size(), circuit.get_return_data().size() });
+    const auto& busread = circuit.blocks.busread;
+    ranges.emplace_back(0, std::max(databus_size, static_cast<size_t>(busread.trace_offset + busread.size())));
+
+    const auto& lookup = circuit.blocks.lookup;
+    ranges.emplace_back(lookup.trace_offset, lookup.trace_offset + std::max(circuit.get_tables_size(), lookup.size()));
+
+    active_ranges = ExecutionTraceUsageTracker::construct_union_of_ranges(ranges);
+}
+
 template class DeciderProvingKey_<UltraFlavor>;
 template class DeciderProvingKey_<UltraZKFlavor>;
 template class DeciderProvingKey_<UltraKeccakFlavor>;
@@ -59,6 +59,9 @@ template <IsUltraOrMegaHonk Flavor> class DeciderProvingKey_ {
     size_t dyadic_circuit_size{ 0 };   // final power-of-2 circuit size
 
     size_t overflow_size{ 0 }; // size of the structured execution trace overflow
+    // Rows outside of which every relation vanishes identically, used by sumcheck to skip the padding of a structured
+    // trace. Empty if not known, in which case every row is treated as active.
+    std::vector<std::pair<size_t, size_t>> active_ranges;
 
     DeciderProvingKey_(Circuit& circuit,
                        TraceSettings trace_settings = {},
@@ -164,6 +167,13 @@ template <IsUltraOrMegaHonk Flavor> class DeciderProvingKey_ {
                                                  circuit,
                                                  dyadic_circuit_size);
         }
+
+        if constexpr (IsMegaFlavor<Flavor> && !Flavor::HasZK) {
+            if (is_structured) {
+                construct_active_ranges(circuit);
+            }
+        }
+
         { // Public inputs handling
             // Construct the public inputs array
             for (size_t i = 0; i < proving_key.num_public_inputs; ++i) {
@@ -280,6 +290,9 @@ template <IsUltraOrMegaHonk Flavor> class DeciderProvingKey_ {
 
     static void move_structured_trace_overflow_to_overflow_block(Circuit& circuit)
         requires IsMegaFlavor<Flavor>;
+
+    void construct_active_ranges(const Circuit& circuit)
+        requires IsMegaFlavor<Flavor>;
 };
 
 } // namespace bb
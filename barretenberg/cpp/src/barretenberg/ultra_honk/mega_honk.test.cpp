@@ -185,6 +185,44 @@ TYPED_TEST(MegaHonkTests, BasicStructured)
     EXPECT_TRUE(verifier.verify_proof(proof));
 }
 
+/**
+ * @brief Test that skipping the inactive rows of a structured trace in sumcheck does not change the proof
+ *
+ */
+TYPED_TEST(MegaHonkTests, StructuredSumcheckSkipsInactiveRows)
+{
+    using Flavor = TypeParam;
+    if constexpr (std::is_same_v<Flavor, MegaZKFlavor>) {
+        GTEST_SKIP() << "Skipping 'StructuredSumcheckSkipsInactiveRows' test for MegaZKFlavor.";
+    }
+    typename Flavor::CircuitBuilder builder;
+    using Prover = UltraProver_<Flavor>;
+    using Verifier = UltraVerifier_<Flavor>;
+
+    GoblinMockCircuits::construct_simple_circuit(builder);
+
+    auto builder_copy = builder;
+
+    TraceSettings trace_settings{ SMALL_TEST_STRUCTURE };
+    auto proving_key = std::make_shared<DeciderProvingKey_<Flavor>>(builder, trace_settings);
+    auto proving_key_copy = std::make_shared<DeciderProvingKey_<Flavor>>(builder_copy, trace_settings);
+    EXPECT_FALSE(proving_key->active_ranges.empty());
+    // Without active ranges, sumcheck visits every row
+    proving_key_copy->active_ranges.clear();
+
+    auto verification_key = std::make_shared<typename Flavor::VerificationKey>(proving_key->proving_key);
+    Prover prover(proving_key, verification_key);
+    auto proof = prover.construct_proof();
+
+    auto verification_key_copy = std::make_shared<typename Flavor::VerificationKey>(proving_key_copy->proving_key);
+    Prover prover_copy(proving_key_copy, verification_key_copy);
+    auto proof_copy = prover_copy.construct_proof();
+
+    Verifier verifier(verification_key);
+    EXPECT_TRUE(verifier.verify_proof(proof));
+    EXPECT_EQ(proof, proof_copy);
+}
+
 /**
  * @brief Test that increasing the virtual size of a valid set of prover polynomials still results in a valid Megahonk
  * proof
@@ -0,0 +1,169 @@
+#include "barretenberg/honk/vk_cache.hpp"
+#include "barretenberg/flavor/ultra_flavor.hpp"
+#include "barretenberg/srs/global_crs.hpp"
+#include "barretenberg/stdlib/pairing_points.hpp"
+#include "barretenberg/stdlib_circuit_builders/mock_circuits.hpp"
+#include "barretenberg/stdlib_circuit_builders/ultra_circuit_builder.hpp"
+#include "barretenberg/ultra_honk/decider_proving_key.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <gtest/gtest.h>
+
+using namespace bb;
+
+class VerificationKeyCacheTests : public ::testing::Test {
+  public:
+    using Flavor = UltraFlavor;
+    using DeciderProvingKey = DeciderProvingKey_<Flavor>;
+    using VerificationKey = Flavor::VerificationKey;
+
+    static std::shared_ptr<DeciderProvingKey> construct_proving_key(size_t num_gates)
+    {
+        UltraCircuitBuilder builder;
+        MockCircuits::add_arithmetic_gates(builder, num_gates);
+        stdlib::recursion::PairingPoints<UltraCircuitBuilder>::add_default_to_public_inputs(builder);
+        return std::make_shared<DeciderProvingKey>(builder);
+    }
+
+  protected:
+    static void SetUpTestSuite() { bb::srs::init_file_crs_factory(bb::srs::bb_crs_path()); }
+
+    void SetUp() override
+    {
+        cache_dir = std::filesystem::temp_directory_path() /
+                    ("bb_vk_cache_test_" + std::to_string(::testing::UnitTest::GetInstance()->random_seed()));
+        std::filesystem::remove_all(cache_dir);
+        VerificationKeyCache::get().set_directory(cache_dir);
+    }
+
+    void TearDown() override
+    {
+        VerificationKeyCache::get().disable();
+        std::filesystem::remove_all(cache_dir);
+    }
+
+    std::filesystem::path cache_dir;
+};
+
+/**
+ * @brief A cached verification key is identical to a freshly computed one, and is only computed once per circuit
+ */
+TEST_F(VerificationKeyCacheTests, HitReturnsSameKey)
+{
+    auto& cache = VerificationKeyCache::get();
+    const auto stats_before = cache.get_stats();
+
+    auto proving_key = construct_proving_key(10);
+    auto expected_vk = std::make_shared<VerificationKey>(proving_key->proving_key);
+
+    auto first_vk = compute_verification_key_cached<Flavor>(proving_key->proving_key);
+    auto second_vk = compute_verification_key_cached<Flavor>(construct_proving_key(10)->proving_key);
+
+    const auto stats = cache.get_stats();
+    EXPECT_EQ(stats.misses - stats_before.misses, 1);
+    EXPECT_EQ(stats.hits - stats_before.hits, 1);
+    EXPECT_EQ(*first_vk, *expected_vk);
+    EXPECT_EQ(*second_vk, *expected_vk);
+}
+
+/**
+ * @brief Circuits with a different structure do not share a cache entry
+ */
+TEST_F(VerificationKeyCacheTests, DifferentCircuitsMiss)
+{
+    auto& cache = VerificationKeyCache::get();
+    const auto stats_before = cache.get_stats();
+
+    auto vk_a = compute_verification_key_cached<Flavor>(construct_proving_key(10)->proving_key);
+    auto vk_b = compute_verification_key_cached<Flavor>(construct_proving_key(20)->proving_key);
+
+    const auto stats = cache.get_stats();
+    EXPECT_EQ(stats.misses - stats_before.misses, 2);
+    EXPECT_EQ(stats.hits - stats_before.hits, 0);
+    EXPECT_NE(*vk_a, *vk_b);
+}
+
+/**
+ * @brief The least recently used entries are evicted once the cache is over its size limit
+ */
+TEST_F(VerificationKeyCacheTests, Eviction)
+{
+    auto& cache = VerificationKeyCache::get();
+    // Small enough that only one entry fits
+    cache.set_directory(cache_dir, /*max_size_bytes=*/1);
+    const auto stats_before = cache.get_stats();
+
+    compute_verification_key_cached<Flavor>(construct_proving_key(10)->proving_key);
+    compute_verification_key_cached<Flavor>(construct_proving_key(20)->proving_key);
+
+    EXPECT_EQ(cache.get_stats().evictions - stats_before.evictions, 2);
+    EXPECT_TRUE(std::filesystem::is_empty(cache_dir));
+}
+
+/**
+ * @brief A truncated or corrupted entry is treated as a miss and removed from the cache
+ */
+TEST_F(VerificationKeyCacheTests, CorruptEntryIsMiss)
+{
+    auto& cache = VerificationKeyCache::get();
+    const std::vector<uint8_t> buffer{ 1, 2, 3, 4, 5, 6, 7, 8 };
+    const auto corruptions = std::vector<std::function<void(std::vector<uint8_t>&)>>{
+        [](auto& entry) { entry.pop_back(); },
+        [](auto& entry) { entry.back() ^= 1; },
+        [](auto& entry) { entry.front() ^= 1; },
+        [](auto& entry) { entry.push_back(0); },
+    };
+    for (const auto& corrupt : corruptions) {
+        cache.store("entry", buffer);
+        ASSERT_EQ(cache.load("entry"), buffer);
+
+        const auto path = cache_dir / "entry";
+        std::vector<uint8_t> entry(std::filesystem::file_size(path));
+        std::ifstream(path, std::ios::binary).read(reinterpret_cast<char*>(entry.data()), std::ssize(entry));
+        corrupt(entry);
+        std::ofstream(path, std::ios::binary | std::ios::trunc)
+            .write(reinterpret_cast<const char*>(entry.data()), std::ssize(entry));
+
+        const auto stats_before = cache.get_stats();
+        EXPECT_FALSE(cache.load("entry").has_value());
+        EXPECT_EQ(cache.get_stats().misses - stats_before.misses, 1);
+        EXPECT_FALSE(std::filesystem::exists(path));
+    }
+}
+
+/**
+ * @brief Entries still being written by another process are neither counted nor evicted
+ */
+TEST_F(VerificationKeyCacheTests, EvictionSkipsTemporaryFiles)
+{
+    auto& cache = VerificationKeyCache::get();
+    const auto tmp_path = cache_dir / "other_entry.tmp12345";
+    std::ofstream(tmp_path, std::ios::binary) << std::string(1000, 'x');
+    cache.set_directory(cache_dir, /*max_size_bytes=*/500);
+    const auto stats_before = cache.get_stats();
+
+    cache.store("entry", std::vector<uint8_t>(10, 1));
+
+    EXPECT_EQ(cache.get_stats().evictions - stats_before.evictions, 0);
+    EXPECT_TRUE(std::filesystem::exists(tmp_path));
+    EXPECT_TRUE(std::filesystem::exists(cache_dir / "entry"));
+}
+
+/**
+ * @brief Loading from a cache that was disabled, or whose directory was removed, is a miss
+ */
+TEST_F(VerificationKeyCacheTests, MissingDirectoryIsMiss)
+{
+    auto& cache = VerificationKeyCache::get();
+    cache.store("entry", std::vector<uint8_t>(10, 1));
+    const auto stats_before = cache.get_stats();
+
+    std::filesystem::remove_all(cache_dir);
+    EXPECT_FALSE(cache.load("entry").has_value());
+
+    cache.disable();
+    EXPECT_FALSE(cache.load("entry").has_value());
+    EXPECT_EQ(cache.get_stats().misses - stats_before.misses, 2);
+}
@@ -363,6 +363,9 @@ std::ostream& operator<<(std::ostream& os, const ExecutionOpCode& op)
     case ExecutionOpCode::TORADIXBE:
         os << "TORADIXBE";
         break;
+    case ExecutionOpCode::LAST_OPCODE_SENTINEL:
+        os << "LAST_OPCODE_SENTINEL";
+        break;
     }
     return os;
 }
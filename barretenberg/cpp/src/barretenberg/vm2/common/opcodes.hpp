@@ -151,6 +151,7 @@ enum class ExecutionOpCode {
     ECADD,
     MSM,
     TORADIXBE,
+    LAST_OPCODE_SENTINEL,
 };
 
 std::ostream& operator<<(std::ostream& os, const ExecutionOpCode& op);
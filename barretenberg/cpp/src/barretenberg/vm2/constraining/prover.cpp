@@ -11,11 +11,150 @@
 #include "barretenberg/sumcheck/sumcheck.hpp"
 #include "barretenberg/vm2/tooling/stats.hpp"
 
+#include <algorithm>
+#include <cstdint>
+#include <span>
+#include <vector>
+
 namespace bb::avm2 {
 
 using Flavor = AvmFlavor;
 using FF = Flavor::FF;
 
+namespace {
+
+using Commitment = AvmProver::Curve::AffineElement;
+using Polynomial = AvmProver::Polynomial;
+
+// Columns with at most this many non-zero values are committed to with a naive MSM.
+// Most AVM columns are empty or almost empty and pippenger is not worth it for them.
+constexpr size_t MAX_NONZEROS_FOR_NAIVE_COMMIT = 1 << 7;
+
+/**
+ * Commits to many columns at once.
+ * Empty and tiny columns are committed to in parallel, one column per task, using a naive MSM.
+ * The rest are committed to one after the other with pippenger (which is itself parallel), reusing the commitment
+ * key's runtime state, from the largest to the smallest column.
+ * The result is identical to committing to every column with commitment_key.commit().
+ */
+template <typename Polys>
+std::vector<Commitment> batch_commit(const AvmProver::PCSCommitmentKey& commitment_key, const Polys& polys)
+{
+    std::vector<const Polynomial*> columns;
+    columns.reserve(polys.size());
+    for (const auto& poly : polys) {
+        columns.push_back(&poly);
+    }
+
+    std::vector<Commitment> commitments(columns.size());
+    // Not std::vector<bool>, which is not safe to write to concurrently.
+    std::vector<uint8_t> is_committed(columns.size(), 0);
+
+    AVM_TRACK_TIME("prove/batch_commit/small_columns", ({
+                       std::span<const Commitment> srs_points = commitment_key.srs->get_monomial_points();
+                       bb::parallel_for(columns.size(), [&](size_t i) {
+                           const auto& poly = *columns[i];
+                           auto coeffs = poly.coeffs();
+                           size_t num_nonzeros = 0;
+                           for (const auto& coeff : coeffs) {
+                               num_nonzeros += coeff.is_zero() ? 0 : 1;
+                               if (num_nonzeros > MAX_NONZEROS_FOR_NAIVE_COMMIT) {
+                                   return;
+                               }
+                           }
+                           // Same check as in commitment_key.commit(), which the large columns go through.
+                           BB_ASSERT_LTE(poly.end_index(),
+                                         commitment_key.srs->get_monomial_size(),
+                                         "Polynomial size exceeds commitment key size.");
+                           AvmProver::Curve::Element result;
+                           result.self_set_infinity();
+                           for (size_t j = 0; j < coeffs.size(); j++) {
+                               if (!coeffs[j].is_zero()) {
+                                   // The SRS interleaves the points with their endomorphism points.
+                                   result +=
+                                       AvmProver::Curve::Element(srs_points[2 * (poly.start_index() + j)]) * coeffs[j];
+                               }
+                           }
+                           commitments[i] = result;
+                           is_committed[i] = 1;
+                       });
+                   }));
+
+    AVM_TRACK_TIME("prove/batch_commit/large_columns", ({
+                       std::vector<size_t> order;
+                       for (size_t i = 0; i < columns.size(); i++) {
+                           if (is_committed[i] == 0) {
+                               order.push_back(i);
+                           }
+                       }
+                       std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+                           return columns[a]->size() > columns[b]->size();
+                       });
+                       for (size_t i : order) {
+                           commitments[i] = commitment_key.commit(*columns[i]);
+                       }
+                   }));
+
+    return commitments;
+}
+
+/**
+ * Inverts in place all the non-zero values of the given columns, as if they were a single column.
+ * The values are split in chunks of about the same size and every chunk is inverted in parallel with a single
+ * field inversion (Montgomery's trick), regardless of how many columns it spans.
+ */
+void batch_invert_columns(const std::vector<std::span<FF>>& columns)
+{
+    std::vector<size_t> column_starts(columns.size() + 1, 0);
+    for (size_t i = 0; i < columns.size(); i++) {
+        column_starts[i + 1] = column_starts[i] + columns[i].size();
+    }
+    const size_t total_size = column_starts.back();
+
+    bb::parallel_for_range(total_size, [&](size_t start, size_t end) {
+        // Collect the pieces of the columns that fall in [start, end).
+        std::vector<std::span<FF>> pieces;
+        auto it = std::upper_bound(column_starts.begin(), column_starts.end(), start);
+        for (size_t col = static_cast<size_t>(std::distance(column_starts.begin(), it)) - 1;
+             col < columns.size() && column_starts[col] < end;
+             col++) {
+            const size_t from = std::max(start, column_starts[col]) - column_starts[col];
+            const size_t to = std::min(end, column_starts[col + 1]) - column_starts[col];
+            if (from < to) {
+                pieces.push_back(columns[col].subspan(from, to - from));
+            }
+        }
+
+        // Zeroes are skipped, as in FF::batch_invert.
+        std::vector<FF> partial_products;
+        partial_products.reserve(end - start);
+        FF accumulator = FF::one();
+        for (const auto& piece : pieces) {
+            for (const auto& value : piece) {
+                if (!value.is_zero()) {
+                    partial_products.push_back(accumulator);
+                    accumulator *= value;
+                }
+            }
+        }
+
+        accumulator = accumulator.invert();
+
+        size_t idx = partial_products.size();
+        for (auto piece = pieces.rbegin(); piece != pieces.rend(); ++piece) {
+            for (auto value = piece->rbegin(); value != piece->rend(); ++value) {
+                if (!value->is_zero()) {
+                    const FF inverse = accumulator * partial_products[--idx];
+                    accumulator *= *value;
+                    *value = inverse;
+                }
+            }
+        }
+    });
+}
+
+} // namespace
+
 /**
  * Create AvmProver from proving key, witness and manifest.
  *
@@ -51,8 +190,10 @@ void AvmProver::execute_wire_commitments_round()
     // logderivative phase)
     auto wire_polys = prover_polynomials.get_wires();
     const auto& labels = prover_polynomials.get_wires_labels();
+    // Commitments are computed out of order, but they must be sent in order.
+    auto commitments = batch_commit(commitment_key, wire_polys);
     for (size_t idx = 0; idx < wire_polys.size(); ++idx) {
-        transcript->send_to_verifier(labels[idx], commitment_key.commit(wire_polys[idx]));
+        transcript->send_to_verifier(labels[idx], commitments[idx]);
     }
 }
 
@@ -67,19 +208,28 @@ void AvmProver::execute_log_derivative_inverse_round()
         using Relation = std::tuple_element_t<relation_idx, Flavor::LookupRelations>;
         tasks.push_back([&]() {
             AVM_TRACK_TIME(std::string("prove/execute_log_derivative_inverse_round/") + std::string(Relation::NAME),
-                           (compute_logderivative_inverse<FF, Relation>(
+                           (compute_logderivative_inverse_denominators<FF, Relation>(
                                prover_polynomials, relation_parameters, key->circuit_size)));
         });
     });
 
-    bb::parallel_for(tasks.size(), [&](size_t i) { tasks[i](); });
+    AVM_TRACK_TIME("prove/execute_log_derivative_inverse_round/denominators",
+                   bb::parallel_for(tasks.size(), [&](size_t i) { tasks[i](); }));
+
+    // Invert all the inverse polynomials together, instead of one batch inversion per (serial) task.
+    std::vector<std::span<FF>> inverse_columns;
+    for (auto& poly : prover_polynomials.get_derived()) {
+        inverse_columns.push_back(poly.coeffs());
+    }
+    AVM_TRACK_TIME("prove/execute_log_derivative_inverse_round/batch_invert", batch_invert_columns(inverse_columns));
 }
 
 void AvmProver::execute_log_derivative_inverse_commitments_round()
 {
     // Commit to all logderivative inverse polynomials
-    for (auto [commitment, key_poly] : zip_view(witness_commitments.get_derived(), key->get_derived())) {
-        commitment = commitment_key.commit(key_poly);
+    auto commitments = batch_commit(commitment_key, key->get_derived());
+    for (auto [commitment, computed] : zip_view(witness_commitments.get_derived(), commitments)) {
+        commitment = computed;
     }
 
     // Send all commitments to the verifier
@@ -0,0 +1,53 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+
+#include "barretenberg/api/file_io.hpp"
+#include "barretenberg/vm2/common/avm_inputs.hpp"
+#include "barretenberg/vm2/simulation_helper.hpp"
+
+using namespace benchmark;
+using namespace bb::avm2;
+
+namespace {
+
+// cwd is expected to be barretenberg/cpp/build.
+AvmProvingInputs get_inputs()
+{
+    return AvmProvingInputs::from(bb::read_file("../src/barretenberg/vm2/testing/avm_inputs.testdata.bin"));
+}
+
+// Throughput of the simulation loop (instruction fetching, operand resolution and opcode dispatch), reported as
+// instructions per second.
+void BM_simulate_fast(State& state)
+{
+    const auto inputs = get_inputs();
+    const size_t num_instructions = AvmSimulationHelper(inputs.hints).simulate().execution.size();
+
+    for (auto _ : state) {
+        AvmSimulationHelper(inputs.hints).simulate_fast();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * num_instructions));
+}
+
+// Same, but also collecting the events for tracegen.
+void BM_simulate(State& state)
+{
+    const auto inputs = get_inputs();
+    size_t num_instructions = 0;
+
+    for (auto _ : state) {
+        auto events = AvmSimulationHelper(inputs.hints).simulate();
+        num_instructions += events.execution.size();
+        DoNotOptimize(events);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(num_instructions));
+}
+
+} // namespace
+
+BENCHMARK(BM_simulate_fast)->Unit(kMicrosecond);
+BENCHMARK(BM_simulate)->Unit(kMicrosecond);
+
+BENCHMARK_MAIN();
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <algorithm>
 #include <cassert>
+#include <cstddef>
 #include <vector>
 
 #include "barretenberg/vm2/common/set.hpp"
@@ -20,20 +22,44 @@ template <typename Event> class EventEmitter : public EventEmitterInterface<Even
   public:
     using Container = std::vector<Event>;
 
+    EventEmitter() = default;
+    // Reserves space for capacity_hint events upfront. The container will not reallocate (and temporarily
+    // hold two copies of all the events) until the hint is exceeded.
+    explicit EventEmitter(size_t capacity_hint) { events.reserve(capacity_hint); }
     virtual ~EventEmitter() = default;
-    void emit(Event&& event) override { events.push_back(std::move(event)); };
+    void emit(Event&& event) override
+    {
+        if (events.size() == events.capacity()) {
+            num_reallocations++;
+        }
+        events.push_back(std::move(event));
+        peak_capacity = std::max(peak_capacity, events.capacity());
+    };
 
     const Container& get_events() const { return events; }
     // Transfers ownership of the events to the caller (clears the internal container).
     Container dump_events() { return std::move(events); }
 
+    // Number of times the container had to grow while emitting.
+    size_t get_num_reallocations() const { return num_reallocations; }
+    // Peak size of the container's buffer. Does not account for heap memory owned by the events themselves.
+    size_t get_peak_memory_bytes() const { return peak_capacity * sizeof(Event); }
+
   private:
     Container events;
+    size_t num_reallocations = 0;
+    size_t peak_capacity = 0;
 };
 
 // This is an EventEmitter that eagerly deduplicates events based on a provided key.
 template <typename Event> class DeduplicatingEventEmitter : public EventEmitter<Event> {
   public:
+    DeduplicatingEventEmitter() = default;
+    explicit DeduplicatingEventEmitter(size_t capacity_hint)
+        : EventEmitter<Event>(capacity_hint)
+    {
+        elements_seen.reserve(capacity_hint);
+    }
     virtual ~DeduplicatingEventEmitter() = default;
 
     void emit(Event&& event) override
@@ -59,6 +85,9 @@ template <typename Event> class NoopEventEmitter : public EventEmitterInterface<
   public:
     using Container = std::vector<Event>;
 
+    NoopEventEmitter() = default;
+    // Accepts (and ignores) a capacity hint, so that it can stand in for an EventEmitter.
+    explicit NoopEventEmitter(size_t) {}
     virtual ~NoopEventEmitter() = default;
 
     void emit(Event&&) override{};
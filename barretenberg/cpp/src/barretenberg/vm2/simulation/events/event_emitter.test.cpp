@@ -0,0 +1,77 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+#include "barretenberg/vm2/simulation/events/event_emitter.hpp"
+
+namespace bb::avm2::simulation {
+namespace {
+
+struct TestEvent {
+    using Key = uint32_t;
+    uint32_t value;
+    uint64_t payload;
+
+    Key get_key() const { return value; }
+};
+
+TEST(EventEmitterTest, CountsReallocationsWithoutHint)
+{
+    EventEmitter<TestEvent> emitter;
+    EXPECT_EQ(emitter.get_num_reallocations(), 0);
+    EXPECT_EQ(emitter.get_peak_memory_bytes(), 0);
+
+    for (uint32_t i = 0; i < 100; i++) {
+        emitter.emit({ .value = i, .payload = i });
+    }
+
+    // The first emit and every growth after it reallocate.
+    EXPECT_GT(emitter.get_num_reallocations(), 1);
+    EXPECT_GE(emitter.get_peak_memory_bytes(), 100 * sizeof(TestEvent));
+}
+
+TEST(EventEmitterTest, NoReallocationWithinHint)
+{
+    EventEmitter<TestEvent> emitter(100);
+
+    for (uint32_t i = 0; i < 100; i++) {
+        emitter.emit({ .value = i, .payload = i });
+    }
+    EXPECT_EQ(emitter.get_num_reallocations(), 0);
+    EXPECT_EQ(emitter.get_peak_memory_bytes(), 100 * sizeof(TestEvent));
+
+    emitter.emit({ .value = 100, .payload = 100 });
+    EXPECT_EQ(emitter.get_num_reallocations(), 1);
+    EXPECT_GT(emitter.get_peak_memory_bytes(), 100 * sizeof(TestEvent));
+}
+
+TEST(EventEmitterTest, PeakSurvivesDump)
+{
+    EventEmitter<TestEvent> emitter(10);
+    for (uint32_t i = 0; i < 10; i++) {
+        emitter.emit({ .value = i, .payload = i });
+    }
+
+    EXPECT_EQ(emitter.dump_events().size(), 10);
+    EXPECT_TRUE(emitter.get_events().empty());
+    EXPECT_EQ(emitter.get_peak_memory_bytes(), 10 * sizeof(TestEvent));
+}
+
+TEST(EventEmitterTest, DeduplicatedEventsDoNotGrowContainer)
+{
+    DeduplicatingEventEmitter<TestEvent> emitter(10);
+
+    for (uint32_t round = 0; round < 3; round++) {
+        for (uint32_t i = 0; i < 10; i++) {
+            emitter.emit({ .value = i, .payload = round });
+        }
+    }
+
+    EXPECT_EQ(emitter.get_events().size(), 10);
+    EXPECT_EQ(emitter.get_num_reallocations(), 0);
+    EXPECT_EQ(emitter.get_peak_memory_bytes(), 10 * sizeof(TestEvent));
+}
+
+} // namespace
+} // namespace bb::avm2::simulation
@@ -316,65 +316,42 @@ void Execution::dispatch_opcode(ExecutionOpCode opcode,
     output = TaggedValue::from<FF>(0);
 
     debug("Dispatching opcode: ", opcode, " (", static_cast<uint32_t>(opcode), ")");
-    switch (opcode) {
-    case ExecutionOpCode::ADD:
-        call_with_operands(&Execution::add, context, resolved_operands);
-        break;
-    case ExecutionOpCode::SET:
-        call_with_operands(&Execution::set, context, resolved_operands);
-        break;
-    case ExecutionOpCode::MOV:
-        call_with_operands(&Execution::mov, context, resolved_operands);
-        break;
-    case ExecutionOpCode::CALL:
-        call_with_operands(&Execution::call, context, resolved_operands);
-        break;
-    case ExecutionOpCode::RETURN:
-        call_with_operands(&Execution::ret, context, resolved_operands);
-        break;
-    case ExecutionOpCode::JUMP:
-        call_with_operands(&Execution::jump, context, resolved_operands);
-        break;
-    case ExecutionOpCode::JUMPI:
-        call_with_operands(&Execution::jumpi, context, resolved_operands);
-        break;
-    case ExecutionOpCode::CALLDATACOPY:
-        call_with_operands(&Execution::cd_copy, context, resolved_operands);
-        break;
-    case ExecutionOpCode::RETURNDATACOPY:
-        call_with_operands(&Execution::rd_copy, context, resolved_operands);
-        break;
-    case ExecutionOpCode::INTERNALCALL:
-        call_with_operands(&Execution::internal_call, context, resolved_operands);
-        break;
-    case ExecutionOpCode::INTERNALRETURN:
-        call_with_operands(&Execution::internal_return, context, resolved_operands);
-        break;
-    case ExecutionOpCode::KECCAKF1600:
-        call_with_operands(&Execution::keccak_permutation, context, resolved_operands);
-        break;
-    default:
+    const auto opcode_index = static_cast<size_t>(opcode);
+    OpcodeHandler handler = opcode_index < dispatch_table.size() ? dispatch_table[opcode_index] : nullptr;
+    if (handler == nullptr) {
         // TODO: Make this an assertion once all execution opcodes are supported.
         vinfo("Warning: dispatch ignored for unknown execution opcode: ", static_cast<uint32_t>(opcode));
-        break;
+        return;
     }
+    handler(*this, context, resolved_operands);
 }
 
-// Some template magic to dispatch the opcode by deducing the number of arguments and types,
-// and making the appropriate checks and casts.
-template <typename... Ts>
-inline void Execution::call_with_operands(void (Execution::*f)(ContextInterface&, Ts...),
-                                          ContextInterface& context,
-                                          const std::vector<Operand>& resolved_operands)
+template <auto f>
+void Execution::dispatch_to(Execution& self, ContextInterface& context, const std::vector<Operand>& resolved_operands)
 {
-    assert(resolved_operands.size() == sizeof...(Ts));
-    auto operand_indices = std::make_index_sequence<sizeof...(Ts)>{};
-    [f, this, &context, &resolved_operands]<std::size_t... Is>(std::index_sequence<Is...>) {
-        // FIXME(fcarreiro): we go through FF here.
-        (this->*f)(context, static_cast<Ts>(resolved_operands.at(Is).as_ff())...);
-    }(operand_indices);
+    self.call_with_operands(f, context, resolved_operands);
 }
 
+const Execution::DispatchTable Execution::dispatch_table = [] {
+    DispatchTable table{};
+    auto add_handler = [&table](ExecutionOpCode opcode, OpcodeHandler handler) {
+        table[static_cast<size_t>(opcode)] = handler;
+    };
+    add_handler(ExecutionOpCode::ADD, &Execution::dispatch_to<&Execution::add>);
+    add_handler(ExecutionOpCode::SET, &Execution::dispatch_to<&Execution::set>);
+    add_handler(ExecutionOpCode::MOV, &Execution::dispatch_to<&Execution::mov>);
+    add_handler(ExecutionOpCode::CALL, &Execution::dispatch_to<&Execution::call>);
+    add_handler(ExecutionOpCode::RETURN, &Execution::dispatch_to<&Execution::ret>);
+    add_handler(ExecutionOpCode::JUMP, &Execution::dispatch_to<&Execution::jump>);
+    add_handler(ExecutionOpCode::JUMPI, &Execution::dispatch_to<&Execution::jumpi>);
+    add_handler(ExecutionOpCode::CALLDATACOPY, &Execution::dispatch_to<&Execution::cd_copy>);
+    add_handler(ExecutionOpCode::RETURNDATACOPY, &Execution::dispatch_to<&Execution::rd_copy>);
+    add_handler(ExecutionOpCode::INTERNALCALL, &Execution::dispatch_to<&Execution::internal_call>);
+    add_handler(ExecutionOpCode::INTERNALRETURN, &Execution::dispatch_to<&Execution::internal_return>);
+    add_handler(ExecutionOpCode::KECCAKF1600, &Execution::dispatch_to<&Execution::keccak_permutation>);
+    return table;
+}();
+
 void Execution::init_gas_tracker(ContextInterface& context)
 {
     assert(gas_tracker == nullptr);
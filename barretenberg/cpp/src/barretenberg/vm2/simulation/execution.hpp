@@ -1,9 +1,12 @@
 #pragma once
 
+#include <array>
+#include <cassert>
 #include <cstdint>
 #include <memory>
 #include <span>
 #include <stack>
+#include <utility>
 #include <vector>
 
 #include "barretenberg/vm2/common/aztec_types.hpp"
@@ -108,6 +111,16 @@ class Execution : public ExecutionInterface {
     void call_with_operands(void (Execution::*f)(ContextInterface&, Ts...),
                             ContextInterface& context,
                             const std::vector<Operand>& resolved_operands);
+
+    // Opcode handlers are resolved once into a table indexed by ExecutionOpCode, so that dispatching
+    // an instruction is a single indirect call instead of a switch over all opcodes.
+    // Unsupported opcodes map to nullptr.
+    friend class ExecutionDispatchTableTest;
+    using OpcodeHandler = void (*)(Execution&, ContextInterface&, const std::vector<Operand>&);
+    using DispatchTable = std::array<OpcodeHandler, static_cast<size_t>(ExecutionOpCode::LAST_OPCODE_SENTINEL)>;
+    template <auto f>
+    static void dispatch_to(Execution& self, ContextInterface& context, const std::vector<Operand>& resolved_operands);
+    static const DispatchTable dispatch_table;
     std::vector<Operand> resolve_operands(const Instruction& instruction, const ExecInstructionSpec& spec);
 
     void handle_enter_call(ContextInterface& parent_context, std::unique_ptr<ContextInterface> child_context);
@@ -142,4 +155,20 @@ class Execution : public ExecutionInterface {
     std::unique_ptr<GasTrackerInterface> gas_tracker;
 };
 
+// Some template magic to dispatch the opcode by deducing the number of arguments and types,
+// and making the appropriate checks and casts.
+// Defined in the header so that tests can call the handlers without going through the dispatch table.
+template <typename... Ts>
+inline void Execution::call_with_operands(void (Execution::*f)(ContextInterface&, Ts...),
+                                          ContextInterface& context,
+                                          const std::vector<Operand>& resolved_operands)
+{
+    assert(resolved_operands.size() == sizeof...(Ts));
+    auto operand_indices = std::make_index_sequence<sizeof...(Ts)>{};
+    [f, this, &context, &resolved_operands]<std::size_t... Is>(std::index_sequence<Is...>) {
+        // FIXME(fcarreiro): we go through FF here.
+        (this->*f)(context, static_cast<Ts>(resolved_operands.at(Is).as_ff())...);
+    }(operand_indices);
+}
+
 } // namespace bb::avm2::simulation
@@ -3,7 +3,11 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <initializer_list>
+#include <map>
 #include <memory>
+#include <sstream>
+#include <string>
 
 #include "barretenberg/vm2/common/field.hpp"
 #include "barretenberg/vm2/common/memory_types.hpp"
@@ -16,6 +20,7 @@
 #include "barretenberg/vm2/simulation/lib/instruction_info.hpp"
 #include "barretenberg/vm2/simulation/lib/serialization.hpp"
 #include "barretenberg/vm2/simulation/memory.hpp"
+#include "barretenberg/vm2/simulation/testing/mock_addressing.hpp"
 #include "barretenberg/vm2/simulation/testing/mock_alu.hpp"
 #include "barretenberg/vm2/simulation/testing/mock_bitwise.hpp"
 #include "barretenberg/vm2/simulation/testing/mock_bytecode_manager.hpp"
@@ -29,15 +34,18 @@
 #include "barretenberg/vm2/simulation/testing/mock_keccakf1600.hpp"
 #include "barretenberg/vm2/simulation/testing/mock_memory.hpp"
 #include "barretenberg/vm2/simulation/testing/mock_range_check.hpp"
+#include "barretenberg/vm2/testing/instruction_builder.hpp"
 
 namespace bb::avm2::simulation {
 namespace {
 
 using ::testing::_;
+using ::testing::AnyNumber;
 using ::testing::NiceMock;
 using ::testing::Return;
 using ::testing::ReturnRef;
 using ::testing::StrictMock;
+using ::bb::avm2::testing::InstructionBuilder;
 
 class ExecutionSimulationTest : public ::testing::Test {
   protected:
@@ -155,6 +163,318 @@ TEST_F(ExecutionSimulationTest, InternalCall)
     execution.internal_return(context);
 }
 
+// Runs a single instruction through the full execution loop, going through the opcode dispatch table.
+// The context halts right after the instruction so that the loop exits.
+class ExecutionDispatchTest : public ExecutionSimulationTest {
+  protected:
+    ExecutionEvent execute_single_instruction(const Instruction& instruction,
+                                              const std::vector<Operand>& resolved_operands,
+                                              std::unique_ptr<NiceMock<MockContext>> enqueued_context)
+    {
+        ON_CALL(bytecode_manager, read_instruction).WillByDefault(Return(instruction));
+        ON_CALL(*enqueued_context, get_bytecode_manager).WillByDefault(ReturnRef(bytecode_manager));
+        ON_CALL(*enqueued_context, get_memory).WillByDefault(ReturnRef(memory));
+        ON_CALL(*enqueued_context, halted).WillByDefault(Return(true));
+
+        EXPECT_CALL(execution_components, make_gas_tracker(_))
+            .WillOnce(Return(std::make_unique<NiceMock<MockGasTracker>>()));
+        auto addressing = std::make_unique<StrictMock<MockAddressing>>();
+        EXPECT_CALL(*addressing, resolve(instruction, _)).WillOnce(Return(resolved_operands));
+        EXPECT_CALL(execution_components, make_addressing(_)).WillOnce(Return(std::move(addressing)));
+        EXPECT_CALL(context_provider, get_next_context_id);
+        EXPECT_CALL(execution_id_manager, increment_execution_id);
+
+        execution.execute(std::move(enqueued_context));
+
+        auto events = execution_event_emitter.dump_events();
+        EXPECT_EQ(events.size(), 1);
+        return events.empty() ? ExecutionEvent{} : events.front();
+    }
+
+    NiceMock<MockBytecodeManager> bytecode_manager;
+};
+
+TEST_F(ExecutionDispatchTest, DispatchesToHandler)
+{
+    const auto instruction = InstructionBuilder(WireOpCode::JUMP_32).operand<uint32_t>(42).build();
+
+    auto enqueued_context = std::make_unique<NiceMock<MockContext>>();
+    EXPECT_CALL(*enqueued_context, set_next_pc(_)).Times(AnyNumber());
+    EXPECT_CALL(*enqueued_context, set_next_pc(42));
+
+    ExecutionEvent event =
+        execute_single_instruction(instruction, { Operand::from<uint32_t>(42) }, std::move(enqueued_context));
+    EXPECT_EQ(event.error, ExecutionError::NONE);
+    EXPECT_EQ(event.wire_instruction, instruction);
+}
+
+TEST_F(ExecutionDispatchTest, UnsupportedOpcodeIsIgnored)
+{
+    // SUB has no handler yet. Dispatching it should be a no-op rather than an error.
+    const auto instruction =
+        InstructionBuilder(WireOpCode::SUB_8).operand<uint8_t>(1).operand<uint8_t>(2).operand<uint8_t>(3).build();
+
+    auto enqueued_context = std::make_unique<NiceMock<MockContext>>();
+    ExecutionEvent event = execute_single_instruction(
+        instruction,
+        { Operand::from<uint8_t>(1), Operand::from<uint8_t>(2), Operand::from<uint8_t>(3) },
+        std::move(enqueued_context));
+    EXPECT_EQ(event.error, ExecutionError::NONE);
+    EXPECT_TRUE(event.inputs.empty());
+}
+
+// An execution whose collaborators record, in order, every call that a handler makes into them.
+// Every memory address holds a different value, so that a handler reading the wrong operand is noticed.
+class RecordingExecution {
+  public:
+    RecordingExecution()
+    {
+        ON_CALL(context, get_memory).WillByDefault(ReturnRef(memory));
+        ON_CALL(context, get_internal_call_stack_manager).WillByDefault(ReturnRef(internal_call_stack_manager));
+        ON_CALL(context, get_address).WillByDefault(ReturnRef(address));
+        ON_CALL(context, get_msg_sender).WillByDefault(ReturnRef(msg_sender));
+        ON_CALL(context, get_next_pc).WillByDefault(Return(100));
+        ON_CALL(context, get_gas_used).WillByDefault(Return(Gas{ 10, 20 }));
+        ON_CALL(context, set_next_pc).WillByDefault([this](uint32_t pc) { record("set_next_pc", pc); });
+        ON_CALL(context, halt).WillByDefault([this] { record("halt"); });
+
+        ON_CALL(memory, get).WillByDefault([this](MemoryAddress addr) -> const MemoryValue& {
+            record("memory.get", addr);
+            return memory_values.try_emplace(addr, MemoryValue::from<uint32_t>(addr + 1)).first->second;
+        });
+        ON_CALL(memory, set).WillByDefault([this](MemoryAddress addr, MemoryValue value) {
+            record("memory.set", addr, value.to_string());
+        });
+        ON_CALL(alu, add).WillByDefault([this](const MemoryValue& a, const MemoryValue& b) {
+            record("alu.add", a.to_string(), b.to_string());
+            return MemoryValue::from<uint32_t>(a.as<uint32_t>() + b.as<uint32_t>());
+        });
+        ON_CALL(data_copy, cd_copy)
+            .WillByDefault([this](ContextInterface&, uint32_t size, uint32_t offset, uint32_t dst) {
+                record("data_copy.cd_copy", size, offset, dst);
+            });
+        ON_CALL(data_copy, rd_copy)
+            .WillByDefault([this](ContextInterface&, uint32_t size, uint32_t offset, uint32_t dst) {
+                record("data_copy.rd_copy", size, offset, dst);
+            });
+        ON_CALL(keccakf1600, permutation).WillByDefault([this](MemoryInterface&, MemoryAddress dst, MemoryAddress src) {
+            record("keccakf1600.permutation", dst, src);
+        });
+        ON_CALL(internal_call_stack_manager, push).WillByDefault([this](PC pc) { record("internal_call.push", pc); });
+        ON_CALL(internal_call_stack_manager, pop).WillByDefault([this] {
+            record("internal_call.pop");
+            return 200;
+        });
+        ON_CALL(context_provider, make_nested_context)
+            .WillByDefault([this](AztecAddress address,
+                                  AztecAddress msg_sender,
+                                  ContextInterface&,
+                                  MemoryAddress cd_offset_addr,
+                                  MemoryAddress cd_size_addr,
+                                  bool is_static,
+                                  Gas gas_limit) -> std::unique_ptr<ContextInterface> {
+                record("make_nested_context",
+                       address,
+                       msg_sender,
+                       cd_offset_addr,
+                       cd_size_addr,
+                       is_static,
+                       gas_limit.l2Gas,
+                       gas_limit.daGas);
+                return std::make_unique<NiceMock<MockContext>>();
+            });
+        ON_CALL(execution_components, make_gas_tracker)
+            .WillByDefault([this](ContextInterface&) -> std::unique_ptr<GasTrackerInterface> {
+                auto gas_tracker = std::make_unique<NiceMock<MockGasTracker>>();
+                ON_CALL(*gas_tracker, consume_dynamic_gas).WillByDefault([this](Gas gas) {
+                    record("gas.consume_dynamic_gas", gas.l2Gas, gas.daGas);
+                });
+                ON_CALL(*gas_tracker, compute_gas_limit_for_call).WillByDefault([this](Gas gas) {
+                    record("gas.compute_gas_limit_for_call", gas.l2Gas, gas.daGas);
+                    return Gas{ gas.l2Gas / 2, gas.daGas / 2 };
+                });
+                return gas_tracker;
+            });
+        execution.init_gas_tracker(context);
+    }
+
+    template <typename... Args> void record(const std::string& name, const Args&... args)
+    {
+        std::ostringstream call;
+        call << name << "(";
+        ((call << args << ","), ...);
+        call << ")";
+        calls.push_back(call.str());
+    }
+
+    std::vector<std::string> calls;
+
+    NiceMock<MockContext> context;
+    NiceMock<MockMemory> memory;
+    NiceMock<MockAlu> alu;
+    NiceMock<MockDataCopy> data_copy;
+    NiceMock<MockKeccakF1600> keccakf1600;
+    NiceMock<MockInternalCallStackManager> internal_call_stack_manager;
+    NiceMock<MockContextProvider> context_provider;
+    NiceMock<MockExecutionComponentsProvider> execution_components;
+    NiceMock<MockExecutionIdManager> execution_id_manager;
+    InstructionInfoDB instruction_info_db;
+    EventEmitter<ExecutionEvent> execution_event_emitter;
+    EventEmitter<ContextStackEvent> context_stack_event_emitter;
+    AztecAddress address = 0xc0ffee;
+    AztecAddress msg_sender = 0xdeadbeef;
+    std::map<MemoryAddress, MemoryValue> memory_values;
+    Execution execution = Execution(alu,
+                                    data_copy,
+                                    execution_components,
+                                    context_provider,
+                                    instruction_info_db,
+                                    execution_id_manager,
+                                    execution_event_emitter,
+                                    context_stack_event_emitter,
+                                    keccakf1600);
+};
+
+// Resolved operands for the opcodes that have a handler. Every other opcode gets three operands.
+std::vector<Operand> operands_for(ExecutionOpCode opcode)
+{
+    auto u32s = [](std::initializer_list<uint32_t> values) {
+        std::vector<Operand> operands;
+        for (uint32_t value : values) {
+            operands.push_back(Operand::from<uint32_t>(value));
+        }
+        return operands;
+    };
+    switch (opcode) {
+    case ExecutionOpCode::SET:
+        return { Operand::from<uint32_t>(1), Operand::from<uint8_t>(static_cast<uint8_t>(ValueTag::U32)),
+                 Operand::from<FF>(42) };
+    case ExecutionOpCode::MOV:
+    case ExecutionOpCode::RETURN:
+    case ExecutionOpCode::JUMPI:
+    case ExecutionOpCode::KECCAKF1600:
+        return u32s({ 1, 2 });
+    case ExecutionOpCode::CALL:
+        return u32s({ 1, 2, 3, 4, 5 });
+    case ExecutionOpCode::JUMP:
+    case ExecutionOpCode::INTERNALCALL:
+        return u32s({ 7 });
+    case ExecutionOpCode::INTERNALRETURN:
+        return {};
+    default:
+        return u32s({ 1, 2, 3 });
+    }
+}
+
 } // namespace
 
+// Runs every execution opcode through the dispatch table and through the switch statement it replaced, and expects
+// both to call the same handler: the same calls into the collaborators and the same event data.
+// It is not in the anonymous namespace, because Execution befriends it.
+class ExecutionDispatchTableTest : public ::testing::Test {
+  protected:
+    // What a handler leaves behind for the execution event and for the caller of execute().
+    struct DispatchResult {
+        std::vector<TaggedValue> inputs;
+        TaggedValue output;
+        std::vector<std::string> calls;
+    };
+
+    static DispatchResult dispatch_with_table(ExecutionOpCode opcode)
+    {
+        RecordingExecution recording;
+        recording.execution.dispatch_opcode(opcode, recording.context, operands_for(opcode));
+        return get_result(recording);
+    }
+
+    // The switch in Execution::dispatch_opcode before the dispatch table.
+    static DispatchResult dispatch_with_switch(ExecutionOpCode opcode)
+    {
+        RecordingExecution recording;
+        Execution& execution = recording.execution;
+        ContextInterface& context = recording.context;
+        const std::vector<Operand> resolved_operands = operands_for(opcode);
+
+        execution.inputs = {};
+        execution.output = TaggedValue::from<FF>(0);
+        switch (opcode) {
+        case ExecutionOpCode::ADD:
+            execution.call_with_operands(&Execution::add, context, resolved_operands);
+            break;
+        case ExecutionOpCode::SET:
+            execution.call_with_operands(&Execution::set, context, resolved_operands);
+            break;
+        case ExecutionOpCode::MOV:
+            execution.call_with_operands(&Execution::mov, context, resolved_operands);
+            break;
+        case ExecutionOpCode::CALL:
+            execution.call_with_operands(&Execution::call, context, resolved_operands);
+            break;
+        case ExecutionOpCode::RETURN:
+            execution.call_with_operands(&Execution::ret, context, resolved_operands);
+            break;
+        case ExecutionOpCode::JUMP:
+            execution.call_with_operands(&Execution::jump, context, resolved_operands);
+            break;
+        case ExecutionOpCode::JUMPI:
+            execution.call_with_operands(&Execution::jumpi, context, resolved_operands);
+            break;
+        case ExecutionOpCode::CALLDATACOPY:
+            execution.call_with_operands(&Execution::cd_copy, context, resolved_operands);
+            break;
+        case ExecutionOpCode::RETURNDATACOPY:
+            execution.call_with_operands(&Execution::rd_copy, context, resolved_operands);
+            break;
+        case ExecutionOpCode::INTERNALCALL:
+            execution.call_with_operands(&Execution::internal_call, context, resolved_operands);
+            break;
+        case ExecutionOpCode::INTERNALRETURN:
+            execution.call_with_operands(&Execution::internal_return, context, resolved_operands);
+            break;
+        case ExecutionOpCode::KECCAKF1600:
+            execution.call_with_operands(&Execution::keccak_permutation, context, resolved_operands);
+            break;
+        default:
+            break;
+        }
+        return get_result(recording);
+    }
+
+    static DispatchResult get_result(RecordingExecution& recording)
+    {
+        Execution& execution = recording.execution;
+        const ExecutionResult exec_result = execution.get_execution_result();
+        recording.record("execution_result",
+                         exec_result.rd_offset,
+                         exec_result.rd_size,
+                         exec_result.gas_used.l2Gas,
+                         exec_result.gas_used.daGas,
+                         exec_result.success);
+        recording.record("external_call_stack", execution.external_call_stack.size());
+        for (const auto& event : recording.context_stack_event_emitter.dump_events()) {
+            recording.record("context_stack_event",
+                             event.id,
+                             event.parent_id,
+                             event.entered_context_id,
+                             event.next_pc,
+                             event.msg_sender,
+                             event.contract_addr,
+                             event.is_static);
+        }
+        return { .inputs = execution.get_inputs(), .output = execution.get_output(), .calls = recording.calls };
+    }
+};
+
+TEST_F(ExecutionDispatchTableTest, MatchesSwitch)
+{
+    for (size_t i = 0; i < static_cast<size_t>(ExecutionOpCode::LAST_OPCODE_SENTINEL); i++) {
+        const auto opcode = static_cast<ExecutionOpCode>(i);
+        const DispatchResult from_table = dispatch_with_table(opcode);
+        const DispatchResult from_switch = dispatch_with_switch(opcode);
+        EXPECT_EQ(from_table.calls, from_switch.calls) << "opcode " << opcode;
+        EXPECT_EQ(from_table.inputs, from_switch.inputs) << "opcode " << opcode;
+        EXPECT_EQ(from_table.output, from_switch.output) << "opcode " << opcode;
+    }
+}
+
 } // namespace bb::avm2::simulation
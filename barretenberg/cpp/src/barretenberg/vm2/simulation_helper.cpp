@@ -1,6 +1,14 @@
 #include "barretenberg/vm2/simulation_helper.hpp"
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
+#include <mutex>
+#include <optional>
+
+#ifndef __wasm__
+#include <sys/resource.h>
+#endif
 
 #include "barretenberg/common/log.hpp"
 #include "barretenberg/vm2/common/avm_inputs.hpp"
@@ -51,6 +59,7 @@
 #include "barretenberg/vm2/simulation/to_radix.hpp"
 #include "barretenberg/vm2/simulation/tx_execution.hpp"
 #include "barretenberg/vm2/simulation/update_check.hpp"
+#include "barretenberg/vm2/tooling/stats.hpp"
 
 namespace bb::avm2 {
 
@@ -70,32 +79,136 @@ struct FastSettings {
     template <typename E> using DefaultDeduplicatingEventEmitter = NoopEventEmitter<E>;
 };
 
+// Reports the number of events and how much the event container had to grow during simulation.
+// No-op for emitters that do not collect events.
+template <typename Emitter>
+void track_emitter_stats([[maybe_unused]] const std::string& name, [[maybe_unused]] const Emitter& emitter)
+{
+    if constexpr (requires { emitter.get_num_reallocations(); }) {
+        if (!Stats::get().is_enabled()) {
+            return;
+        }
+        Stats::get().increment("simulation/events/" + name + "/count", emitter.get_events().size());
+        Stats::get().increment("simulation/events/" + name + "/reallocations", emitter.get_num_reallocations());
+        Stats::get().increment("simulation/events/" + name + "/peak_bytes", emitter.get_peak_memory_bytes());
+    }
+}
+
+// Peak resident set size of the process so far, in kilobytes.
+uint64_t get_peak_rss_kb()
+{
+#ifndef __wasm__
+    rusage usage{};
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+#ifdef __APPLE__
+        return static_cast<uint64_t>(usage.ru_maxrss) / 1024;
+#else
+        return static_cast<uint64_t>(usage.ru_maxrss);
+#endif
+    }
+#endif
+    return 0;
+}
+
+// Number of events of the high-volume event types.
+struct EventCounts {
+    size_t execution = 0;
+    size_t alu = 0;
+    size_t bitwise = 0;
+    size_t memory = 0;
+    size_t instruction_fetching = 0;
+    size_t poseidon2_hash = 0;
+    size_t poseidon2_perm = 0;
+    size_t to_radix = 0;
+    size_t field_gt = 0;
+    size_t merkle_check = 0;
+    size_t range_check = 0;
+
+    // The mean of both counts, field by field
+    EventCounts averaged_with(const EventCounts& other) const
+    {
+        return {
+            .execution = (execution + other.execution) / 2,
+            .alu = (alu + other.alu) / 2,
+            .bitwise = (bitwise + other.bitwise) / 2,
+            .memory = (memory + other.memory) / 2,
+            .instruction_fetching = (instruction_fetching + other.instruction_fetching) / 2,
+            .poseidon2_hash = (poseidon2_hash + other.poseidon2_hash) / 2,
+            .poseidon2_perm = (poseidon2_perm + other.poseidon2_perm) / 2,
+            .to_radix = (to_radix + other.to_radix) / 2,
+            .field_gt = (field_gt + other.field_gt) / 2,
+            .merkle_check = (merkle_check + other.merkle_check) / 2,
+            .range_check = (range_check + other.range_check) / 2,
+        };
+    }
+};
+
+// Estimated event counts of the next full simulation in this process (e.g. the next request of bb serve), used as the
+// capacity hints of its emitters so that similarly sized transactions do not regrow (and copy) the large event
+// containers several times over. The estimate is a running average in which each simulation loses half of its weight
+// with every later one, so an unusually large transaction only inflates the next few hints. The first simulation
+// starts from empty containers.
+std::mutex event_count_estimate_mutex;
+std::optional<EventCounts> event_count_estimate;
+
+EventCounts get_event_count_estimate()
+{
+    std::lock_guard lock(event_count_estimate_mutex);
+    return event_count_estimate.value_or(EventCounts{});
+}
+
+void record_event_counts(const EventCounts& counts)
+{
+    std::lock_guard lock(event_count_estimate_mutex);
+    event_count_estimate = event_count_estimate ? event_count_estimate->averaged_with(counts) : counts;
+}
+
+// Upper bound on the storage reserved up front for each event type. Beyond it, containers grow as they fill.
+constexpr size_t MAX_CAPACITY_HINT_BYTES = static_cast<size_t>(64) << 20;
+
+template <typename Event> size_t capacity_hint(size_t estimated_num_events)
+{
+    return std::min(estimated_num_events, MAX_CAPACITY_HINT_BYTES / sizeof(Event));
+}
+
 } // namespace
 
 template <typename S> EventsContainer AvmSimulationHelper::simulate_with_settings()
 {
-    typename S::template DefaultEventEmitter<ExecutionEvent> execution_emitter;
-    typename S::template DefaultDeduplicatingEventEmitter<AluEvent> alu_emitter;
-    typename S::template DefaultEventEmitter<BitwiseEvent> bitwise_emitter;
+    const uint64_t initial_peak_rss_kb = get_peak_rss_kb();
+    const EventCounts estimate = get_event_count_estimate();
+
+    typename S::template DefaultEventEmitter<ExecutionEvent> execution_emitter(
+        capacity_hint<ExecutionEvent>(estimate.execution));
+    typename S::template DefaultDeduplicatingEventEmitter<AluEvent> alu_emitter(capacity_hint<AluEvent>(estimate.alu));
+    typename S::template DefaultEventEmitter<BitwiseEvent> bitwise_emitter(
+        capacity_hint<BitwiseEvent>(estimate.bitwise));
     typename S::template DefaultEventEmitter<DataCopyEvent> data_copy_emitter;
-    typename S::template DefaultEventEmitter<MemoryEvent> memory_emitter;
+    typename S::template DefaultEventEmitter<MemoryEvent> memory_emitter(capacity_hint<MemoryEvent>(estimate.memory));
     typename S::template DefaultEventEmitter<BytecodeRetrievalEvent> bytecode_retrieval_emitter;
     typename S::template DefaultEventEmitter<BytecodeHashingEvent> bytecode_hashing_emitter;
     typename S::template DefaultEventEmitter<BytecodeDecompositionEvent> bytecode_decomposition_emitter;
-    typename S::template DefaultDeduplicatingEventEmitter<InstructionFetchingEvent> instruction_fetching_emitter;
+    typename S::template DefaultDeduplicatingEventEmitter<InstructionFetchingEvent> instruction_fetching_emitter(
+        capacity_hint<InstructionFetchingEvent>(estimate.instruction_fetching));
     typename S::template DefaultEventEmitter<AddressDerivationEvent> address_derivation_emitter;
     typename S::template DefaultEventEmitter<ClassIdDerivationEvent> class_id_derivation_emitter;
     typename S::template DefaultEventEmitter<SiloingEvent> siloing_emitter;
     typename S::template DefaultEventEmitter<Sha256CompressionEvent> sha256_compression_emitter;
     typename S::template DefaultEventEmitter<EccAddEvent> ecc_add_emitter;
     typename S::template DefaultEventEmitter<ScalarMulEvent> scalar_mul_emitter;
-    typename S::template DefaultEventEmitter<Poseidon2HashEvent> poseidon2_hash_emitter;
-    typename S::template DefaultEventEmitter<Poseidon2PermutationEvent> poseidon2_perm_emitter;
+    typename S::template DefaultEventEmitter<Poseidon2HashEvent> poseidon2_hash_emitter(
+        capacity_hint<Poseidon2HashEvent>(estimate.poseidon2_hash));
+    typename S::template DefaultEventEmitter<Poseidon2PermutationEvent> poseidon2_perm_emitter(
+        capacity_hint<Poseidon2PermutationEvent>(estimate.poseidon2_perm));
     typename S::template DefaultEventEmitter<KeccakF1600Event> keccakf1600_emitter;
-    typename S::template DefaultEventEmitter<ToRadixEvent> to_radix_emitter;
-    typename S::template DefaultEventEmitter<FieldGreaterThanEvent> field_gt_emitter;
-    typename S::template DefaultEventEmitter<MerkleCheckEvent> merkle_check_emitter;
-    typename S::template DefaultDeduplicatingEventEmitter<RangeCheckEvent> range_check_emitter;
+    typename S::template DefaultEventEmitter<ToRadixEvent> to_radix_emitter(
+        capacity_hint<ToRadixEvent>(estimate.to_radix));
+    typename S::template DefaultEventEmitter<FieldGreaterThanEvent> field_gt_emitter(
+        capacity_hint<FieldGreaterThanEvent>(estimate.field_gt));
+    typename S::template DefaultEventEmitter<MerkleCheckEvent> merkle_check_emitter(
+        capacity_hint<MerkleCheckEvent>(estimate.merkle_check));
+    typename S::template DefaultDeduplicatingEventEmitter<RangeCheckEvent> range_check_emitter(
+        capacity_hint<RangeCheckEvent>(estimate.range_check));
     typename S::template DefaultEventEmitter<ContextStackEvent> context_stack_emitter;
     typename S::template DefaultEventEmitter<PublicDataTreeCheckEvent> public_data_tree_check_emitter;
     typename S::template DefaultEventEmitter<UpdateCheckEvent> update_check_emitter;
@@ -166,6 +279,37 @@ template <typename S> EventsContainer AvmSimulationHelper::simulate_with_setting
 
     tx_execution.simulate(hints.tx);
 
+    track_emitter_stats("execution", execution_emitter);
+    track_emitter_stats("alu", alu_emitter);
+    track_emitter_stats("bitwise", bitwise_emitter);
+    track_emitter_stats("memory", memory_emitter);
+    track_emitter_stats("instruction_fetching", instruction_fetching_emitter);
+    track_emitter_stats("poseidon2_hash", poseidon2_hash_emitter);
+    track_emitter_stats("poseidon2_perm", poseidon2_perm_emitter);
+    track_emitter_stats("to_radix", to_radix_emitter);
+    track_emitter_stats("field_gt", field_gt_emitter);
+    track_emitter_stats("merkle_check", merkle_check_emitter);
+    track_emitter_stats("range_check", range_check_emitter);
+
+    if constexpr (requires { execution_emitter.get_events(); }) {
+        // How far simulation (including the reserved event containers) pushed the peak memory of the process. Unlike
+        // the peak_bytes of the containers, this is the memory effect of the capacity hints as the OS sees it.
+        Stats::get().increment("simulation/peak_rss_growth_kb", get_peak_rss_kb() - initial_peak_rss_kb);
+        record_event_counts({
+            .execution = execution_emitter.get_events().size(),
+            .alu = alu_emitter.get_events().size(),
+            .bitwise = bitwise_emitter.get_events().size(),
+            .memory = memory_emitter.get_events().size(),
+            .instruction_fetching = instruction_fetching_emitter.get_events().size(),
+            .poseidon2_hash = poseidon2_hash_emitter.get_events().size(),
+            .poseidon2_perm = poseidon2_perm_emitter.get_events().size(),
+            .to_radix = to_radix_emitter.get_events().size(),
+            .field_gt = field_gt_emitter.get_events().size(),
+            .merkle_check = merkle_check_emitter.get_events().size(),
+            .range_check = range_check_emitter.get_events().size(),
+        });
+    }
+
     return {
         tx_event_emitter.dump_events(),
         execution_emitter.dump_events(),
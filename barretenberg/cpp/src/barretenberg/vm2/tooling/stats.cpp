@@ -1,12 +1,25 @@
 #include "barretenberg/vm2/tooling/stats.hpp"
 
+#include <algorithm>
 #include <chrono>
 #include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <sstream>
 #include <string>
 #include <vector>
 
 namespace bb::avm2 {
 
+Stats::Stats()
+{
+#ifndef NDEBUG
+    enabled = true;
+#else
+    enabled = std::getenv("AVM_STATS") != nullptr;
+#endif
+}
+
 Stats& Stats::get()
 {
     static Stats stats;
@@ -15,41 +28,101 @@ Stats& Stats::get()
 
 void Stats::reset()
 {
-    stats.clear();
+    std::lock_guard lock(registry_mutex);
+    for (auto& counters : thread_counters) {
+        for (auto& counter : *counters) {
+            counter.store(0, std::memory_order_relaxed);
+        }
+    }
 }
 
-void Stats::increment(const std::string& key, uint64_t value)
+Stats::Key Stats::intern(const std::string& key)
 {
-    std::lock_guard lock(stats_mutex);
-    stats[key] += value;
+    return intern(key, /*is_timer=*/false);
 }
 
-void Stats::time(const std::string& key, const std::function<void()>& f)
+Stats::Key Stats::intern_timer(const std::string& key)
 {
-    auto start = std::chrono::system_clock::now();
-    f();
-    auto elapsed = std::chrono::system_clock::now() - start;
-    increment(key + "_ms",
-              static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count()));
+    return intern(key + "_ms", /*is_timer=*/true);
 }
 
-std::string Stats::to_string(int depth) const
+Stats::Key Stats::intern(const std::string& name, bool is_timer)
 {
-    std::lock_guard lock(stats_mutex);
+    std::lock_guard lock(registry_mutex);
+    auto it = key_ids.find(name);
+    if (it != key_ids.end()) {
+        return it->second;
+    }
+    if (keys.size() == MAX_KEYS - 1) {
+        // Out of keys. Everything else gets accumulated into the last one.
+        keys.push_back({ .name = "stats/overflow", .is_timer = false });
+    }
+    if (keys.size() == MAX_KEYS) {
+        return static_cast<Key>(MAX_KEYS - 1);
+    }
+    auto id = static_cast<Key>(keys.size());
+    keys.push_back({ .name = name, .is_timer = is_timer });
+    key_ids.emplace(name, id);
+    return id;
+}
 
-    std::vector<std::string> result;
-    result.reserve(stats.size());
-    for (const auto& [key, value] : stats) {
-        if (std::count(key.begin(), key.end(), '/') < depth) {
-            result.push_back(key + ": " + std::to_string(value));
+Stats::Counters& Stats::local_counters()
+{
+    // Each thread gets its own block of counters the first time it records something.
+    // The blocks are owned by the Stats object, so that values survive the thread.
+    thread_local Counters* counters = nullptr;
+    if (counters == nullptr) {
+        auto new_counters = std::make_unique<Counters>();
+        counters = new_counters.get();
+        std::lock_guard lock(registry_mutex);
+        thread_counters.push_back(std::move(new_counters));
+    }
+    return *counters;
+}
+
+std::vector<std::pair<std::string, double>> Stats::collect() const
+{
+    std::lock_guard lock(registry_mutex);
+
+    std::vector<std::pair<std::string, double>> result;
+    result.reserve(keys.size());
+    for (size_t key = 0; key < keys.size(); ++key) {
+        uint64_t total = 0;
+        for (const auto& counters : thread_counters) {
+            total += (*counters)[key].load(std::memory_order_relaxed);
+        }
+        if (total == 0) {
+            continue;
         }
+        const auto& info = keys[key];
+        result.emplace_back(info.name, info.is_timer ? static_cast<double>(total) / 1e6 : static_cast<double>(total));
     }
     std::sort(result.begin(), result.end());
+    return result;
+}
+
+std::string Stats::to_string(int depth) const
+{
     std::string joined;
-    for (auto& s : result) {
-        joined += std::move(s) + "\n";
+    for (const auto& [key, value] : collect()) {
+        if (std::count(key.begin(), key.end(), '/') < depth) {
+            joined += key + ": " + std::to_string(static_cast<uint64_t>(value)) + "\n";
+        }
     }
     return joined;
 }
 
-} // namespace bb::avm2
\ No newline at end of file
+std::string Stats::to_json() const
+{
+    std::ostringstream os;
+    os << std::fixed << std::setprecision(3) << "{";
+    bool first = true;
+    for (const auto& [key, value] : collect()) {
+        os << (first ? "" : ",") << "\n  \"" << key << "\": " << value;
+        first = false;
+    }
+    os << "\n}\n";
+    return os.str();
+}
+
+} // namespace bb::avm2
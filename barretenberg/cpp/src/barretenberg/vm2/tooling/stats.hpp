@@ -1,43 +1,91 @@
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <chrono>
 #include <cstdint>
-#include <functional>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
-// To enable stats tracking, compile in RelWithAssert mode.
-// cmake --preset $PRESET -DCMAKE_BUILD_TYPE=RelWithAssert
-#ifndef NDEBUG
-#define AVM_TRACK_STATS
-#endif
+// Stats are always compiled in, but they are only collected when enabled at runtime.
+// They are enabled by default in debug builds. Otherwise, set the AVM_STATS environment variable
+// or call Stats::get().enable().
+
+// Interns a key once per call site (and per template instantiation). The key must not depend on local variables.
+#define AVM_STATS_KEY(key)                                                                                             \
+    ([]() {                                                                                                            \
+        static const auto interned_key = ::bb::avm2::Stats::get().intern(key);                                        \
+        return interned_key;                                                                                           \
+    }())
+#define AVM_STATS_TIMER_KEY(key)                                                                                       \
+    ([]() {                                                                                                            \
+        static const auto interned_key = ::bb::avm2::Stats::get().intern_timer(key);                                  \
+        return interned_key;                                                                                           \
+    }())
 
-#ifdef AVM_TRACK_STATS
 // For tracking time spent in a block of code.
-#define AVM_TRACK_TIME(key, body) ::bb::avm2::Stats::get().time(key, [&]() { body; });
+#define AVM_TRACK_TIME(key, body) ::bb::avm2::Stats::get().time(AVM_STATS_TIMER_KEY(key), [&]() { body; });
 // For tracking time spent in a block of code and returning a value.
-#define AVM_TRACK_TIME_V(key, body) ::bb::avm2::Stats::get().template time_r(key, [&]() { return body; });
-#else
-#define AVM_TRACK_TIME(key, body) body
-#define AVM_TRACK_TIME_V(key, body) body
-#endif
+#define AVM_TRACK_TIME_V(key, body)                                                                                    \
+    ::bb::avm2::Stats::get().time_r(AVM_STATS_TIMER_KEY(key), [&]() { return body; });
 
 namespace bb::avm2 {
 
+// Collects counters and timers. Updates are lock-free: every thread accumulates into its own block of counters,
+// and the blocks are only aggregated when the stats are read.
 class Stats {
   public:
+    using Key = uint32_t;
+    static constexpr size_t MAX_KEYS = 1 << 12;
+
     static Stats& get();
+
+    void enable(bool enable = true) { enabled.store(enable, std::memory_order_relaxed); }
+    bool is_enabled() const { return enabled.load(std::memory_order_relaxed); }
+    // Zeroes all the counters. Interned keys stay valid.
     void reset();
-    void increment(const std::string& key, uint64_t value);
-    void time(const std::string& key, const std::function<void()>& f);
 
-    template <typename F> auto time_r(const std::string& key, F&& f)
+    // Interning takes a lock. Do it once per call site (see AVM_STATS_KEY) and not in hot loops.
+    Key intern(const std::string& key);
+    // Timers accumulate nanoseconds and are reported in milliseconds, as "<key>_ms".
+    Key intern_timer(const std::string& key);
+
+    void increment(Key key, uint64_t value)
+    {
+        if (is_enabled()) {
+            local_counters()[key].fetch_add(value, std::memory_order_relaxed);
+        }
+    }
+    // Slower version that interns the key on every call.
+    void increment(const std::string& key, uint64_t value)
+    {
+        if (is_enabled()) {
+            increment(intern(key), value);
+        }
+    }
+
+    template <typename F> void time(Key key, F&& f)
     {
-        auto start = std::chrono::system_clock::now();
+        if (!is_enabled()) {
+            f();
+            return;
+        }
+        auto start = std::chrono::steady_clock::now();
+        f();
+        add_elapsed(key, start);
+    }
+
+    template <typename F> auto time_r(Key key, F&& f)
+    {
+        if (!is_enabled()) {
+            return f();
+        }
+        auto start = std::chrono::steady_clock::now();
         auto result = f();
-        auto elapsed = std::chrono::system_clock::now() - start;
-        increment(key + "_ms",
-                  static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count()));
+        add_elapsed(key, start);
         return result;
     }
 
@@ -46,12 +94,35 @@ class Stats {
     // That is, prove/logderiv_ms will be shown but
     // prove/logderiv/relation_ms will not be shown.
     std::string to_string(int depth = 2) const;
+    // Returns all the stats as a flat JSON object.
+    std::string to_json() const;
 
   private:
-    Stats() = default;
+    using Counters = std::array<std::atomic<uint64_t>, MAX_KEYS>;
+    struct KeyInfo {
+        std::string name;
+        bool is_timer;
+    };
+
+    Stats();
+
+    Key intern(const std::string& name, bool is_timer);
+    Counters& local_counters();
+    void add_elapsed(Key key, std::chrono::steady_clock::time_point start)
+    {
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        increment(key, static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+    }
+    // Returns (name, aggregated value) for every key that has a non-zero value. Timers are in milliseconds.
+    std::vector<std::pair<std::string, double>> collect() const;
+
+    std::atomic<bool> enabled = false;
 
-    std::unordered_map<std::string, uint64_t> stats;
-    mutable std::mutex stats_mutex;
+    // Protects the key registry and the list of per-thread counters (not the counters themselves).
+    mutable std::mutex registry_mutex;
+    std::vector<KeyInfo> keys;
+    std::unordered_map<std::string, Key> key_ids;
+    std::vector<std::unique_ptr<Counters>> thread_counters;
 };
 
-} // namespace bb::avm2
\ No newline at end of file
+} // namespace bb::avm2
@@ -0,0 +1,20 @@
+#include "barretenberg/vm2/tracegen/lib/sharding.hpp"
+
+namespace bb::avm2::tracegen {
+
+void TraceShard::set(uint32_t row, std::span<const std::pair<Column, FF>> values)
+{
+    for (const auto& [col, value] : values) {
+        columns[col].emplace_back(row, value);
+    }
+}
+
+void TraceShard::flush_into(TraceContainer& trace)
+{
+    for (const auto& [col, values] : columns) {
+        trace.set(col, values);
+    }
+    columns.clear();
+}
+
+} // namespace bb::avm2::tracegen
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/vm2/common/field.hpp"
+#include "barretenberg/vm2/common/map.hpp"
+#include "barretenberg/vm2/generated/columns.hpp"
+#include "barretenberg/vm2/tracegen/trace_container.hpp"
+
+namespace bb::avm2::tracegen {
+
+// Buffers the writes of one shard of a subtrace, grouped by column.
+// Shards of the same subtrace write to the same columns, so writing to the TraceContainer directly would
+// contend on the column locks for every row. Flushing takes each column lock only once per shard.
+class TraceShard {
+  public:
+    void set(uint32_t row, std::span<const std::pair<Column, FF>> values);
+    void flush_into(TraceContainer& trace);
+
+  private:
+    unordered_flat_map<Column, std::vector<std::pair<uint32_t, FF>>> columns;
+};
+
+// Minimum number of events in a shard. Below this, the scheduling overhead is not worth it.
+constexpr size_t MIN_EVENTS_PER_SHARD = 1 << 12;
+
+/**
+ * Splits a subtrace into shards of contiguous events and returns one job per shard.
+ * The first row of every event is computed with a prefix sum over the rows each event takes, starting at first_row.
+ * Therefore shards fill disjoint row ranges and the resulting trace is identical to the one filled serially.
+ *
+ * @param events The events. They must outlive the jobs.
+ * @param first_row The row where the first event starts.
+ * @param get_num_rows Returns the number of rows that an event takes.
+ * @param process_shard Fills the rows of a contiguous range of events, given the row where the range starts.
+ * @param on_done Called once, by the job that finishes last (e.g., to free the events).
+ * @param max_num_shards Upper bound on the number of shards. Defaults to the number of cpus.
+ */
+template <typename Event>
+std::vector<std::function<void()>> build_sharded_jobs(
+    const std::vector<Event>& events,
+    uint32_t first_row,
+    const std::function<uint32_t(const Event&)>& get_num_rows,
+    const std::function<void(std::span<const Event>, uint32_t)>& process_shard,
+    std::function<void()> on_done = [] {},
+    size_t max_num_shards = get_num_cpus())
+{
+    const size_t num_shards =
+        std::clamp<size_t>(events.size() / MIN_EVENTS_PER_SHARD, 1, std::max<size_t>(max_num_shards, 1));
+    const size_t shard_size = (events.size() + num_shards - 1) / num_shards;
+
+    // Prefix sum of the rows taken by the events before each shard.
+    std::vector<std::pair<size_t, uint32_t>> shard_starts; // (event index, row)
+    uint32_t row = first_row;
+    for (size_t i = 0; i < events.size(); i++) {
+        if (i % shard_size == 0) {
+            shard_starts.emplace_back(i, row);
+        }
+        row += get_num_rows(events[i]);
+    }
+    if (shard_starts.empty()) {
+        shard_starts.emplace_back(0, first_row);
+    }
+
+    auto remaining = std::make_shared<std::atomic<size_t>>(shard_starts.size());
+    std::vector<std::function<void()>> jobs;
+    jobs.reserve(shard_starts.size());
+    for (size_t s = 0; s < shard_starts.size(); s++) {
+        const auto [start, shard_first_row] = shard_starts[s];
+        const size_t end = s + 1 < shard_starts.size() ? shard_starts[s + 1].first : events.size();
+        jobs.push_back([&events, start, end, shard_first_row, process_shard, on_done, remaining]() {
+            process_shard(std::span<const Event>(events).subspan(start, end - start), shard_first_row);
+            if (remaining->fetch_sub(1) == 1) {
+                on_done();
+            }
+        });
+    }
+    return jobs;
+}
+
+} // namespace bb::avm2::tracegen
@@ -0,0 +1,126 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "barretenberg/vm2/tracegen/lib/sharding.hpp"
+
+namespace bb::avm2::tracegen {
+namespace {
+
+// Every event is the number of rows it takes.
+uint32_t get_num_rows(const uint32_t& event)
+{
+    return event;
+}
+
+struct Shard {
+    size_t start;
+    size_t size;
+    uint32_t first_row;
+};
+
+std::vector<Shard> run_jobs(const std::vector<uint32_t>& events,
+                            uint32_t first_row,
+                            size_t max_num_shards,
+                            size_t& num_done_calls)
+{
+    std::vector<Shard> shards;
+    auto jobs = build_sharded_jobs<uint32_t>(
+        events,
+        first_row,
+        get_num_rows,
+        [&](std::span<const uint32_t> shard, uint32_t shard_first_row) {
+            shards.push_back({ static_cast<size_t>(shard.data() - events.data()), shard.size(), shard_first_row });
+        },
+        [&] { num_done_calls++; },
+        max_num_shards);
+    // Run the jobs in reverse order. on_done must only be called by the last one.
+    for (size_t i = jobs.size(); i > 0; i--) {
+        EXPECT_EQ(num_done_calls, 0);
+        jobs[i - 1]();
+    }
+    EXPECT_EQ(num_done_calls, 1);
+    std::reverse(shards.begin(), shards.end());
+    return shards;
+}
+
+TEST(ShardingTest, ShardsAreContiguousAndStartAtThePrefixSumOfRows)
+{
+    std::vector<uint32_t> events(3 * MIN_EVENTS_PER_SHARD + 5);
+    for (size_t i = 0; i < events.size(); i++) {
+        // Includes events that take no rows.
+        events[i] = static_cast<uint32_t>(i % 7);
+    }
+
+    size_t num_done_calls = 0;
+    const auto shards = run_jobs(events, /*first_row=*/10, /*max_num_shards=*/8, num_done_calls);
+
+    ASSERT_EQ(shards.size(), 3);
+    size_t next_event = 0;
+    uint32_t next_row = 10;
+    for (const auto& shard : shards) {
+        EXPECT_EQ(shard.start, next_event);
+        EXPECT_EQ(shard.first_row, next_row);
+        EXPECT_GE(shard.size, MIN_EVENTS_PER_SHARD);
+        for (size_t i = shard.start; i < shard.start + shard.size; i++) {
+            next_row += events[i];
+        }
+        next_event += shard.size;
+    }
+    EXPECT_EQ(next_event, events.size());
+}
+
+TEST(ShardingTest, NumberOfShardsIsCapped)
+{
+    std::vector<uint32_t> events(5 * MIN_EVENTS_PER_SHARD, 1);
+
+    size_t num_done_calls = 0;
+    const auto shards = run_jobs(events, /*first_row=*/0, /*max_num_shards=*/2, num_done_calls);
+
+    ASSERT_EQ(shards.size(), 2);
+    EXPECT_EQ(shards[0].start, 0);
+    EXPECT_EQ(shards[1].start, shards[0].size);
+    EXPECT_EQ(shards[1].first_row, shards[0].size);
+    EXPECT_EQ(shards[0].size + shards[1].size, events.size());
+}
+
+TEST(ShardingTest, FewEventsMakeOneShard)
+{
+    std::vector<uint32_t> events(2 * MIN_EVENTS_PER_SHARD - 1, 1);
+
+    size_t num_done_calls = 0;
+    const auto shards = run_jobs(events, /*first_row=*/1, /*max_num_shards=*/8, num_done_calls);
+
+    ASSERT_EQ(shards.size(), 1);
+    EXPECT_EQ(shards[0].start, 0);
+    EXPECT_EQ(shards[0].size, events.size());
+    EXPECT_EQ(shards[0].first_row, 1);
+}
+
+TEST(ShardingTest, NoEventsMakeOneEmptyShard)
+{
+    std::vector<uint32_t> events;
+
+    size_t num_done_calls = 0;
+    auto jobs = build_sharded_jobs<uint32_t>(
+        events,
+        /*first_row=*/1,
+        get_num_rows,
+        [&](std::span<const uint32_t> shard, uint32_t first_row) {
+            EXPECT_TRUE(shard.empty());
+            EXPECT_EQ(first_row, 1);
+        },
+        [&] { num_done_calls++; });
+
+    ASSERT_EQ(jobs.size(), 1);
+    jobs[0]();
+    EXPECT_EQ(num_done_calls, 1);
+}
+
+} // namespace
+} // namespace bb::avm2::tracegen
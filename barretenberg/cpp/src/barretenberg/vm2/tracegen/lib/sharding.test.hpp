@@ -0,0 +1,53 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "barretenberg/vm2/common/field.hpp"
+#include "barretenberg/vm2/generated/columns.hpp"
+#include "barretenberg/vm2/tracegen/lib/sharding.hpp"
+#include "barretenberg/vm2/tracegen/trace_container.hpp"
+
+namespace bb::avm2::tracegen {
+
+// The sharded tracegen tests split their events into this many shards. Every shard gets more than
+// MIN_EVENTS_PER_SHARD events, so that build_sharded_jobs does split them.
+constexpr size_t NUM_TEST_SHARDS = 3;
+constexpr size_t NUM_SHARDED_TEST_EVENTS = NUM_TEST_SHARDS * MIN_EVENTS_PER_SHARD + 123;
+
+// Fills a subtrace with the jobs of build_sharded_jobs. The jobs run in reverse order, to make sure that the shards
+// do not depend on each other.
+template <typename Event>
+void fill_sharded(const std::vector<Event>& events,
+                  uint32_t first_row,
+                  const std::function<uint32_t(const Event&)>& get_num_rows,
+                  const std::function<void(std::span<const Event>, uint32_t)>& process_shard)
+{
+    auto jobs = build_sharded_jobs<Event>(events, first_row, get_num_rows, process_shard, [] {}, NUM_TEST_SHARDS);
+    ASSERT_EQ(jobs.size(), NUM_TEST_SHARDS);
+    std::for_each(jobs.rbegin(), jobs.rend(), [](const auto& job) { job(); });
+}
+
+// Expects both traces to have the same non-zero values in every column.
+inline void expect_same_trace(const TraceContainer& actual, const TraceContainer& expected)
+{
+    auto get_values = [](const TraceContainer& trace, Column col) {
+        std::vector<std::pair<uint32_t, FF>> values;
+        trace.visit_column(col, [&](uint32_t row, const FF& value) { values.emplace_back(row, value); });
+        std::sort(values.begin(), values.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+        return values;
+    };
+    for (size_t i = 0; i < TraceContainer::num_columns(); i++) {
+        const auto col = static_cast<Column>(i);
+        ASSERT_TRUE(get_values(actual, col) == get_values(expected, col)) << "column " << COLUMN_NAMES[i];
+    }
+}
+
+} // namespace bb::avm2::tracegen
@@ -1,18 +1,22 @@
 #include "barretenberg/vm2/tracegen/memory_trace.hpp"
 
+#include <cstdint>
 #include <memory>
+#include <span>
 
 #include "barretenberg/vm2/common/field.hpp"
 #include "barretenberg/vm2/tracegen/lib/interaction_def.hpp"
+#include "barretenberg/vm2/tracegen/lib/sharding.hpp"
 
 namespace bb::avm2::tracegen {
 
-void MemoryTraceBuilder::process(const simulation::EventEmitterInterface<simulation::MemoryEvent>::Container& events,
-                                 TraceContainer& trace)
+namespace {
+
+template <typename Trace>
+void fill_memory_rows(std::span<const simulation::MemoryEvent> events, uint32_t row, Trace& trace)
 {
     using C = Column;
 
-    uint32_t row = 0;
     for (const auto& event : events) {
         trace.set(row,
                   { {
@@ -28,6 +32,28 @@ void MemoryTraceBuilder::process(const simulation::EventEmitterInterface<simulat
     }
 }
 
+} // namespace
+
+void MemoryTraceBuilder::process(const simulation::EventEmitterInterface<simulation::MemoryEvent>::Container& events,
+                                 TraceContainer& trace)
+{
+    fill_memory_rows(events, /*row=*/0, trace);
+}
+
+void MemoryTraceBuilder::process_shard(std::span<const simulation::MemoryEvent> events,
+                                       uint32_t first_row,
+                                       TraceContainer& trace)
+{
+    TraceShard shard;
+    fill_memory_rows(events, first_row, shard);
+    shard.flush_into(trace);
+}
+
+uint32_t MemoryTraceBuilder::get_num_rows(const simulation::MemoryEvent&)
+{
+    return 1;
+}
+
 const InteractionDefinition MemoryTraceBuilder::interactions = InteractionDefinition();
 
 } // namespace bb::avm2::tracegen
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <span>
 
 #include "barretenberg/vm2/generated/columns.hpp"
 #include "barretenberg/vm2/simulation/events/event_emitter.hpp"
@@ -14,6 +16,10 @@ class MemoryTraceBuilder final {
   public:
     void process(const simulation::EventEmitterInterface<simulation::MemoryEvent>::Container& events,
                  TraceContainer& trace);
+    // Fills the rows of a contiguous range of events, where the first event starts at first_row.
+    // Shards with disjoint row ranges can be processed concurrently (see lib/sharding.hpp).
+    void process_shard(std::span<const simulation::MemoryEvent> events, uint32_t first_row, TraceContainer& trace);
+    static uint32_t get_num_rows(const simulation::MemoryEvent& event);
 
     static const InteractionDefinition interactions;
 };
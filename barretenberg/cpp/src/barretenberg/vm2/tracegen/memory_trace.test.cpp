@@ -0,0 +1,45 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "barretenberg/vm2/common/memory_types.hpp"
+#include "barretenberg/vm2/simulation/events/memory_event.hpp"
+#include "barretenberg/vm2/tracegen/lib/sharding.test.hpp"
+#include "barretenberg/vm2/tracegen/memory_trace.hpp"
+#include "barretenberg/vm2/tracegen/test_trace_container.hpp"
+
+namespace bb::avm2::tracegen {
+namespace {
+
+TEST(MemoryTraceGenTest, ShardedMatchesSerial)
+{
+    std::vector<simulation::MemoryEvent> events;
+    for (uint32_t i = 0; i < NUM_SHARDED_TEST_EVENTS; i++) {
+        events.push_back({ .execution_clk = i / 3,
+                           .mode = i % 2 == 0 ? simulation::MemoryMode::READ : simulation::MemoryMode::WRITE,
+                           .addr = 7 * i,
+                           .value = MemoryValue::from<uint32_t>(i * i),
+                           .space_id = i % 4 });
+    }
+    MemoryTraceBuilder builder;
+
+    TestTraceContainer serial_trace;
+    builder.process(events, serial_trace);
+
+    TestTraceContainer sharded_trace;
+    fill_sharded<simulation::MemoryEvent>(
+        events,
+        /*first_row=*/0,
+        MemoryTraceBuilder::get_num_rows,
+        [&](std::span<const simulation::MemoryEvent> shard, uint32_t first_row) {
+            builder.process_shard(shard, first_row, sharded_trace);
+        });
+
+    expect_same_trace(sharded_trace, serial_trace);
+}
+
+} // namespace
+} // namespace bb::avm2::tracegen
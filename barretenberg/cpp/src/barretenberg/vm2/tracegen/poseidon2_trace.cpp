@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <span>
 
 #include "barretenberg/crypto/poseidon2/poseidon2_permutation.hpp"
 #include "barretenberg/ecc/fields/field_declarations.hpp"
@@ -9,6 +10,7 @@
 #include "barretenberg/vm2/simulation/events/event_emitter.hpp"
 #include "barretenberg/vm2/simulation/events/poseidon2_event.hpp"
 #include "barretenberg/vm2/tracegen/lib/interaction_def.hpp"
+#include "barretenberg/vm2/tracegen/lib/sharding.hpp"
 
 using Poseidon2Perm = bb::crypto::Poseidon2Permutation<bb::crypto::Poseidon2Bn254ScalarFieldParams>;
 
@@ -281,14 +283,10 @@ constexpr std::array<StateCols, 64> intermediate_round_cols = { {
       Column::poseidon2_perm_T_63_4 },
 } };
 
-} // namespace
-
-void Poseidon2TraceBuilder::process_hash(
-    const simulation::EventEmitterInterface<simulation::Poseidon2HashEvent>::Container& hash_events,
-    TraceContainer& trace)
+template <typename Trace>
+void fill_hash_rows(std::span<const simulation::Poseidon2HashEvent> hash_events, uint32_t row, Trace& trace)
 {
     using C = Column;
-    uint32_t row = 1; // We start from row 1 because this trace contains shifted columns.
     for (const auto& event : hash_events) {
         auto input_size = event.inputs.size();
         auto num_perm_events = (input_size / 3) + static_cast<size_t>(input_size % 3 != 0);
@@ -338,96 +336,127 @@ void Poseidon2TraceBuilder::process_hash(
     }
 }
 
-void Poseidon2TraceBuilder::process_permutation(
-    const simulation::EventEmitterInterface<simulation::Poseidon2PermutationEvent>::Container& perm_events,
-    TraceContainer& trace)
+// Fills the rows of N permutation events, starting at `row`. The N permutations are computed in lock-step.
+template <size_t N, typename Trace>
+void fill_permutation_block(std::span<const simulation::Poseidon2PermutationEvent> perm_events,
+                            uint32_t row,
+                            Trace& trace)
 {
     using C = Column;
-    // Our current state
-    std::array<FF, 4> current_state;
-    // These are where we will store the intermediate values of current_state in the trace.
-    std::array<Column, 4> round_state_cols;
-
-    uint32_t row = 0;
-
-    for (const auto& event : perm_events) {
-        // The bulk of this code is a copy of the Poseidon2Permutation::permute function from bb
-        // Note that the functions mutate current_state in place.
-        current_state = event.input;
-
-        // Apply 1st linear layer
-        Poseidon2Perm::matrix_multiplication_external(current_state);
-        trace.set(row,
-                  { {
-                      { C::poseidon2_perm_sel, 1 },
-                      { C::poseidon2_perm_a_0, event.input[0] },
-                      { C::poseidon2_perm_a_1, event.input[1] },
-                      { C::poseidon2_perm_a_2, event.input[2] },
-                      { C::poseidon2_perm_a_3, event.input[3] },
+    using States = std::array<Poseidon2Perm::State, N>;
+    States states;
+    for (size_t j = 0; j < N; ++j) {
+        states[j] = perm_events[j].input;
+    }
 
-                      { C::poseidon2_perm_EXT_LAYER_6, current_state[0] },
-                      { C::poseidon2_perm_EXT_LAYER_5, current_state[1] },
-                      { C::poseidon2_perm_EXT_LAYER_7, current_state[2] },
-                      { C::poseidon2_perm_EXT_LAYER_4, current_state[3] },
+    // Each intermediate state is stored as the permutation advances
+    Poseidon2Perm::permutation_interleaved(states, [&](size_t round, const States& current) {
+        for (size_t j = 0; j < N; ++j) {
+            const auto& event = perm_events[j];
+            const auto& current_state = current[j];
+            const uint32_t event_row = row + static_cast<uint32_t>(j);
+            if (round == 0) {
+                // State after the 1st linear layer
+                trace.set(event_row,
+                          { {
+                              { C::poseidon2_perm_sel, 1 },
+                              { C::poseidon2_perm_a_0, event.input[0] },
+                              { C::poseidon2_perm_a_1, event.input[1] },
+                              { C::poseidon2_perm_a_2, event.input[2] },
+                              { C::poseidon2_perm_a_3, event.input[3] },
 
-                  } });
+                              { C::poseidon2_perm_EXT_LAYER_6, current_state[0] },
+                              { C::poseidon2_perm_EXT_LAYER_5, current_state[1] },
+                              { C::poseidon2_perm_EXT_LAYER_7, current_state[2] },
+                              { C::poseidon2_perm_EXT_LAYER_4, current_state[3] },
 
-        // Perform rounds of the permutation algorithm
-        // Initial external (full) rounds
-        constexpr size_t rounds_f_beginning = Poseidon2Perm::rounds_f / 2;
-        for (size_t i = 0; i < rounds_f_beginning; ++i) {
-            Poseidon2Perm::add_round_constants(current_state, Poseidon2Perm::round_constants[i]);
-            Poseidon2Perm::apply_sbox(current_state);
-            Poseidon2Perm::matrix_multiplication_external(current_state);
-            // Store end of round state
-            round_state_cols = intermediate_round_cols[i];
-            trace.set(row,
-                      { { { round_state_cols[0], current_state[0] },
-                          { round_state_cols[1], current_state[1] },
-                          { round_state_cols[2], current_state[2] },
-                          { round_state_cols[3], current_state[3] } } });
-        }
-
-        // Internal (partial) rounds
-        const size_t p_end = rounds_f_beginning + Poseidon2Perm::rounds_p;
-        for (size_t i = rounds_f_beginning; i < p_end; ++i) {
-            current_state[0] += Poseidon2Perm::round_constants[i][0];
-            Poseidon2Perm::apply_single_sbox(current_state[0]);
-            Poseidon2Perm::matrix_multiplication_internal(current_state);
+                          } });
+                continue;
+            }
             // Store end of round state
-            round_state_cols = intermediate_round_cols[i];
-            trace.set(row,
+            const StateCols& round_state_cols = intermediate_round_cols[round - 1];
+            trace.set(event_row,
                       { { { round_state_cols[0], current_state[0] },
                           { round_state_cols[1], current_state[1] },
                           { round_state_cols[2], current_state[2] },
                           { round_state_cols[3], current_state[3] } } });
         }
+    });
 
-        // Remaining external (full) rounds
-        for (size_t i = p_end; i < Poseidon2Perm::NUM_ROUNDS; ++i) {
-            Poseidon2Perm::add_round_constants(current_state, Poseidon2Perm::round_constants[i]);
-            Poseidon2Perm::apply_sbox(current_state);
-            Poseidon2Perm::matrix_multiplication_external(current_state);
-            round_state_cols = intermediate_round_cols[i];
-            trace.set(row,
-                      { { { round_state_cols[0], current_state[0] },
-                          { round_state_cols[1], current_state[1] },
-                          { round_state_cols[2], current_state[2] },
-                          { round_state_cols[3], current_state[3] } } });
-        }
-        // Set the output
-        trace.set(row,
+    // Set the outputs
+    for (size_t j = 0; j < N; ++j) {
+        trace.set(row + static_cast<uint32_t>(j),
                   { {
-                      { C::poseidon2_perm_b_0, current_state[0] },
-                      { C::poseidon2_perm_b_1, current_state[1] },
-                      { C::poseidon2_perm_b_2, current_state[2] },
-                      { C::poseidon2_perm_b_3, current_state[3] },
+                      { C::poseidon2_perm_b_0, states[j][0] },
+                      { C::poseidon2_perm_b_1, states[j][1] },
+                      { C::poseidon2_perm_b_2, states[j][2] },
+                      { C::poseidon2_perm_b_3, states[j][3] },
 
                   } });
+    }
+}
+
+template <typename Trace>
+void fill_permutation_rows(std::span<const simulation::Poseidon2PermutationEvent> perm_events,
+                           uint32_t row,
+                           Trace& trace)
+{
+    constexpr size_t BLOCK_SIZE = Poseidon2Perm::NUM_INTERLEAVED_STATES;
+    size_t i = 0;
+    for (; i + BLOCK_SIZE <= perm_events.size(); i += BLOCK_SIZE) {
+        fill_permutation_block<BLOCK_SIZE>(perm_events.subspan(i, BLOCK_SIZE), row, trace);
+        row += static_cast<uint32_t>(BLOCK_SIZE);
+    }
+    for (; i < perm_events.size(); ++i) {
+        fill_permutation_block<1>(perm_events.subspan(i, 1), row, trace);
         row++;
     }
 }
 
+} // namespace
+
+void Poseidon2TraceBuilder::process_hash(
+    const simulation::EventEmitterInterface<simulation::Poseidon2HashEvent>::Container& hash_events,
+    TraceContainer& trace)
+{
+    fill_hash_rows(hash_events, /*row=*/1, trace); // We start from row 1 because this trace contains shifted columns.
+}
+
+void Poseidon2TraceBuilder::process_permutation(
+    const simulation::EventEmitterInterface<simulation::Poseidon2PermutationEvent>::Container& perm_events,
+    TraceContainer& trace)
+{
+    fill_permutation_rows(perm_events, /*row=*/0, trace);
+}
+
+void Poseidon2TraceBuilder::process_hash_shard(std::span<const simulation::Poseidon2HashEvent> hash_events,
+                                               uint32_t first_row,
+                                               TraceContainer& trace)
+{
+    TraceShard shard;
+    fill_hash_rows(hash_events, first_row, shard);
+    shard.flush_into(trace);
+}
+
+void Poseidon2TraceBuilder::process_permutation_shard(
+    std::span<const simulation::Poseidon2PermutationEvent> perm_events, uint32_t first_row, TraceContainer& trace)
+{
+    TraceShard shard;
+    fill_permutation_rows(perm_events, first_row, shard);
+    shard.flush_into(trace);
+}
+
+uint32_t Poseidon2TraceBuilder::get_num_rows(const simulation::Poseidon2HashEvent& event)
+{
+    // One row per permutation, i.e., per chunk of 3 inputs.
+    return static_cast<uint32_t>((event.inputs.size() + 2) / 3);
+}
+
+uint32_t Poseidon2TraceBuilder::get_num_rows(const simulation::Poseidon2PermutationEvent&)
+{
+    return 1;
+}
+
 const InteractionDefinition Poseidon2TraceBuilder::interactions =
     InteractionDefinition().add<lookup_poseidon2_hash_poseidon2_perm_settings, InteractionType::LookupSequential>();
 
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <span>
 
 #include "barretenberg/vm2/generated/columns.hpp"
 #include "barretenberg/vm2/simulation/events/event_emitter.hpp"
@@ -18,6 +20,17 @@ class Poseidon2TraceBuilder final {
         const simulation::EventEmitterInterface<simulation::Poseidon2PermutationEvent>::Container& perm_events,
         TraceContainer& trace);
 
+    // Fill the rows of a contiguous range of events, where the first event starts at first_row.
+    // Shards with disjoint row ranges can be processed concurrently (see lib/sharding.hpp).
+    void process_hash_shard(std::span<const simulation::Poseidon2HashEvent> hash_events,
+                            uint32_t first_row,
+                            TraceContainer& trace);
+    void process_permutation_shard(std::span<const simulation::Poseidon2PermutationEvent> perm_events,
+                                   uint32_t first_row,
+                                   TraceContainer& trace);
+    static uint32_t get_num_rows(const simulation::Poseidon2HashEvent& event);
+    static uint32_t get_num_rows(const simulation::Poseidon2PermutationEvent& event);
+
     static const InteractionDefinition interactions;
 };
 
@@ -0,0 +1,79 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "barretenberg/vm2/common/field.hpp"
+#include "barretenberg/vm2/simulation/events/event_emitter.hpp"
+#include "barretenberg/vm2/simulation/events/poseidon2_event.hpp"
+#include "barretenberg/vm2/simulation/poseidon2.hpp"
+#include "barretenberg/vm2/tracegen/lib/sharding.test.hpp"
+#include "barretenberg/vm2/tracegen/poseidon2_trace.hpp"
+#include "barretenberg/vm2/tracegen/test_trace_container.hpp"
+
+namespace bb::avm2::tracegen {
+namespace {
+
+TEST(Poseidon2TraceGenTest, HashShardedMatchesSerial)
+{
+    simulation::EventEmitter<simulation::Poseidon2HashEvent> hash_emitter;
+    simulation::NoopEventEmitter<simulation::Poseidon2PermutationEvent> perm_emitter;
+    simulation::Poseidon2 poseidon2(hash_emitter, perm_emitter);
+    for (size_t i = 0; i < NUM_SHARDED_TEST_EVENTS; i++) {
+        // Inputs of different lengths, so that events take a different number of rows.
+        std::vector<FF> input(1 + (i % 8));
+        std::generate(input.begin(), input.end(), [] { return FF::random_element(); });
+        poseidon2.hash(input);
+    }
+    const auto events = hash_emitter.dump_events();
+    Poseidon2TraceBuilder builder;
+
+    TestTraceContainer serial_trace;
+    builder.process_hash(events, serial_trace);
+
+    // The trace starts at row 1 and every event takes one row per permutation.
+    TestTraceContainer sharded_trace;
+    fill_sharded<simulation::Poseidon2HashEvent>(
+        events,
+        /*first_row=*/1,
+        [](const simulation::Poseidon2HashEvent& event) { return Poseidon2TraceBuilder::get_num_rows(event); },
+        [&](std::span<const simulation::Poseidon2HashEvent> shard, uint32_t first_row) {
+            builder.process_hash_shard(shard, first_row, sharded_trace);
+        });
+
+    expect_same_trace(sharded_trace, serial_trace);
+}
+
+TEST(Poseidon2TraceGenTest, PermutationShardedMatchesSerial)
+{
+    simulation::NoopEventEmitter<simulation::Poseidon2HashEvent> hash_emitter;
+    simulation::EventEmitter<simulation::Poseidon2PermutationEvent> perm_emitter;
+    simulation::Poseidon2 poseidon2(hash_emitter, perm_emitter);
+    for (size_t i = 0; i < NUM_SHARDED_TEST_EVENTS; i++) {
+        poseidon2.permutation(
+            { FF::random_element(), FF::random_element(), FF::random_element(), FF::random_element() });
+    }
+    const auto events = perm_emitter.dump_events();
+    Poseidon2TraceBuilder builder;
+
+    TestTraceContainer serial_trace;
+    builder.process_permutation(events, serial_trace);
+
+    TestTraceContainer sharded_trace;
+    fill_sharded<simulation::Poseidon2PermutationEvent>(
+        events,
+        /*first_row=*/0,
+        [](const simulation::Poseidon2PermutationEvent& event) { return Poseidon2TraceBuilder::get_num_rows(event); },
+        [&](std::span<const simulation::Poseidon2PermutationEvent> shard, uint32_t first_row) {
+            builder.process_permutation_shard(shard, first_row, sharded_trace);
+        });
+
+    expect_same_trace(sharded_trace, serial_trace);
+}
+
+} // namespace
+} // namespace bb::avm2::tracegen
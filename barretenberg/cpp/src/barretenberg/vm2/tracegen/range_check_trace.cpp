@@ -4,21 +4,24 @@
 #include <cstdint>
 #include <memory>
 #include <ranges>
+#include <span>
 #include <stdexcept>
 
 #include "barretenberg/vm2/generated/relations/lookups_range_check.hpp"
 #include "barretenberg/vm2/simulation/events/event_emitter.hpp"
 #include "barretenberg/vm2/simulation/events/range_check_event.hpp"
 #include "barretenberg/vm2/tracegen/lib/interaction_def.hpp"
+#include "barretenberg/vm2/tracegen/lib/sharding.hpp"
 
 namespace bb::avm2::tracegen {
 
-void RangeCheckTraceBuilder::process(
-    const simulation::EventEmitterInterface<simulation::RangeCheckEvent>::Container& events, TraceContainer& trace)
+namespace {
+
+template <typename Trace>
+void fill_range_check_rows(std::span<const simulation::RangeCheckEvent> events, uint32_t row, Trace& trace)
 {
     using C = Column;
 
-    uint32_t row = 0;
     for (const auto& event : events) {
         // store off event entries to be used directly in row
         const uint256_t original_num_bits = event.num_bits;
@@ -28,7 +31,7 @@ void RangeCheckTraceBuilder::process(
         uint8_t num_bits = event.num_bits;
         uint256_t value = uint256_t::from_uint128(event.value);
 
-        std::array<uint16_t, 7> fixed_slice_registers; // u16_r0...6
+        std::array<uint16_t, 7> fixed_slice_registers{}; // u16_r0...6, zero above the most significant chunk
         size_t index_of_most_sig_16b_chunk = 0;
         uint16_t dynamic_slice_register = 0; // same as u16_r7
         uint8_t dynamic_bits = 0;
@@ -93,6 +96,28 @@ void RangeCheckTraceBuilder::process(
     }
 }
 
+} // namespace
+
+void RangeCheckTraceBuilder::process(
+    const simulation::EventEmitterInterface<simulation::RangeCheckEvent>::Container& events, TraceContainer& trace)
+{
+    fill_range_check_rows(events, /*row=*/0, trace);
+}
+
+void RangeCheckTraceBuilder::process_shard(std::span<const simulation::RangeCheckEvent> events,
+                                           uint32_t first_row,
+                                           TraceContainer& trace)
+{
+    TraceShard shard;
+    fill_range_check_rows(events, first_row, shard);
+    shard.flush_into(trace);
+}
+
+uint32_t RangeCheckTraceBuilder::get_num_rows(const simulation::RangeCheckEvent&)
+{
+    return 1;
+}
+
 const InteractionDefinition RangeCheckTraceBuilder::interactions =
     InteractionDefinition()
         .add<lookup_range_check_dyn_diff_is_u16_settings, InteractionType::LookupIntoIndexedByClk>()
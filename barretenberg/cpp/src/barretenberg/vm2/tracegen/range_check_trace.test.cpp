@@ -2,10 +2,13 @@
 #include <gtest/gtest.h>
 
 #include <cstdint>
+#include <span>
+#include <vector>
 
 #include "barretenberg/vm2/constraining/flavor_settings.hpp"
 #include "barretenberg/vm2/constraining/full_row.hpp"
 #include "barretenberg/vm2/testing/macros.hpp"
+#include "barretenberg/vm2/tracegen/lib/sharding.test.hpp"
 #include "barretenberg/vm2/tracegen/range_check_trace.hpp"
 #include "barretenberg/vm2/tracegen/test_trace_container.hpp"
 
@@ -141,5 +144,31 @@ TEST(RangeCheckTraceGenTest, RangeCheckLte128Bit)
                           ROW_FIELD_EQ(range_check_sel_r5_16_bit_rng_lookup, 1),
                           ROW_FIELD_EQ(range_check_sel_r6_16_bit_rng_lookup, 1))));
 }
+
+TEST(RangeCheckTraceGenTest, ShardedMatchesSerial)
+{
+    std::vector<simulation::RangeCheckEvent> events;
+    for (size_t i = 0; i < NUM_SHARDED_TEST_EVENTS; i++) {
+        const auto num_bits = static_cast<uint8_t>(1 + (i % 128));
+        events.push_back({ .value = (static_cast<uint128_t>(1) << (num_bits - 1)) + (i % num_bits),
+                           .num_bits = num_bits });
+    }
+    RangeCheckTraceBuilder builder;
+
+    TestTraceContainer serial_trace;
+    builder.process(events, serial_trace);
+
+    TestTraceContainer sharded_trace;
+    fill_sharded<simulation::RangeCheckEvent>(
+        events,
+        /*first_row=*/0,
+        RangeCheckTraceBuilder::get_num_rows,
+        [&](std::span<const simulation::RangeCheckEvent> shard, uint32_t first_row) {
+            builder.process_shard(shard, first_row, sharded_trace);
+        });
+
+    expect_same_trace(sharded_trace, serial_trace);
+}
+
 } // namespace
 } // namespace bb::avm2::tracegen
@@ -2,6 +2,7 @@
 
 #include <cassert>
 #include <memory>
+#include <span>
 
 #include "barretenberg/numeric/uint256/uint256.hpp"
 #include "barretenberg/vm2/common/aztec_types.hpp"
@@ -10,17 +11,19 @@
 #include "barretenberg/vm2/simulation/events/event_emitter.hpp"
 #include "barretenberg/vm2/simulation/events/to_radix_event.hpp"
 #include "barretenberg/vm2/tracegen/lib/interaction_def.hpp"
+#include "barretenberg/vm2/tracegen/lib/sharding.hpp"
 
 namespace bb::avm2::tracegen {
 
-void ToRadixTraceBuilder::process(const simulation::EventEmitterInterface<simulation::ToRadixEvent>::Container& events,
-                                  TraceContainer& trace)
+namespace {
+
+template <typename Trace>
+void fill_to_radix_rows(std::span<const simulation::ToRadixEvent> events, uint32_t row, Trace& trace)
 {
     using C = Column;
 
-    auto p_limbs_per_radix = get_p_limbs_per_radix();
+    const auto& p_limbs_per_radix = get_p_limbs_per_radix();
 
-    uint32_t row = 1; // We start from row 1 because this trace contains shifted columns.
     for (const auto& event : events) {
         FF value = event.value;
         uint32_t radix = event.radix;
@@ -88,6 +91,28 @@ void ToRadixTraceBuilder::process(const simulation::EventEmitterInterface<simula
     }
 }
 
+} // namespace
+
+void ToRadixTraceBuilder::process(const simulation::EventEmitterInterface<simulation::ToRadixEvent>::Container& events,
+                                  TraceContainer& trace)
+{
+    fill_to_radix_rows(events, /*row=*/1, trace); // We start from row 1 because this trace contains shifted columns.
+}
+
+void ToRadixTraceBuilder::process_shard(std::span<const simulation::ToRadixEvent> events,
+                                        uint32_t first_row,
+                                        TraceContainer& trace)
+{
+    TraceShard shard;
+    fill_to_radix_rows(events, first_row, shard);
+    shard.flush_into(trace);
+}
+
+uint32_t ToRadixTraceBuilder::get_num_rows(const simulation::ToRadixEvent& event)
+{
+    return static_cast<uint32_t>(event.limbs.size());
+}
+
 const InteractionDefinition ToRadixTraceBuilder::interactions =
     InteractionDefinition()
         .add<lookup_to_radix_limb_range_settings, InteractionType::LookupIntoIndexedByClk>()
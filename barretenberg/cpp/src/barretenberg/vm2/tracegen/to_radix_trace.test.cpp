@@ -0,0 +1,48 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "barretenberg/vm2/common/field.hpp"
+#include "barretenberg/vm2/simulation/events/event_emitter.hpp"
+#include "barretenberg/vm2/simulation/events/to_radix_event.hpp"
+#include "barretenberg/vm2/simulation/to_radix.hpp"
+#include "barretenberg/vm2/tracegen/lib/sharding.test.hpp"
+#include "barretenberg/vm2/tracegen/test_trace_container.hpp"
+#include "barretenberg/vm2/tracegen/to_radix_trace.hpp"
+
+namespace bb::avm2::tracegen {
+namespace {
+
+TEST(ToRadixTraceGenTest, ShardedMatchesSerial)
+{
+    simulation::EventEmitter<simulation::ToRadixEvent> emitter;
+    simulation::ToRadix to_radix(emitter);
+    for (uint32_t i = 0; i < NUM_SHARDED_TEST_EVENTS; i++) {
+        // Events of different lengths, so that shards start at rows that are not a multiple of the event index.
+        to_radix.to_le_radix(FF(1000 * i + 7), /*num_limbs=*/1 + (i % 5), /*radix=*/2 + (i % 255));
+    }
+    const auto events = emitter.dump_events();
+    ToRadixTraceBuilder builder;
+
+    TestTraceContainer serial_trace;
+    builder.process(events, serial_trace);
+
+    // The trace starts at row 1.
+    TestTraceContainer sharded_trace;
+    fill_sharded<simulation::ToRadixEvent>(
+        events,
+        /*first_row=*/1,
+        ToRadixTraceBuilder::get_num_rows,
+        [&](std::span<const simulation::ToRadixEvent> shard, uint32_t first_row) {
+            builder.process_shard(shard, first_row, sharded_trace);
+        });
+
+    expect_same_trace(sharded_trace, serial_trace);
+}
+
+} // namespace
+} // namespace bb::avm2::tracegen
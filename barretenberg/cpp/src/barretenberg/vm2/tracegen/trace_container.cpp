@@ -37,6 +37,27 @@ void TraceContainer::set(Column col, uint32_t row, const FF& value)
 {
     auto& column_data = (*trace)[static_cast<size_t>(col)];
     std::unique_lock lock(column_data.mutex);
+    set_unlocked(column_data, row, value);
+}
+
+void TraceContainer::set(uint32_t row, std::span<const std::pair<Column, FF>> values)
+{
+    for (const auto& [col, value] : values) {
+        set(col, row, value);
+    }
+}
+
+void TraceContainer::set(Column col, std::span<const std::pair<uint32_t, FF>> values)
+{
+    auto& column_data = (*trace)[static_cast<size_t>(col)];
+    std::unique_lock lock(column_data.mutex);
+    for (const auto& [row, value] : values) {
+        set_unlocked(column_data, row, value);
+    }
+}
+
+void TraceContainer::set_unlocked(SparseColumn& column_data, uint32_t row, const FF& value)
+{
     if (!value.is_zero()) {
         column_data.rows.insert_or_assign(row, value);
         column_data.max_row_number = std::max(column_data.max_row_number, static_cast<int64_t>(row));
@@ -50,13 +71,6 @@ void TraceContainer::set(Column col, uint32_t row, const FF& value)
     }
 }
 
-void TraceContainer::set(uint32_t row, std::span<const std::pair<Column, FF>> values)
-{
-    for (const auto& [col, value] : values) {
-        set(col, row, value);
-    }
-}
-
 void TraceContainer::reserve_column(Column col, size_t size)
 {
     auto& column_data = (*trace)[static_cast<size_t>(col)];
@@ -43,6 +43,8 @@ class TraceContainer {
     void set(Column col, uint32_t row, const FF& value);
     // Bulk setting for a given row.
     void set(uint32_t row, std::span<const std::pair<Column, FF>> values);
+    // Bulk setting for a given column. Takes the column lock only once.
+    void set(Column col, std::span<const std::pair<uint32_t, FF>> values);
     // Reserve column size. Useful for precomputed columns.
     void reserve_column(Column col, size_t size);
 
@@ -72,6 +74,9 @@ class TraceContainer {
         // (see serialization.hpp).
         unordered_flat_map<uint32_t, FF> rows;
     };
+    // Caller must hold the column lock.
+    static void set_unlocked(SparseColumn& column_data, uint32_t row, const FF& value);
+
     // We store the trace as a sparse matrix.
     // We use a unique_ptr to allocate the array in the heap vs the stack.
     // Even if the _content_ of each unordered_map is always heap-allocated, if we have 3k columns
@@ -27,6 +27,7 @@
 #include "barretenberg/vm2/tracegen/internal_call_stack_trace.hpp"
 #include "barretenberg/vm2/tracegen/keccakf1600_trace.hpp"
 #include "barretenberg/vm2/tracegen/lib/interaction_builder.hpp"
+#include "barretenberg/vm2/tracegen/lib/sharding.hpp"
 #include "barretenberg/vm2/tracegen/memory_trace.hpp"
 #include "barretenberg/vm2/tracegen/merkle_check_trace.hpp"
 #include "barretenberg/vm2/tracegen/note_hash_tree_check_trace.hpp"
@@ -202,6 +203,55 @@ void AvmTraceGenHelper::fill_trace_columns(TraceContainer& trace,
             build_precomputed_columns_jobs(trace),
             // Public inputs column jobs.
             build_public_inputs_columns_jobs(trace, public_inputs),
+            // High-volume subtraces are split into shards that fill disjoint row ranges in parallel.
+            build_sharded_jobs<MemoryEvent>(
+                events.memory,
+                /*first_row=*/0,
+                MemoryTraceBuilder::get_num_rows,
+                [&](std::span<const MemoryEvent> shard, uint32_t first_row) {
+                    MemoryTraceBuilder memory_trace_builder;
+                    AVM_TRACK_TIME("tracegen/memory", memory_trace_builder.process_shard(shard, first_row, trace));
+                },
+                [&]() { clear_events(events.memory); }),
+            build_sharded_jobs<RangeCheckEvent>(
+                events.range_check,
+                /*first_row=*/0,
+                RangeCheckTraceBuilder::get_num_rows,
+                [&](std::span<const RangeCheckEvent> shard, uint32_t first_row) {
+                    RangeCheckTraceBuilder range_check_builder;
+                    AVM_TRACK_TIME("tracegen/range_check",
+                                   range_check_builder.process_shard(shard, first_row, trace));
+                },
+                [&]() { clear_events(events.range_check); }),
+            build_sharded_jobs<ToRadixEvent>(
+                events.to_radix,
+                /*first_row=*/1, // This trace contains shifted columns.
+                ToRadixTraceBuilder::get_num_rows,
+                [&](std::span<const ToRadixEvent> shard, uint32_t first_row) {
+                    ToRadixTraceBuilder to_radix_builder;
+                    AVM_TRACK_TIME("tracegen/to_radix", to_radix_builder.process_shard(shard, first_row, trace));
+                },
+                [&]() { clear_events(events.to_radix); }),
+            build_sharded_jobs<Poseidon2HashEvent>(
+                events.poseidon2_hash,
+                /*first_row=*/1, // This trace contains shifted columns.
+                [](const Poseidon2HashEvent& event) { return Poseidon2TraceBuilder::get_num_rows(event); },
+                [&](std::span<const Poseidon2HashEvent> shard, uint32_t first_row) {
+                    Poseidon2TraceBuilder poseidon2_builder;
+                    AVM_TRACK_TIME("tracegen/poseidon2_hash",
+                                   poseidon2_builder.process_hash_shard(shard, first_row, trace));
+                },
+                [&]() { clear_events(events.poseidon2_hash); }),
+            build_sharded_jobs<Poseidon2PermutationEvent>(
+                events.poseidon2_permutation,
+                /*first_row=*/0,
+                [](const Poseidon2PermutationEvent& event) { return Poseidon2TraceBuilder::get_num_rows(event); },
+                [&](std::span<const Poseidon2PermutationEvent> shard, uint32_t first_row) {
+                    Poseidon2TraceBuilder poseidon2_builder;
+                    AVM_TRACK_TIME("tracegen/poseidon2_permutation",
+                                   poseidon2_builder.process_permutation_shard(shard, first_row, trace));
+                },
+                [&]() { clear_events(events.poseidon2_permutation); }),
             // Subtrace jobs.
             std::vector<std::function<void()>>{
                 [&]() {
@@ -279,23 +329,6 @@ void AvmTraceGenHelper::fill_trace_columns(TraceContainer& trace,
                     AVM_TRACK_TIME("tracegen/scalar_mul", ecc_builder.process_scalar_mul(events.scalar_mul, trace));
                     clear_events(events.scalar_mul);
                 },
-                [&]() {
-                    Poseidon2TraceBuilder poseidon2_builder;
-                    AVM_TRACK_TIME("tracegen/poseidon2_hash",
-                                   poseidon2_builder.process_hash(events.poseidon2_hash, trace));
-                    clear_events(events.poseidon2_hash);
-                },
-                [&]() {
-                    Poseidon2TraceBuilder poseidon2_builder;
-                    AVM_TRACK_TIME("tracegen/poseidon2_permutation",
-                                   poseidon2_builder.process_permutation(events.poseidon2_permutation, trace));
-                    clear_events(events.poseidon2_permutation);
-                },
-                [&]() {
-                    ToRadixTraceBuilder to_radix_builder;
-                    AVM_TRACK_TIME("tracegen/to_radix", to_radix_builder.process(events.to_radix, trace));
-                    clear_events(events.to_radix);
-                },
                 [&]() {
                     FieldGreaterThanTraceBuilder field_gt_builder;
                     AVM_TRACK_TIME("tracegen/field_gt", field_gt_builder.process(events.field_gt, trace));
@@ -306,11 +339,6 @@ void AvmTraceGenHelper::fill_trace_columns(TraceContainer& trace,
                     AVM_TRACK_TIME("tracegen/merkle_check", merkle_check_builder.process(events.merkle_check, trace));
                     clear_events(events.merkle_check);
                 },
-                [&]() {
-                    RangeCheckTraceBuilder range_check_builder;
-                    AVM_TRACK_TIME("tracegen/range_check", range_check_builder.process(events.range_check, trace));
-                    clear_events(events.range_check);
-                },
                 [&]() {
                     PublicDataTreeCheckTraceBuilder public_data_tree_check_trace_builder;
                     AVM_TRACK_TIME(
@@ -331,11 +359,6 @@ void AvmTraceGenHelper::fill_trace_columns(TraceContainer& trace,
                         nullifier_tree_check_trace_builder.process(events.nullifier_tree_check_events, trace));
                     clear_events(events.nullifier_tree_check_events);
                 },
-                [&]() {
-                    MemoryTraceBuilder memory_trace_builder;
-                    AVM_TRACK_TIME("tracegen/memory", memory_trace_builder.process(events.memory, trace));
-                    clear_events(events.memory);
-                },
                 [&]() {
                     DataCopyTraceBuilder data_copy_trace_builder;
                     AVM_TRACK_TIME("tracegen/data_copy",
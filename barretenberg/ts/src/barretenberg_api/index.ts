@@ -51,6 +51,18 @@ export class BarretenbergApi {
     return out[0];
   }
 
+  async pedersenHashMany(inputsBuffer: Fr[], hashSize: number, hashIndex: number): Promise<Fr[]> {
+    const inArgs = [inputsBuffer, hashSize, hashIndex].map(serializeBufferable);
+    const outTypes: OutputType[] = [VectorDeserializer(Fr)];
+    const result = await this.wasm.callWasmExport(
+      'pedersen_hash_many',
+      inArgs,
+      outTypes.map(t => t.SIZE_IN_BYTES),
+    );
+    const out = result.map((r, i) => outTypes[i].fromBuffer(r));
+    return out[0];
+  }
+
   async pedersenHashBuffer(inputBuffer: Uint8Array, hashIndex: number): Promise<Fr> {
     const inArgs = [inputBuffer, hashIndex].map(serializeBufferable);
     const outTypes: OutputType[] = [Fr];
@@ -87,6 +99,18 @@ export class BarretenbergApi {
     return out[0];
   }
 
+  async poseidon2HashMany(inputsBuffer: Fr[], hashSize: number): Promise<Fr[]> {
+    const inArgs = [inputsBuffer, hashSize].map(serializeBufferable);
+    const outTypes: OutputType[] = [VectorDeserializer(Fr)];
+    const result = await this.wasm.callWasmExport(
+      'poseidon2_hash_many',
+      inArgs,
+      outTypes.map(t => t.SIZE_IN_BYTES),
+    );
+    const out = result.map((r, i) => outTypes[i].fromBuffer(r));
+    return out[0];
+  }
+
   async poseidon2Permutation(inputsBuffer: Fr[]): Promise<Fr[]> {
     const inArgs = [inputsBuffer].map(serializeBufferable);
     const outTypes: OutputType[] = [VectorDeserializer(Fr)];
@@ -99,6 +123,18 @@ export class BarretenbergApi {
     return out[0];
   }
 
+  async poseidon2Permutations(inputsBuffer: Fr[]): Promise<Fr[]> {
+    const inArgs = [inputsBuffer].map(serializeBufferable);
+    const outTypes: OutputType[] = [VectorDeserializer(Fr)];
+    const result = await this.wasm.callWasmExport(
+      'poseidon2_permutations',
+      inArgs,
+      outTypes.map(t => t.SIZE_IN_BYTES),
+    );
+    const out = result.map((r, i) => outTypes[i].fromBuffer(r));
+    return out[0];
+  }
+
   async poseidon2HashAccumulate(inputsBuffer: Fr[]): Promise<Fr> {
     const inArgs = [inputsBuffer].map(serializeBufferable);
     const outTypes: OutputType[] = [Fr];
@@ -662,6 +698,18 @@ export class BarretenbergApiSync {
     return out[0];
   }
 
+  pedersenHashMany(inputsBuffer: Fr[], hashSize: number, hashIndex: number): Fr[] {
+    const inArgs = [inputsBuffer, hashSize, hashIndex].map(serializeBufferable);
+    const outTypes: OutputType[] = [VectorDeserializer(Fr)];
+    const result = this.wasm.callWasmExport(
+      'pedersen_hash_many',
+      inArgs,
+      outTypes.map(t => t.SIZE_IN_BYTES),
+    );
+    const out = result.map((r, i) => outTypes[i].fromBuffer(r));
+    return out[0];
+  }
+
   pedersenHashBuffer(inputBuffer: Uint8Array, hashIndex: number): Fr {
     const inArgs = [inputBuffer, hashIndex].map(serializeBufferable);
     const outTypes: OutputType[] = [Fr];
@@ -698,6 +746,18 @@ export class BarretenbergApiSync {
     return out[0];
   }
 
+  poseidon2HashMany(inputsBuffer: Fr[], hashSize: number): Fr[] {
+    const inArgs = [inputsBuffer, hashSize].map(serializeBufferable);
+    const outTypes: OutputType[] = [VectorDeserializer(Fr)];
+    const result = this.wasm.callWasmExport(
+      'poseidon2_hash_many',
+      inArgs,
+      outTypes.map(t => t.SIZE_IN_BYTES),
+    );
+    const out = result.map((r, i) => outTypes[i].fromBuffer(r));
+    return out[0];
+  }
+
   poseidon2Permutation(inputsBuffer: Fr[]): Fr[] {
     const inArgs = [inputsBuffer].map(serializeBufferable);
     const outTypes: OutputType[] = [VectorDeserializer(Fr)];
@@ -710,6 +770,18 @@ export class BarretenbergApiSync {
     return out[0];
   }
 
+  poseidon2Permutations(inputsBuffer: Fr[]): Fr[] {
+    const inArgs = [inputsBuffer].map(serializeBufferable);
+    const outTypes: OutputType[] = [VectorDeserializer(Fr)];
+    const result = this.wasm.callWasmExport(
+      'poseidon2_permutations',
+      inArgs,
+      outTypes.map(t => t.SIZE_IN_BYTES),
+    );
+    const out = result.map((r, i) => outTypes[i].fromBuffer(r));
+    return out[0];
+  }
+
   poseidon2HashAccumulate(inputsBuffer: Fr[]): Fr {
     const inArgs = [inputsBuffer].map(serializeBufferable);
     const outTypes: OutputType[] = [Fr];